@@ -0,0 +1,9 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "../../source/Randomness/Hashes.hpp"
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include "../../source/Primitives/TCone.inl"
 #include "../../source/Primitives/TCylinder.inl"
 #include "../../source/Primitives/TFrustum.inl"
+#include "../../source/Primitives/TFrustumCuller.inl"
 #include "../../source/Primitives/TLine.inl"
 #include "../../source/Primitives/TPlane.inl"
 #include "../../source/Primitives/TPolygon.hpp"
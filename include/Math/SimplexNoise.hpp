@@ -6,4 +6,4 @@
 /// SPDX-License-Identifier: GPL-3.0-or-later                                 
 ///                                                                           
 #pragma once
-#include "../../source/Randomness/SimplexNoise.hpp"
\ No newline at end of file
+#include "../../source/Randomness/SimplexNoise.inl"
\ No newline at end of file
@@ -59,6 +59,7 @@ namespace Langulus::Math
       (void) MetaOf<Traits::Level>();
       (void) MetaOf<Traits::Interpolator>();
       (void) MetaOf<Traits::Perspective>();
+      (void) MetaOf<Traits::Overflow>();
    }
 
    /// Register verbs                                                         
@@ -91,6 +91,8 @@ LANGULUS_DEFINE_TRAIT(Interpolator,
    "Interpolation mode");
 LANGULUS_DEFINE_TRAIT(Perspective,
    "Perspective state (boolean)");
+LANGULUS_DEFINE_TRAIT(Overflow,
+   "Number of arithmetic results, that didn't fit their type");
 
 
 /// Namespace containing all built-in math verbs                              
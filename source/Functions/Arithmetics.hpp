@@ -7,6 +7,7 @@
 ///                                                                           
 #pragma once
 #include "../Common.hpp"
+#include <limits>
 
 
 namespace Langulus::CT
@@ -625,4 +626,317 @@ namespace Langulus::Math
       return p * t3 + ((n0 - n1) - p) * t2 + (n2 - n0) * a + n1;
    }
 
+   /// Get the limit, that a number saturates to, when it doesn't fit its type
+   ///   @param negative - true to get the lowest value, false for the biggest
+   ///   @return the limit                                                    
+   template<CT::Number T>
+   NOD() LANGULUS(INLINED)
+   constexpr T SaturationLimit(bool negative) noexcept {
+      return negative
+         ? ::std::numeric_limits<T>::lowest()
+         : ::std::numeric_limits<T>::max();
+   }
+
+   namespace Inner
+   {
+
+      /// Check if a real result became infinite, while its operands weren't  
+      template<CT::Real T>
+      NOD() LANGULUS(INLINED)
+      constexpr bool RealOverflow(T a, T b, T result) noexcept {
+         // Bitwise, because short-circuiting prevents vectorization    
+         constexpr T Max = ::std::numeric_limits<T>::max();
+         return (::std::abs(result) > Max)
+              & (::std::abs(a) <= Max)
+              & (::std::abs(b) <= Max);
+      }
+
+   } // namespace Langulus::Math::Inner
+
+   ///                                                                        
+   ///   Checked arithmetic                                                   
+   ///                                                                        
+   ///   Each function writes the result to out, and reports if it didn't fit 
+   /// the type. Integers wrap around by default, while reals become infinite 
+   /// - saturating clamps them to the limits of the type instead. The        
+   /// functions are branchless for additions, subtractions and               
+   /// multiplications of up to 32bit integers, so that they vectorize        
+   ///                                                                        
+
+   /// Add two numbers                                                        
+   ///   @tparam SATURATE - whether to clamp the result to the type's limits  
+   ///   @param a - left operand                                              
+   ///   @param b - right operand                                             
+   ///   @param out - [out] the result                                        
+   ///   @return true if the result overflowed or underflowed                 
+   template<bool SATURATE, CT::Number T>
+   NOD() LANGULUS(INLINED)
+   constexpr bool AddChecked(T a, T b, T& out) noexcept {
+      bool overflow;
+      if constexpr (CT::Real<T>) {
+         out = a + b;
+         overflow = Inner::RealOverflow(a, b, out);
+         if constexpr (SATURATE)
+            out = overflow ? SaturationLimit<T>(out < 0) : out;
+      }
+      else if constexpr (CT::Unsigned<T>) {
+         out = static_cast<T>(a + b);
+         overflow = out < a;
+         if constexpr (SATURATE)
+            out = overflow ? SaturationLimit<T>(false) : out;
+      }
+      else {
+         using U = ::std::make_unsigned_t<T>;
+         out = static_cast<T>(static_cast<U>(a) + static_cast<U>(b));
+         overflow = ((a ^ out) & (b ^ out)) < 0;
+         if constexpr (SATURATE)
+            out = overflow ? SaturationLimit<T>(b < 0) : out;
+      }
+      return overflow;
+   }
+
+   /// Subtract two numbers                                                   
+   ///   @tparam SATURATE - whether to clamp the result to the type's limits  
+   ///   @param a - left operand                                              
+   ///   @param b - right operand                                             
+   ///   @param out - [out] the result                                        
+   ///   @return true if the result overflowed or underflowed                 
+   template<bool SATURATE, CT::Number T>
+   NOD() LANGULUS(INLINED)
+   constexpr bool SubChecked(T a, T b, T& out) noexcept {
+      bool overflow;
+      if constexpr (CT::Real<T>) {
+         out = a - b;
+         overflow = Inner::RealOverflow(a, b, out);
+         if constexpr (SATURATE)
+            out = overflow ? SaturationLimit<T>(out < 0) : out;
+      }
+      else if constexpr (CT::Unsigned<T>) {
+         out = static_cast<T>(a - b);
+         overflow = a < b;
+         if constexpr (SATURATE)
+            out = overflow ? SaturationLimit<T>(true) : out;
+      }
+      else {
+         using U = ::std::make_unsigned_t<T>;
+         out = static_cast<T>(static_cast<U>(a) - static_cast<U>(b));
+         overflow = ((a ^ b) & (a ^ out)) < 0;
+         if constexpr (SATURATE)
+            out = overflow ? SaturationLimit<T>(b > 0) : out;
+      }
+      return overflow;
+   }
+
+   /// Multiply two numbers                                                   
+   ///   @tparam SATURATE - whether to clamp the result to the type's limits  
+   ///   @param a - left operand                                              
+   ///   @param b - right operand                                             
+   ///   @param out - [out] the result                                        
+   ///   @return true if the result overflowed or underflowed                 
+   template<bool SATURATE, CT::Number T>
+   NOD() LANGULUS(INLINED)
+   constexpr bool MulChecked(T a, T b, T& out) noexcept {
+      bool overflow;
+      if constexpr (CT::Real<T>) {
+         out = a * b;
+         overflow = Inner::RealOverflow(a, b, out);
+      }
+      else if constexpr (sizeof(T) <= 4) {
+         // The product always fits in 64 bits                          
+         using W = Conditional<CT::Signed<T>, ::std::int64_t, ::std::uint64_t>;
+         const W wide = static_cast<W>(a) * static_cast<W>(b);
+         out = static_cast<T>(wide);
+         overflow = static_cast<W>(out) != wide;
+      }
+      else {
+         using U = ::std::make_unsigned_t<T>;
+         out = static_cast<T>(static_cast<U>(a) * static_cast<U>(b));
+         if constexpr (CT::Signed<T>) {
+            // Dividing the lowest value by -1 overflows too            
+            overflow = a == T {-1}
+               ? b == ::std::numeric_limits<T>::lowest()
+               : a != T {0} and out / a != b;
+         }
+         else overflow = a != T {0} and out / a != b;
+      }
+
+      if constexpr (SATURATE) {
+         if constexpr (CT::Unsigned<T>)
+            out = overflow ? SaturationLimit<T>(false) : out;
+         else
+            out = overflow ? SaturationLimit<T>((a < 0) != (b < 0)) : out;
+      }
+      return overflow;
+   }
+
+   /// Divide two numbers                                                     
+   /// Integer division by zero is reported as an overflow - the result is    
+   /// zero, unless saturating                                                
+   ///   @tparam SATURATE - whether to clamp the result to the type's limits  
+   ///   @param a - left operand                                              
+   ///   @param b - right operand                                             
+   ///   @param out - [out] the result                                        
+   ///   @return true if the result overflowed or underflowed                 
+   template<bool SATURATE, CT::Number T>
+   NOD() LANGULUS(INLINED)
+   constexpr bool DivChecked(T a, T b, T& out) noexcept {
+      if constexpr (CT::Real<T>) {
+         out = a / b;
+         const bool overflow = Inner::RealOverflow(a, b, out);
+         if constexpr (SATURATE)
+            out = overflow ? SaturationLimit<T>(out < 0) : out;
+         return overflow;
+      }
+      else {
+         if (b == T {0}) {
+            if constexpr (SATURATE)
+               out = a == T {0} ? T {0} : SaturationLimit<T>(a < T {0});
+            else
+               out = T {0};
+            return true;
+         }
+
+         if constexpr (CT::Signed<T>) {
+            if (a == ::std::numeric_limits<T>::lowest() and b == T {-1}) {
+               out = SATURATE ? SaturationLimit<T>(false) : a;
+               return true;
+            }
+         }
+
+         out = static_cast<T>(a / b);
+         return false;
+      }
+   }
+
+   /// Raise a number to a power                                              
+   /// Integers are raised exactly, by squaring. Negative integer exponents   
+   /// result in zero, unless the base is a unit - zero to a negative power   
+   /// is reported as an overflow                                             
+   ///   @tparam SATURATE - whether to clamp the result to the type's limits  
+   ///   @param base - value to exponentiate                                  
+   ///   @param exponent - the power to raise to                              
+   ///   @param out - [out] the result                                        
+   ///   @return true if the result overflowed or underflowed                 
+   template<bool SATURATE, CT::Number T>
+   NOD() LANGULUS(INLINED)
+   constexpr bool PowChecked(T base, T exponent, T& out) noexcept {
+      if constexpr (CT::Real<T>) {
+         out = static_cast<T>(::std::pow(base, exponent));
+         const bool overflow = Inner::RealOverflow(base, exponent, out);
+         if constexpr (SATURATE)
+            out = overflow ? SaturationLimit<T>(out < 0) : out;
+         return overflow;
+      }
+      else {
+         if constexpr (CT::Signed<T>) {
+            if (exponent < T {0}) {
+               if (base == T {0}) {
+                  out = SATURATE ? SaturationLimit<T>(false) : T {0};
+                  return true;
+               }
+
+               out = base == T {1} or (base == T {-1} and not (exponent & T {1}))
+                  ? T {1} : (base == T {-1} ? T {-1} : T {0});
+               return false;
+            }
+         }
+
+         // Wrapped multiplications keep the wrapped result exact, and  
+         // the base is squared only if a higher exponent bit needs it  
+         auto e = static_cast<::std::make_unsigned_t<T>>(exponent);
+         bool overflow = false;
+         T result {1};
+         T square = base;
+         while (true) {
+            if (e & 1u)
+               overflow |= MulChecked<false>(result, square, result);
+            e >>= 1u;
+            if (not e)
+               break;
+            overflow |= MulChecked<false>(square, square, square);
+         }
+
+         if constexpr (SATURATE) {
+            out = overflow
+               ? SaturationLimit<T>(base < T {0} and (exponent & T {1}))
+               : result;
+         }
+         else out = result;
+         return overflow;
+      }
+   }
+
+   /// Extract a root of a number                                             
+   /// The reciprocal of a real degree is checked like a division. Integer    
+   /// roots are exact - the result is the root's integer part, and negative  
+   /// degrees are the reciprocals of that, like negative powers. A zero      
+   /// degree, an even root of a negative integer, and a root of zero with a  
+   /// negative degree have no integer result, and are reported as overflows  
+   ///   @tparam SATURATE - whether to clamp the result to the type's limits  
+   ///   @param base - value to extract the root of                           
+   ///   @param degree - the degree of the root                               
+   ///   @param out - [out] the result                                        
+   ///   @return true if the result overflowed, underflowed or doesn't exist  
+   template<bool SATURATE, CT::Number T>
+   NOD() LANGULUS(INLINED)
+   constexpr bool RootChecked(T base, T degree, T& out) noexcept {
+      if constexpr (CT::Real<T>) {
+         T reciprocal;
+         bool overflow = DivChecked<SATURATE>(T {1}, degree, reciprocal);
+         overflow |= PowChecked<SATURATE>(base, reciprocal, out);
+         return overflow;
+      }
+      else {
+         // Zeroth root is like raising to 1/0                          
+         if (degree == T {0}) {
+            if constexpr (SATURATE) {
+               out = base == T {0} or base == T {1} ? base
+                  : SaturationLimit<T>(base < T {0});
+            }
+            else out = T {0};
+            return true;
+         }
+
+         using U = ::std::make_unsigned_t<T>;
+         bool negativeBase = false;
+         bool negativeDegree = false;
+         U magnitude = static_cast<U>(base);
+         U n = static_cast<U>(degree);
+         if constexpr (CT::Signed<T>) {
+            negativeBase = base < T {0};
+            negativeDegree = degree < T {0};
+            if (negativeBase)
+               magnitude = static_cast<U>(U {0} - magnitude);
+            if (negativeDegree)
+               n = static_cast<U>(U {0} - n);
+
+            if (negativeBase and not (n & 1u)) {
+               out = T {0};
+               return true;
+            }
+         }
+
+         // Search for the biggest root, that doesn't exceed the base   
+         U lo = 0;
+         U hi = magnitude;
+         while (lo < hi) {
+            const U mid = static_cast<U>(lo + (hi - lo) / 2u + 1u);
+            U power;
+            if (not PowChecked<false>(mid, n, power) and power <= magnitude)
+               lo = mid;
+            else
+               hi = static_cast<U>(mid - 1u);
+         }
+
+         const T root = static_cast<T>(negativeBase ? U {0} - lo : lo);
+         if constexpr (CT::Signed<T>) {
+            if (negativeDegree)
+               return PowChecked<SATURATE>(root, T {-1}, out);
+         }
+
+         out = root;
+         return false;
+      }
+   }
+
 } // namespace Langulus::Math
\ No newline at end of file
@@ -156,4 +156,46 @@ namespace Langulus::Math
          return ::std::atan2(static_cast<Real>(b), static_cast<Real>(a));
    }
 
+   /// Approximate sine, branchless and suitable for vectorization            
+   /// The angle is folded into [-pi/2, pi/2], where a Taylor polynomial of   
+   /// ninth degree is evaluated                                              
+   ///   @attention absolute error is less than 3.6e-6, as long as the angle  
+   ///      is moderately sized - huge angles lose precision when wrapped     
+   ///   @param a - the angle in radians                                      
+   ///   @return the sine                                                     
+   template<CT::Real T>
+   NOD() LANGULUS(INLINED) constexpr T FastSin(T a) noexcept {
+      // Wrap to [-pi, pi], then fold to [-pi/2, pi/2], using the       
+      // sin(pi - x) = sin(x) identity                                  
+      a -= TAU<T> * static_cast<T>(static_cast<long long>(a * TAUi<T> + (a < 0 ? T {-.5} : T {.5})));
+      a = a > HALFPI<T> ? PI<T> - a : (a < -HALFPI<T> ? -PI<T> - a : a);
+
+      const T a2 = a * a;
+      return a * (T {1} + a2 * (T {-1} / T {6} + a2 * (T {1} / T {120}
+         + a2 * (T {-1} / T {5040} + a2 * (T {1} / T {362880})))));
+   }
+
+   /// Approximate cosine, branchless and suitable for vectorization          
+   ///   @attention absolute error is less than 3.6e-6, as long as the angle  
+   ///      is moderately sized - huge angles lose precision when wrapped     
+   ///   @param a - the angle in radians                                      
+   ///   @return the cosine                                                   
+   template<CT::Real T>
+   NOD() LANGULUS(INLINED) constexpr T FastCos(T a) noexcept {
+      return FastSin(a + HALFPI<T>);
+   }
+
+   /// Approximate arc cosine, branchless and suitable for vectorization      
+   /// Uses the polynomial from Abramowitz & Stegun, formula 4.4.45           
+   ///   @attention absolute error is less than 6.8e-5 radians                
+   ///   @param x - the cosine, must be in the [-1, 1] range                  
+   ///   @return the angle in radians, in the [0, pi] range                   
+   template<CT::Real T>
+   NOD() LANGULUS(INLINED) T FastAcos(T x) noexcept {
+      const T ax = x < 0 ? -x : x;
+      const T r = ::std::sqrt(T {1} - ax) * (T {1.5707288} + ax * (T {-0.2121144}
+         + ax * (T {0.0742610} + ax * T {-0.0187293})));
+      return x < 0 ? PI<T> - r : r;
+   }
+
 } // namespace Langulus::Math
@@ -0,0 +1,92 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "TMatrix.hpp"
+#include "../Vectors/TVectorStream.hpp"
+
+#define TARGS(a)     CT::ScalarBased a##T, Count a##C, Count a##R
+#define TMAT(a)      TMatrix<a##T, a##C, a##R>
+
+
+namespace Langulus::Math
+{
+
+   ///                                                                        
+   ///   Batched matrix transformations                                       
+   ///                                                                        
+   ///   Transform large amounts of vectors by a single matrix. Unlike the    
+   /// matrix * vector operator, which does a horizontal sum for each row,    
+   /// these keep the matrix columns in registers for the whole batch, and    
+   /// accumulate broadcasted components on them - no horizontal operations.  
+   ///   When transforming vectors with one component less than the matrix    
+   /// columns (i.e. Vec3 by Mat4), vectors are considered points, having an  
+   /// implicit last component of one.                                        
+   ///   All functions allow transforming in place (input same as output).    
+   ///                                                                        
+   namespace Inner
+   {
+
+      /// The different batch transformation modes                            
+      enum class TransformMode {
+         // Full multiplication, result is truncated to the input size  
+         Full,
+         // The last matrix row is assumed (0, ..., 0, 1), and isn't used
+         Affine,
+         // The homogeneous coordinate is computed, and the result is   
+         // divided by it (perspective divide)                          
+         Project
+      };
+
+      template<TransformMode, TARGS(M), Count S>
+      void Transform(const TMAT(M)&, const TVector<MT, S>*, TVector<MT, S>*, Count) noexcept;
+
+      template<TransformMode, TARGS(M), Count S>
+      void Transform(const TMAT(M)&, const TVectorStream<MT, S>&, TVectorStream<MT, S>&);
+
+   } // namespace Langulus::Math::Inner
+
+   /// Full transformation                                                    
+   template<TARGS(M), Count S>
+   void Transform(const TMAT(M)&, const TVector<MT, S>*, TVector<MT, S>*, Count) noexcept;
+   template<TARGS(M), Count S> NOD()
+   auto Transform(const TMAT(M)&, const TMany<TVector<MT, S>>&) -> TMany<TVector<MT, S>>;
+   template<TARGS(M), Count S> NOD()
+   auto Transform(const TMAT(M)&, const TVectorStream<MT, S>&) -> TVectorStream<MT, S>;
+
+   /// Affine transformation - ignores the last row of the matrix, or works   
+   /// on compact affine matrices (4x3), that don't have one                  
+   template<TARGS(M), Count S>
+   void TransformAffine(const TMAT(M)&, const TVector<MT, S>*, TVector<MT, S>*, Count) noexcept;
+   template<TARGS(M), Count S> NOD()
+   auto TransformAffine(const TMAT(M)&, const TMany<TVector<MT, S>>&) -> TMany<TVector<MT, S>>;
+   template<TARGS(M), Count S> NOD()
+   auto TransformAffine(const TMAT(M)&, const TVectorStream<MT, S>&) -> TVectorStream<MT, S>;
+
+   /// Projective transformation - does a perspective divide                  
+   template<TARGS(M), Count S>
+   void TransformProject(const TMAT(M)&, const TVector<MT, S>*, TVector<MT, S>*, Count) noexcept;
+   template<TARGS(M), Count S> NOD()
+   auto TransformProject(const TMAT(M)&, const TMany<TVector<MT, S>>&) -> TMany<TVector<MT, S>>;
+   template<TARGS(M), Count S> NOD()
+   auto TransformProject(const TMAT(M)&, const TVectorStream<MT, S>&) -> TVectorStream<MT, S>;
+
+   /// Batched matrix multiplication - multiply many matrices by a single one 
+   /// (i.e. an array of model matrices by a shared view-projection)          
+   template<TARGS(M)>
+   void Multiply(const TMAT(M)*, const TMAT(M)&, TMAT(M)*, Count) noexcept;
+   template<TARGS(M)>
+   void Multiply(const TMAT(M)&, const TMAT(M)*, TMAT(M)*, Count) noexcept;
+   template<TARGS(M)> NOD()
+   auto Multiply(const TMany<TMAT(M)>&, const TMAT(M)&) -> TMany<TMAT(M)>;
+   template<TARGS(M)> NOD()
+   auto Multiply(const TMAT(M)&, const TMany<TMAT(M)>&) -> TMany<TMAT(M)>;
+
+} // namespace Langulus::Math
+
+#undef TARGS
+#undef TMAT
\ No newline at end of file
@@ -0,0 +1,349 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Batch.hpp"
+#include "TMatrix.inl"
+#include "../Vectors/TVectorStream.inl"
+
+#define TARGS(a)     CT::ScalarBased a##T, Count a##C, Count a##R
+#define TMAT(a)      TMatrix<a##T, a##C, a##R>
+
+
+namespace Langulus::Math
+{
+   namespace Inner
+   {
+
+      /// Get the number of matrix rows a transformation mode has to compute  
+      ///   @tparam MODE - the transformation mode                            
+      ///   @tparam S - the size of the transformed vectors                   
+      ///   @tparam COLUMNS - the number of columns in the matrix             
+      ///   @tparam ROWS - the number of rows in the matrix                   
+      template<TransformMode MODE, Count S, Count COLUMNS, Count ROWS>
+      consteval Count TransformRows() noexcept {
+         if constexpr (MODE == TransformMode::Affine)
+            return Math::Min(S, COLUMNS - 1);
+         else if constexpr (MODE == TransformMode::Project)
+            return ROWS;
+         else
+            return S;
+      }
+
+      /// Check if a transformation is valid at compile-time                  
+      template<TransformMode MODE, TARGS(M), Count S>
+      consteval void TransformCheck() noexcept {
+         static_assert(S == MC or S + 1 == MC,
+            "Vector size must be the same as the matrix columns, "
+            "or one less (for transforming points)");
+         static_assert(S <= MR,
+            "Matrix doesn't have enough rows for the vector size");
+         static_assert(MODE == TransformMode::Full or MC == MR
+            or (MODE == TransformMode::Affine and MC == MR + 1),
+            "Affine transformations require square or compact affine "
+            "matrices, and projective ones require square matrices");
+         static_assert(MODE != TransformMode::Project or CT::Real<MT>,
+            "Perspective divide requires a real number type");
+      }
+
+      /// Transform an array of vectors by a matrix                           
+      ///   @tparam MODE - the transformation mode                            
+      ///   @param m - the matrix                                             
+      ///   @param in - the vectors to transform                              
+      ///   @param out - [out] the transformed vectors (can be same as in)    
+      ///   @param count - number of vectors to transform                     
+      template<TransformMode MODE, TARGS(M), Count S>
+      void Transform(
+         const TMAT(M)& m, const TVector<MT, S>* in, TVector<MT, S>* out, Count count
+      ) noexcept {
+         TransformCheck<MODE, MT, MC, MR, S>();
+         constexpr bool Point = S + 1 == MC;
+         constexpr Count Rows = TransformRows<MODE, S, MC, MR>();
+         using Column = TVector<MT, Rows>;
+
+         // Keep only the relevant part of each column, for the whole   
+         // batch - these will be kept in registers                     
+         Column columns[MC];
+         for (Offset c = 0; c < MC; ++c) {
+            for (Offset r = 0; r < Rows; ++r)
+               columns[c].all[r] = m.mColumns[c].all[r];
+         }
+
+         for (Offset i = 0; i < count; ++i) {
+            const auto& v = in[i];
+
+            // Broadcast each component over its column and accumulate  
+            Column r = columns[0] * v.all[0];
+            for (Offset c = 1; c < S; ++c)
+               r += columns[c] * v.all[c];
+            if constexpr (Point)
+               r += columns[S];
+
+            if constexpr (MODE == TransformMode::Project) {
+               const MT w = MT {1} / r.all[Rows - 1];
+               for (Offset c = 0; c < S; ++c)
+                  out[i].all[c] = r.all[c] * w;
+            }
+            else if constexpr (MODE == TransformMode::Affine and Rows < S) {
+               // The last component passes through unchanged           
+               const MT last = v.all[S - 1];
+               for (Offset c = 0; c < Rows; ++c)
+                  out[i].all[c] = r.all[c];
+               out[i].all[S - 1] = last;
+            }
+            else {
+               for (Offset c = 0; c < S; ++c)
+                  out[i].all[c] = r.all[c];
+            }
+         }
+      }
+
+      /// Transform a stream of vectors by a matrix                           
+      ///   @tparam MODE - the transformation mode                            
+      ///   @param m - the matrix                                             
+      ///   @param in - the vectors to transform                              
+      ///   @param out - [out] the transformed vectors (can be same as in)    
+      template<TransformMode MODE, TARGS(M), Count S>
+      void Transform(
+         const TMAT(M)& m, const TVectorStream<MT, S>& in, TVectorStream<MT, S>& out
+      ) {
+         TransformCheck<MODE, MT, MC, MR, S>();
+         constexpr bool Point = S + 1 == MC;
+         constexpr Count Rows = TransformRows<MODE, S, MC, MR>();
+         const Count count = in.GetCount();
+         out.Resize(count);
+
+         // Coefficients are broadcasted into registers, while lanes    
+         // are processed a register at a time                          
+         MT k[MC][Rows];
+         for (Offset c = 0; c < MC; ++c) {
+            for (Offset r = 0; r < Rows; ++r)
+               k[c][r] = m.mColumns[c].all[r];
+         }
+
+         const MT* src[S];
+         MT* dst[S];
+         for (Offset c = 0; c < S; ++c) {
+            src[c] = in.GetLane(c);
+            dst[c] = out.GetLane(c);
+         }
+
+         for (Offset i = 0; i < count; ++i) {
+            MT v[S];
+            for (Offset c = 0; c < S; ++c)
+               v[c] = src[c][i];
+
+            MT r[Rows];
+            for (Offset row = 0; row < Rows; ++row) {
+               MT accum {};
+               if constexpr (Point)
+                  accum = k[S][row];
+               for (Offset c = 0; c < S; ++c)
+                  accum += k[c][row] * v[c];
+               r[row] = accum;
+            }
+
+            if constexpr (MODE == TransformMode::Project) {
+               const MT w = MT {1} / r[Rows - 1];
+               for (Offset c = 0; c < S; ++c)
+                  dst[c][i] = r[c] * w;
+            }
+            else if constexpr (MODE == TransformMode::Affine and Rows < S) {
+               for (Offset c = 0; c < Rows; ++c)
+                  dst[c][i] = r[c];
+               dst[S - 1][i] = v[S - 1];
+            }
+            else {
+               for (Offset c = 0; c < S; ++c)
+                  dst[c][i] = r[c];
+            }
+         }
+      }
+
+      /// Transform a container of vectors by a matrix                        
+      ///   @tparam MODE - the transformation mode                            
+      ///   @param m - the matrix                                             
+      ///   @param in - the vectors to transform                              
+      ///   @return the transformed vectors                                   
+      template<TransformMode MODE, TARGS(M), Count S>
+      auto Transform(const TMAT(M)& m, const TMany<TVector<MT, S>>& in)
+      -> TMany<TVector<MT, S>> {
+         TMany<TVector<MT, S>> result;
+         if (in.GetCount()) {
+            result.template Reserve<true>(in.GetCount());
+            Transform<MODE>(m, in.GetRaw(), result.GetRaw(), in.GetCount());
+         }
+         return result;
+      }
+
+   } // namespace Langulus::Math::Inner
+
+
+   /// Transform an array of vectors by a matrix                              
+   ///   @param m - the matrix                                                
+   ///   @param in - the vectors to transform                                 
+   ///   @param out - [out] the transformed vectors (can be same as in)       
+   ///   @param count - number of vectors to transform                        
+   template<TARGS(M), Count S> LANGULUS(INLINED)
+   void Transform(
+      const TMAT(M)& m, const TVector<MT, S>* in, TVector<MT, S>* out, Count count
+   ) noexcept {
+      Inner::Transform<Inner::TransformMode::Full>(m, in, out, count);
+   }
+
+   /// Transform a container of vectors by a matrix                           
+   ///   @param m - the matrix                                                
+   ///   @param in - the vectors to transform                                 
+   ///   @return the transformed vectors                                      
+   template<TARGS(M), Count S> LANGULUS(INLINED)
+   auto Transform(const TMAT(M)& m, const TMany<TVector<MT, S>>& in)
+   -> TMany<TVector<MT, S>> {
+      return Inner::Transform<Inner::TransformMode::Full>(m, in);
+   }
+
+   /// Transform a stream of vectors by a matrix                              
+   ///   @param m - the matrix                                                
+   ///   @param in - the vectors to transform                                 
+   ///   @return the transformed vectors                                      
+   template<TARGS(M), Count S> LANGULUS(INLINED)
+   auto Transform(const TMAT(M)& m, const TVectorStream<MT, S>& in)
+   -> TVectorStream<MT, S> {
+      TVectorStream<MT, S> result;
+      Inner::Transform<Inner::TransformMode::Full>(m, in, result);
+      return result;
+   }
+
+   /// Transform an array of vectors by an affine matrix                      
+   ///   @param m - the matrix, last row is ignored                           
+   ///   @param in - the vectors to transform                                 
+   ///   @param out - [out] the transformed vectors (can be same as in)       
+   ///   @param count - number of vectors to transform                        
+   template<TARGS(M), Count S> LANGULUS(INLINED)
+   void TransformAffine(
+      const TMAT(M)& m, const TVector<MT, S>* in, TVector<MT, S>* out, Count count
+   ) noexcept {
+      Inner::Transform<Inner::TransformMode::Affine>(m, in, out, count);
+   }
+
+   /// Transform a container of vectors by an affine matrix                   
+   ///   @param m - the matrix, last row is ignored                           
+   ///   @param in - the vectors to transform                                 
+   ///   @return the transformed vectors                                      
+   template<TARGS(M), Count S> LANGULUS(INLINED)
+   auto TransformAffine(const TMAT(M)& m, const TMany<TVector<MT, S>>& in)
+   -> TMany<TVector<MT, S>> {
+      return Inner::Transform<Inner::TransformMode::Affine>(m, in);
+   }
+
+   /// Transform a stream of vectors by an affine matrix                      
+   ///   @param m - the matrix, last row is ignored                           
+   ///   @param in - the vectors to transform                                 
+   ///   @return the transformed vectors                                      
+   template<TARGS(M), Count S> LANGULUS(INLINED)
+   auto TransformAffine(const TMAT(M)& m, const TVectorStream<MT, S>& in)
+   -> TVectorStream<MT, S> {
+      TVectorStream<MT, S> result;
+      Inner::Transform<Inner::TransformMode::Affine>(m, in, result);
+      return result;
+   }
+
+   /// Transform an array of vectors by a projection, with perspective divide 
+   ///   @param m - the matrix                                                
+   ///   @param in - the vectors to transform                                 
+   ///   @param out - [out] the transformed vectors (can be same as in)       
+   ///   @param count - number of vectors to transform                        
+   template<TARGS(M), Count S> LANGULUS(INLINED)
+   void TransformProject(
+      const TMAT(M)& m, const TVector<MT, S>* in, TVector<MT, S>* out, Count count
+   ) noexcept {
+      Inner::Transform<Inner::TransformMode::Project>(m, in, out, count);
+   }
+
+   /// Transform a container of vectors by a projection, with perspective     
+   /// divide                                                                 
+   ///   @param m - the matrix                                                
+   ///   @param in - the vectors to transform                                 
+   ///   @return the transformed vectors                                      
+   template<TARGS(M), Count S> LANGULUS(INLINED)
+   auto TransformProject(const TMAT(M)& m, const TMany<TVector<MT, S>>& in)
+   -> TMany<TVector<MT, S>> {
+      return Inner::Transform<Inner::TransformMode::Project>(m, in);
+   }
+
+   /// Transform a stream of vectors by a projection, with perspective divide 
+   ///   @param m - the matrix                                                
+   ///   @param in - the vectors to transform                                 
+   ///   @return the transformed vectors                                      
+   template<TARGS(M), Count S> LANGULUS(INLINED)
+   auto TransformProject(const TMAT(M)& m, const TVectorStream<MT, S>& in)
+   -> TVectorStream<MT, S> {
+      TVectorStream<MT, S> result;
+      Inner::Transform<Inner::TransformMode::Project>(m, in, result);
+      return result;
+   }
+
+   /// Multiply an array of matrices by a single matrix on the right          
+   ///   @param lhs - the matrices to multiply                                
+   ///   @param rhs - the shared matrix (i.e. view-projection)                
+   ///   @param out - [out] the products lhs[i] * rhs (can be same as lhs)    
+   ///   @param count - number of matrices to multiply                        
+   template<TARGS(M)> LANGULUS(INLINED)
+   void Multiply(
+      const TMAT(M)* lhs, const TMAT(M)& rhs, TMAT(M)* out, Count count
+   ) noexcept {
+      // Copy the shared matrix, so that it can't alias the output      
+      const TMAT(M) shared = rhs;
+      for (Offset i = 0; i < count; ++i)
+         out[i] = Inner::MultiplyColumns(lhs[i], shared);
+   }
+
+   /// Multiply a single matrix by an array of matrices on the right          
+   ///   @param lhs - the shared matrix                                       
+   ///   @param rhs - the matrices to multiply                                
+   ///   @param out - [out] the products lhs * rhs[i] (can be same as rhs)    
+   ///   @param count - number of matrices to multiply                        
+   template<TARGS(M)> LANGULUS(INLINED)
+   void Multiply(
+      const TMAT(M)& lhs, const TMAT(M)* rhs, TMAT(M)* out, Count count
+   ) noexcept {
+      const TMAT(M) shared = lhs;
+      for (Offset i = 0; i < count; ++i)
+         out[i] = Inner::MultiplyColumns(shared, rhs[i]);
+   }
+
+   /// Multiply a container of matrices by a single matrix on the right       
+   ///   @param lhs - the matrices to multiply                                
+   ///   @param rhs - the shared matrix                                       
+   ///   @return the products                                                 
+   template<TARGS(M)>
+   auto Multiply(const TMany<TMAT(M)>& lhs, const TMAT(M)& rhs) -> TMany<TMAT(M)> {
+      TMany<TMAT(M)> result;
+      if (lhs.GetCount()) {
+         result.template Reserve<true>(lhs.GetCount());
+         Multiply(lhs.GetRaw(), rhs, result.GetRaw(), lhs.GetCount());
+      }
+      return result;
+   }
+
+   /// Multiply a single matrix by a container of matrices on the right       
+   ///   @param lhs - the shared matrix                                       
+   ///   @param rhs - the matrices to multiply                                
+   ///   @return the products                                                 
+   template<TARGS(M)>
+   auto Multiply(const TMAT(M)& lhs, const TMany<TMAT(M)>& rhs) -> TMany<TMAT(M)> {
+      TMany<TMAT(M)> result;
+      if (rhs.GetCount()) {
+         result.template Reserve<true>(rhs.GetCount());
+         Multiply(lhs, rhs.GetRaw(), result.GetRaw(), rhs.GetCount());
+      }
+      return result;
+   }
+
+} // namespace Langulus::Math
+
+#undef TARGS
+#undef TMAT
\ No newline at end of file
@@ -41,6 +41,15 @@ namespace Langulus
       using Mat3u = TMatrix<unsigned, 3>;
       using Mat4u = TMatrix<unsigned, 4>;
 
+      /// Compact affine transformations - the last row of these is always    
+      /// (0, 0, 0, 1), so it is implied instead of stored                    
+      template<CT::ScalarBased T>
+      using TAffine = TMatrix<T, 4, 3>;
+
+      using Mat4x3  = TAffine<Real>;
+      using Mat4x3f = TAffine<Float>;
+      using Mat4x3d = TAffine<Double>;
+
       using Matrix = Mat4;
       using Mat = Matrix;
 
@@ -64,6 +73,10 @@ namespace Langulus
          From(const Math::TQuaternion<TypeOf<V>>&, const V& = 0, const V& = 1) noexcept
          -> Math::TMatrix<TypeOf<V>, V::MemberCount + 1>;
 
+         template<CT::VectorBased V> NOD() static constexpr auto
+         FromAffine(const Math::TQuaternion<TypeOf<V>>&, const V& = 0, const V& = 1) noexcept
+         -> Math::TMatrix<TypeOf<V>, V::MemberCount + 1, V::MemberCount>;
+
          NOD() static constexpr auto
          PerspectiveFOV(const CT::Angle auto&, CT::ScalarBased auto, CT::ScalarBased auto, CT::ScalarBased auto);
 
@@ -74,6 +87,10 @@ namespace Langulus
          template<CT::ScalarBased T> NOD() static constexpr auto
          Orthographic(const T&, const T&, const T&, const T&)
          -> Math::TMatrix<T, 4>;
+
+      protected:
+         template<class M, CT::VectorBased V> NOD() static constexpr auto
+         Compose(const Math::TQuaternion<TypeOf<V>>&, const V&, const V&) noexcept -> M;
       };
 
       /// Used as an imposed base for any type that can be interpretable as a 
@@ -305,6 +322,15 @@ namespace Langulus
          NOD() constexpr auto Determinant(int) const noexcept -> T;
          NOD() constexpr auto Adjoint() const noexcept -> TMatrix;
          NOD() auto Invert() const -> TMatrix;
+         NOD() auto InvertAffine() const -> TMatrix;
+         NOD() auto InvertRigid() const -> TMatrix;
+
+         NOD() constexpr auto TransformPoint(const TVector<T, COLUMNS - 1>&) const noexcept
+         -> TVector<T, COLUMNS - 1> requires (COLUMNS > 2 and (ROWS == COLUMNS or ROWS + 1 == COLUMNS));
+         NOD() constexpr auto TransformDirection(const TVector<T, COLUMNS - 1>&) const noexcept
+         -> TVector<T, COLUMNS - 1> requires (COLUMNS > 2 and (ROWS == COLUMNS or ROWS + 1 == COLUMNS));
+         NOD() constexpr auto TransformNormal(const TVector<T, 3>&) const noexcept
+         -> TVector<T, 3> requires (COLUMNS == 4 and (ROWS == 4 or ROWS == 3));
 
          ///                                                                  
          ///   Iteration                                                      
@@ -319,6 +345,8 @@ namespace Langulus
       private:
          template<Count SIZE, Count NEXT_SIZE = SIZE - 1>
          constexpr static T InnerDeterminant(const T(&a)[SIZE * SIZE]) noexcept;
+         template<class PART>
+         NOD() auto InvertTranslation(const PART&) const noexcept -> TMatrix;
       };
       #pragma pack(pop)
 
@@ -334,6 +362,18 @@ namespace Langulus
       >;
 
 
+      namespace Inner
+      {
+
+         template<CT::ScalarBased T, Count C, Count R>
+         NOD() constexpr auto MultiplyColumns(const TMatrix<T, C, R>&, const TMatrix<T, C, R>&) noexcept
+         -> TMatrix<T, C, R>;
+
+         NOD() constexpr auto MultiplyGeneric(const CT::MatrixBased auto&, const CT::MatrixBased auto&) noexcept;
+
+      } // namespace Langulus::Math::Inner
+
+
       ///                                                                     
       ///   Operations                                                        
       ///                                                                     
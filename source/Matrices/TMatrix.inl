@@ -619,7 +619,39 @@ namespace Langulus::Math
    TEMPLATE() LANGULUS(INLINED)
    constexpr T TME()::Determinant() const noexcept {
       static_assert(IsSquare, "Can't get determinant of a non-square matrix");
-      return InnerDeterminant<Columns>(mArray);
+      // Determinant of the transpose is the same, so columns are used  
+      // as rows below, which saves us from gathering                   
+      const auto& a = mColumns;
+
+      if constexpr (Columns == 1)
+         return a[0][0];
+      else if constexpr (Columns == 2)
+         return a[0][0] * a[1][1] - a[1][0] * a[0][1];
+      else if constexpr (Columns == 3) {
+         return a[0][0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1])
+              - a[0][1] * (a[1][0] * a[2][2] - a[1][2] * a[2][0])
+              + a[0][2] * (a[1][0] * a[2][1] - a[1][1] * a[2][0]);
+      }
+      else if constexpr (Columns == 4) {
+         // Laplace expansion over the 2x2 minors of the first two and  
+         // the last two rows - a handful of products, no recursion     
+         const T s0 = a[0][0] * a[1][1] - a[1][0] * a[0][1];
+         const T s1 = a[0][0] * a[1][2] - a[1][0] * a[0][2];
+         const T s2 = a[0][0] * a[1][3] - a[1][0] * a[0][3];
+         const T s3 = a[0][1] * a[1][2] - a[1][1] * a[0][2];
+         const T s4 = a[0][1] * a[1][3] - a[1][1] * a[0][3];
+         const T s5 = a[0][2] * a[1][3] - a[1][2] * a[0][3];
+
+         const T c5 = a[2][2] * a[3][3] - a[3][2] * a[2][3];
+         const T c4 = a[2][1] * a[3][3] - a[3][1] * a[2][3];
+         const T c3 = a[2][1] * a[3][2] - a[3][1] * a[2][2];
+         const T c2 = a[2][0] * a[3][3] - a[3][0] * a[2][3];
+         const T c1 = a[2][0] * a[3][2] - a[3][0] * a[2][2];
+         const T c0 = a[2][0] * a[3][1] - a[3][0] * a[2][1];
+
+         return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+      }
+      else return InnerDeterminant<Columns>(mArray);
    }
 
    /// Transpose the matrix                                                   
@@ -666,7 +698,7 @@ namespace Langulus::Math
    ///   @return the determinant                                              
    TEMPLATE()
    constexpr auto TME()::Determinant(int n) const noexcept -> T {
-      float D = 0;
+      T D = 0;
 
       // Base case : if matrix contains single element                  
       if (n == 1)
@@ -691,7 +723,7 @@ namespace Langulus::Math
    TEMPLATE()
    constexpr auto TME()::Adjoint() const noexcept -> TMatrix {
       static_assert(IsSquare, "Can't adjoint non-square matrix");
-      float sign = 1;
+      T sign = 1;
       TME() temp, adj;
       for (int i = 0; i < Rows; i++) {
          for (int j = 0; j < Rows; j++) {
@@ -759,47 +791,166 @@ namespace Langulus::Math
          };
       }
       else if constexpr (Columns == 4) {
-         auto n11 = mArray[0], n21 = mArray[1], n31 = mArray[2], n41 = mArray[3];
-         auto n12 = mArray[4], n22 = mArray[5], n32 = mArray[6], n42 = mArray[7];
-         auto n13 = mArray[8], n23 = mArray[9], n33 = mArray[10], n43 = mArray[11];
-         auto n14 = mArray[12], n24 = mArray[13], n34 = mArray[14], n44 = mArray[15];
-
-         auto t11 = n23 * n34 * n42 - n24 * n33 * n42 + n24 * n32 * n43 - n22 * n34 * n43 - n23 * n32 * n44 + n22 * n33 * n44;
-         auto t12 = n14 * n33 * n42 - n13 * n34 * n42 - n14 * n32 * n43 + n12 * n34 * n43 + n13 * n32 * n44 - n12 * n33 * n44;
-         auto t13 = n13 * n24 * n42 - n14 * n23 * n42 + n14 * n22 * n43 - n12 * n24 * n43 - n13 * n22 * n44 + n12 * n23 * n44;
-         auto t14 = n14 * n23 * n32 - n13 * n24 * n32 - n14 * n22 * n33 + n12 * n24 * n33 + n13 * n22 * n34 - n12 * n23 * n34;
+         // Vectorized cofactor expansion - all 2x2 minors are computed 
+         // four at a time, from shuffled columns, and the adjugate is  
+         // assembled column by column, without any scalar cofactors    
+         using V = TVector<T, 4>;
+         const auto& m = mColumns;
+         const auto minors = [&m](Offset r1, Offset r2) noexcept -> V {
+            return V {m[2][r1], m[2][r1], m[1][r1], m[1][r1]}
+                 * V {m[3][r2], m[3][r2], m[3][r2], m[2][r2]}
+                 - V {m[3][r1], m[3][r1], m[3][r1], m[2][r1]}
+                 * V {m[2][r2], m[2][r2], m[1][r2], m[1][r2]};
+         };
 
-         const auto det = n11 * t11 + n21 * t12 + n31 * t13 + n41 * t14;
+         const V fac0 = minors(2, 3);
+         const V fac1 = minors(1, 3);
+         const V fac2 = minors(1, 2);
+         const V fac3 = minors(0, 3);
+         const V fac4 = minors(0, 2);
+         const V fac5 = minors(0, 1);
+
+         const V vec0 {m[1][0], m[0][0], m[0][0], m[0][0]};
+         const V vec1 {m[1][1], m[0][1], m[0][1], m[0][1]};
+         const V vec2 {m[1][2], m[0][2], m[0][2], m[0][2]};
+         const V vec3 {m[1][3], m[0][3], m[0][3], m[0][3]};
+
+         const V signA {1, -1, 1, -1};
+         const V signB {-1, 1, -1, 1};
+         const V inv0 = (vec1 * fac0 - vec2 * fac1 + vec3 * fac2) * signA;
+         const V inv1 = (vec0 * fac0 - vec2 * fac3 + vec3 * fac4) * signB;
+         const V inv2 = (vec0 * fac1 - vec1 * fac3 + vec3 * fac5) * signA;
+         const V inv3 = (vec0 * fac2 - vec1 * fac4 + vec2 * fac5) * signB;
+
+         // First column dotted with the first row of the adjugate      
+         const T det = m[0][0] * inv0[0] + m[0][1] * inv1[0]
+                     + m[0][2] * inv2[0] + m[0][3] * inv3[0];
          if (det == 0)
             throw Except::DivisionByZero("Degenerate 4x4 matrix");
 
-         const auto detInv = 1 / det;
-
-         return {
-            t11 * detInv,
-            (n24 * n33 * n41 - n23 * n34 * n41 - n24 * n31 * n43 + n21 * n34 * n43 + n23 * n31 * n44 - n21 * n33 * n44)* detInv,
-            (n22 * n34 * n41 - n24 * n32 * n41 + n24 * n31 * n42 - n21 * n34 * n42 - n22 * n31 * n44 + n21 * n32 * n44)* detInv,
-            (n23 * n32 * n41 - n22 * n33 * n41 - n23 * n31 * n42 + n21 * n33 * n42 + n22 * n31 * n43 - n21 * n32 * n43)* detInv,
-                                                                                                                               
-            t12 * detInv,                                                                                                      
-            (n13 * n34 * n41 - n14 * n33 * n41 + n14 * n31 * n43 - n11 * n34 * n43 - n13 * n31 * n44 + n11 * n33 * n44)* detInv,
-            (n14 * n32 * n41 - n12 * n34 * n41 - n14 * n31 * n42 + n11 * n34 * n42 + n12 * n31 * n44 - n11 * n32 * n44)* detInv,
-            (n12 * n33 * n41 - n13 * n32 * n41 + n13 * n31 * n42 - n11 * n33 * n42 - n12 * n31 * n43 + n11 * n32 * n43)* detInv,
-                                                                                                                               
-            t13 * detInv,                                                                                                     
-            (n14 * n23 * n41 - n13 * n24 * n41 - n14 * n21 * n43 + n11 * n24 * n43 + n13 * n21 * n44 - n11 * n23 * n44)* detInv,
-            (n12 * n24 * n41 - n14 * n22 * n41 + n14 * n21 * n42 - n11 * n24 * n42 - n12 * n21 * n44 + n11 * n22 * n44)* detInv,
-            (n13 * n22 * n41 - n12 * n23 * n41 - n13 * n21 * n42 + n11 * n23 * n42 + n12 * n21 * n43 - n11 * n22 * n43)* detInv,
-                                                                                                                               
-            t14 * detInv,                                                                                                      
-            (n13 * n24 * n31 - n14 * n23 * n31 + n14 * n21 * n33 - n11 * n24 * n33 - n13 * n21 * n34 + n11 * n23 * n34)* detInv,
-            (n14 * n22 * n31 - n12 * n24 * n31 - n14 * n21 * n32 + n11 * n24 * n32 + n12 * n21 * n34 - n11 * n22 * n34)* detInv,
-            (n12 * n23 * n31 - n13 * n22 * n31 + n13 * n21 * n32 - n11 * n23 * n32 - n12 * n21 * n33 + n11 * n22 * n33)* detInv,
-         };
+         const T detInv = T {1} / det;
+         TMatrix result;
+         result.mColumns[0] = inv0 * detInv;
+         result.mColumns[1] = inv1 * detInv;
+         result.mColumns[2] = inv2 * detInv;
+         result.mColumns[3] = inv3 * detInv;
+         return result;
       }
       else static_assert(false, "Matrix inversion code not implemented");
    }
 
+   /// Invert an affine matrix - a matrix whose last row is (0, ..., 0, 1)    
+   /// Only the upper-left part is inverted, and the translation is moved     
+   /// through it, which is much cheaper than a full inversion                
+   /// Also works for compact affine matrices, that don't store a last row    
+   ///   @attention the last row is never checked                             
+   ///   @return the inverted matrix                                          
+   TEMPLATE()
+   auto TME()::InvertAffine() const -> TMatrix {
+      static_assert((IsSquare or Columns == Rows + 1) and Columns > 2,
+         "Affine inversion requires a square or compact affine matrix "
+         "bigger than 2x2");
+      using Part = TMatrix<T, Columns - 1>;
+      return InvertTranslation(Part {*this}.Invert());
+   }
+
+   /// Invert a matrix that contains only rotation, translation and scale     
+   /// The axes are orthogonal, so the upper-left part is inverted by a       
+   /// transposition, where each axis is divided by its squared length to     
+   /// account for scaling. No determinant or cofactors are involved          
+   ///   @attention axes orthogonality and the last row are never checked     
+   ///   @return the inverted matrix                                          
+   TEMPLATE()
+   auto TME()::InvertRigid() const -> TMatrix {
+      static_assert((IsSquare or Columns == Rows + 1) and Columns > 2,
+         "Rigid inversion requires a square or compact affine matrix "
+         "bigger than 2x2");
+      using Part = TMatrix<T, Columns - 1>;
+      Part transposed;
+      for (Offset c = 0; c < Columns - 1; ++c) {
+         T lengthSquared {};
+         for (Offset r = 0; r < Columns - 1; ++r)
+            lengthSquared += mColumns[c][r] * mColumns[c][r];
+         if (lengthSquared == 0)
+            throw Except::DivisionByZero("Degenerate rigid matrix");
+
+         const T scale = T {1} / lengthSquared;
+         for (Offset r = 0; r < Columns - 1; ++r)
+            transposed.mColumns[r][c] = mColumns[c][r] * scale;
+      }
+
+      return InvertTranslation(transposed);
+   }
+
+   /// Assemble an inverted affine matrix from an inverted upper-left part,   
+   /// by moving the negated translation through it                           
+   ///   @param inverse - the inverted upper-left part                        
+   ///   @return the assembled inverse                                        
+   TEMPLATE() template<class PART> LANGULUS(INLINED)
+   auto TME()::InvertTranslation(const PART& inverse) const noexcept -> TMatrix {
+      TMatrix result;
+      const auto& position = mColumns[Columns - 1];
+      TVector<T, Columns - 1> offset;
+      for (Offset c = 0; c < Columns - 1; ++c) {
+         for (Offset r = 0; r < Columns - 1; ++r)
+            result.mColumns[c][r] = inverse.mColumns[c][r];
+         offset -= inverse.mColumns[c] * position[c];
+      }
+
+      for (Offset r = 0; r < Columns - 1; ++r)
+         result.mColumns[Columns - 1][r] = offset[r];
+      return result;
+   }
+
+   /// Transform a point - the translation is applied                         
+   /// Cheaper than multiplying by a vector, since the last row is implied    
+   /// to be (0, ..., 0, 1), and no horizontal sums are involved              
+   ///   @param point - the point to transform                                
+   ///   @return the transformed point                                        
+   TEMPLATE() LANGULUS(INLINED)
+   constexpr auto TME()::TransformPoint(const TVector<T, COLUMNS - 1>& point) const noexcept
+   -> TVector<T, COLUMNS - 1> requires (COLUMNS > 2 and (ROWS == COLUMNS or ROWS + 1 == COLUMNS)) {
+      TVector<T, COLUMNS - 1> result {TransformDirection(point)};
+      for (Offset r = 0; r < Columns - 1; ++r)
+         result[r] += mColumns[Columns - 1][r];
+      return result;
+   }
+
+   /// Transform a direction - the translation is ignored                     
+   ///   @param direction - the direction to transform                        
+   ///   @return the transformed direction                                    
+   TEMPLATE() LANGULUS(INLINED)
+   constexpr auto TME()::TransformDirection(const TVector<T, COLUMNS - 1>& direction) const noexcept
+   -> TVector<T, COLUMNS - 1> requires (COLUMNS > 2 and (ROWS == COLUMNS or ROWS + 1 == COLUMNS)) {
+      TVector<T, COLUMNS - 1> result;
+      for (Offset c = 0; c < Columns - 1; ++c) {
+         for (Offset r = 0; r < Columns - 1; ++r)
+            result[r] += mColumns[c][r] * direction[c];
+      }
+      return result;
+   }
+
+   /// Transform a surface normal by the inverse transpose of the upper-left  
+   /// 3x3 part, so that normals stay perpendicular under non-uniform scale   
+   /// Instead of inverting, the cofactor matrix is used - it differs from    
+   /// the inverse transpose only by the determinant, so the cross products   
+   /// of the axes are enough. Only the sign of the determinant is applied    
+   ///   @attention the result is not normalized                              
+   ///   @param normal - the normal to transform                              
+   ///   @return the transformed normal                                       
+   TEMPLATE() LANGULUS(INLINED)
+   constexpr auto TME()::TransformNormal(const TVector<T, 3>& normal) const noexcept
+   -> TVector<T, 3> requires (COLUMNS == 4 and (ROWS == 4 or ROWS == 3)) {
+      const TVector<T, 3> x {mColumns[0]};
+      const TVector<T, 3> y {mColumns[1]};
+      const TVector<T, 3> z {mColumns[2]};
+      const auto yz = y.Cross(z);
+      const auto zx = z.Cross(x);
+      const auto xy = x.Cross(y);
+      const auto result = yz * normal[0] + zx * normal[1] + xy * normal[2];
+      return x.Dot(yz) < T {0} ? -result : result;
+   }
+
    
    ///                                                                        
    ///   Iteration                                                            
@@ -924,6 +1075,43 @@ namespace Langulus::A
 namespace Langulus::Math
 {
 
+   /// Multiply two matrices of the same type                                 
+   /// Each column of the product is accumulated by broadcasting a single     
+   /// element of rhs over a whole column of lhs (multiply-add per column),   
+   /// so no horizontal operations, nor nulling of the result are involved    
+   /// Works for square matrices, as well as for affine matrices with one     
+   /// row less than columns (i.e. 4x3), whose last row is implicitly         
+   /// (0, ..., 0, 1)                                                         
+   ///   @param lhs - left matrix                                             
+   ///   @param rhs - right matrix                                            
+   ///   @return the product                                                  
+   template<CT::ScalarBased T, Count C, Count R> LANGULUS(INLINED)
+   constexpr auto Inner::MultiplyColumns(
+      const TMatrix<T, C, R>& lhs,
+      const TMatrix<T, C, R>& rhs
+   ) noexcept -> TMatrix<T, C, R> {
+      static_assert(C == R or C == R + 1,
+         "Only square and affine matrices can be multiplied this way");
+
+      TMatrix<T, C, R> result;
+      for (Offset c = 0; c < C; ++c) {
+         const auto& rc = rhs.mColumns[c];
+         auto column = lhs.mColumns[0] * rc[0];
+         for (Offset k = 1; k < R; ++k)
+            column += lhs.mColumns[k] * rc[k];
+
+         // The implicit last row of an affine rhs is (0, ..., 0, 1),   
+         // so the translation of lhs is added only to the last column  
+         if constexpr (C == R + 1) {
+            if (c == C - 1)
+               column += lhs.mColumns[C - 1];
+         }
+
+         result.mColumns[c] = column;
+      }
+      return result;
+   }
+
    /// Multiply matrices                                                      
    ///   @param lhs - left matrix                                             
    ///   @param rhs - right matrix                                            
@@ -935,8 +1123,32 @@ namespace Langulus::Math
    ) noexcept {
       using LHS = Deref<decltype(lhs)>;
       using RHS = Deref<decltype(rhs)>;
-      static_assert(LHS::Rows == RHS::Columns and LHS::Columns == RHS::Rows,
-         "Can't multiply these matrices - their sizes aren't compatible");
+
+      // Specialized kernel for the most common cases - 3x3 and 4x4,    
+      // as well as 4x3 affine matrices, that have an implicit last row 
+      constexpr bool Specialized = CT::Same<LHS, RHS>
+         and ((LHS::IsSquare and (LHS::Columns == 3 or LHS::Columns == 4))
+           or (LHS::Columns == 4 and LHS::Rows == 3));
+      if constexpr (Specialized)
+         return Inner::MultiplyColumns(lhs, rhs);
+      else {
+         static_assert(LHS::Rows == RHS::Columns and LHS::Columns == RHS::Rows,
+            "Can't multiply these matrices - their sizes aren't compatible");
+         return Inner::MultiplyGeneric(lhs, rhs);
+      }
+   }
+
+   /// Multiply matrices of any compatible size and type                      
+   ///   @param lhs - left matrix                                             
+   ///   @param rhs - right matrix                                            
+   ///   @return the product                                                  
+   LANGULUS(INLINED)
+   constexpr auto Inner::MultiplyGeneric(
+      const CT::MatrixBased auto& lhs,
+      const CT::MatrixBased auto& rhs
+   ) noexcept {
+      using LHS = Deref<decltype(lhs)>;
+      using RHS = Deref<decltype(rhs)>;
       using Ret = LosslessMatrix<LHS, RHS>;
 
       Ret r = Ret::Null();
@@ -0,0 +1,137 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "TTriangle.hpp"
+#include "TSphere.hpp"
+#include "TBox.hpp"
+#include "../Vectors/TVectorStream.hpp"
+
+
+namespace Langulus::Math
+{
+
+   /// Available ray-triangle tests                                           
+   enum class TriangleTest {
+      // Fastest, but may miss rays along edges shared by triangles     
+      MollerTrumbore,
+      // Never misses along shared edges and vertices                   
+      Watertight
+   };
+
+
+   ///                                                                        
+   ///   Triangles in structure-of-arrays layout                              
+   ///                                                                        
+   /// Used for testing rays against large amounts of triangles, so that      
+   /// each point component of many triangles can be loaded at once           
+   ///                                                                        
+   template<CT::Real T>
+   struct TTriangleStream {
+      using ScalarType   = T;
+      using PointType    = TVector<T, 3>;
+      using TriangleType = TTriangle<PointType>;
+      using StreamType   = TVectorStream<T, 3>;
+
+      StreamType mA;
+      StreamType mB;
+      StreamType mC;
+
+   public:
+      TTriangleStream() = default;
+      explicit TTriangleStream(Count);
+      TTriangleStream(const TriangleType*, Count);
+      TTriangleStream(const TMany<TriangleType>&);
+
+      void Push(const TriangleType&);
+      void Resize(Count);
+      NOD() Count GetCount() const noexcept;
+      NOD() auto Get(Offset) const noexcept -> TriangleType;
+   };
+
+
+   ///                                                                        
+   ///   A packet of rays in structure-of-arrays layout                       
+   ///                                                                        
+   /// Tested against many triangles at once, each triangle against all rays  
+   /// in the packet. Also holds the closest hit of each ray, which is        
+   /// updated by every test, so packets can be tested against several        
+   /// streams in a row. Normals aren't computed for packets - use the hit    
+   /// triangle indices instead                                               
+   ///                                                                        
+   template<CT::Real T, Count N>
+   struct TRayPacket {
+      using ScalarType = T;
+      using PointType  = TVector<T, 3>;
+      using RayType    = TRay<PointType>;
+      using HitType    = TRayHit<PointType>;
+      static constexpr Count Size = N;
+
+      alignas(64) T mOrigin[3][N];
+      alignas(64) T mDirection[3][N];
+      // Closest hit distance, rays never hit further than their initial
+      // distance, which is infinity by default                         
+      alignas(64) T mDistance[N];
+      // Barycentric coordinates of second and third point of the hit   
+      alignas(64) T mU[N];
+      alignas(64) T mV[N];
+      // Index of the hit triangle                                      
+      Offset mIndex[N];
+
+   public:
+      TRayPacket() noexcept;
+
+      void Set(Offset, const RayType&, T = ::std::numeric_limits<T>::infinity()) noexcept;
+      NOD() auto GetRay(Offset) const noexcept -> RayType;
+      NOD() auto GetHit(Offset) const noexcept -> HitType;
+   };
+
+   template<CT::Real T>
+   using TRayPacket4 = TRayPacket<T, 4>;
+   template<CT::Real T>
+   using TRayPacket8 = TRayPacket<T, 8>;
+   template<CT::Real T>
+   using TRayPacket16 = TRayPacket<T, 16>;
+
+
+   ///                                                                        
+   ///   Batched ray-triangle intersections                                   
+   ///                                                                        
+   /// Single rays are tested against a block of triangles at a time, while   
+   /// packets test every triangle against all rays. Both are written as      
+   /// fixed-size branchless loops, that compilers vectorize. Both sides of   
+   /// the triangles are hit. Results match the TTriangle::Intersect and      
+   /// TTriangle::IntersectWatertight tests                                   
+   ///                                                                        
+   template<TriangleTest = TriangleTest::MollerTrumbore, CT::Real T> NOD()
+   auto Intersect(const TRay<TVector<T, 3>>&, const TTriangleStream<T>&) noexcept -> TRayHit<TVector<T, 3>>;
+
+   template<TriangleTest = TriangleTest::MollerTrumbore, CT::Real T, Count N>
+   void Intersect(TRayPacket<T, N>&, const TTriangleStream<T>&) noexcept;
+
+
+   ///                                                                        
+   ///   Batched ray-primitive intersections                                  
+   ///                                                                        
+   /// Test one ray against an array of primitives of the same kind, each     
+   /// placed at its own position, using the primitive's Intersect            
+   ///                                                                        
+   template<class P> NOD()
+   auto Intersect(const TRay<typename P::PointType>&, const typename P::PointType*, const P*, Count) noexcept
+   -> TRayHit<typename P::PointType>;
+
+   /// Spheres and axis-aligned boxes in structure-of-arrays layout are       
+   /// tested a block at a time, in branchless loops                          
+   template<CT::Real T> NOD()
+   auto IntersectSpheres(const TRay<TVector<T, 3>>&, const TVectorStream<T, 3>&, const TVectorStream<T, 1>&) noexcept
+   -> TRayHit<TVector<T, 3>>;
+
+   template<CT::Real T> NOD()
+   auto IntersectBoxes(const TRay<TVector<T, 3>>&, const TVectorStream<T, 3>&, const TVectorStream<T, 3>&) noexcept
+   -> TRayHit<TVector<T, 3>>;
+
+} // namespace Langulus::Math
\ No newline at end of file
@@ -0,0 +1,419 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Batch.hpp"
+#include "TBox.inl"
+#include "../Vectors/TVectorStream.inl"
+
+
+namespace Langulus::Math
+{
+
+   ///                                                                        
+   ///   Triangle stream                                                      
+   ///                                                                        
+   /// Create a stream of zeroed (degenerate) triangles                       
+   ///   @param count - number of triangles                                   
+   template<CT::Real T> LANGULUS(INLINED)
+   TTriangleStream<T>::TTriangleStream(Count count)
+      : mA {count}
+      , mB {count}
+      , mC {count} {}
+
+   /// Create a stream from an array of triangles                             
+   ///   @param triangles - the triangles                                     
+   ///   @param count - number of triangles                                   
+   template<CT::Real T>
+   TTriangleStream<T>::TTriangleStream(const TriangleType* triangles, Count count)
+      : TTriangleStream {count} {
+      for (Offset i = 0; i < count; ++i) {
+         mA.Set(i, triangles[i].mABC[0]);
+         mB.Set(i, triangles[i].mABC[1]);
+         mC.Set(i, triangles[i].mABC[2]);
+      }
+   }
+
+   /// Create a stream from a container of triangles                          
+   ///   @param triangles - the triangles                                     
+   template<CT::Real T> LANGULUS(INLINED)
+   TTriangleStream<T>::TTriangleStream(const TMany<TriangleType>& triangles)
+      : TTriangleStream {triangles.GetRaw(), triangles.GetCount()} {}
+
+   /// Append a triangle                                                      
+   template<CT::Real T> LANGULUS(INLINED)
+   void TTriangleStream<T>::Push(const TriangleType& triangle) {
+      mA.Push(triangle.mABC[0]);
+      mB.Push(triangle.mABC[1]);
+      mC.Push(triangle.mABC[2]);
+   }
+
+   /// Change the number of triangles, new ones are zeroed                    
+   template<CT::Real T> LANGULUS(INLINED)
+   void TTriangleStream<T>::Resize(Count count) {
+      mA.Resize(count);
+      mB.Resize(count);
+      mC.Resize(count);
+   }
+
+   /// Get the number of triangles                                            
+   template<CT::Real T> LANGULUS(INLINED)
+   Count TTriangleStream<T>::GetCount() const noexcept {
+      return mA.GetCount();
+   }
+
+   /// Gather a single triangle                                               
+   template<CT::Real T> LANGULUS(INLINED)
+   auto TTriangleStream<T>::Get(Offset index) const noexcept -> TriangleType {
+      return {mA.Get(index), mB.Get(index), mC.Get(index)};
+   }
+
+
+   ///                                                                        
+   ///   Ray packet                                                           
+   ///                                                                        
+   /// Create a packet of degenerate rays, that never hit anything            
+   template<CT::Real T, Count N> LANGULUS(INLINED)
+   TRayPacket<T, N>::TRayPacket() noexcept {
+      for (Offset j = 0; j < N; ++j) {
+         for (Offset c = 0; c < 3; ++c) {
+            mOrigin[c][j] = 0;
+            mDirection[c][j] = 0;
+         }
+         mDistance[j] = ::std::numeric_limits<T>::infinity();
+         mU[j] = mV[j] = 0;
+         mIndex[j] = 0;
+      }
+   }
+
+   /// Set a ray in the packet, and reset its hit                             
+   ///   @param lane - the ray index in the packet                            
+   ///   @param ray - the ray                                                 
+   ///   @param maxDistance - the ray never hits further than this            
+   template<CT::Real T, Count N> LANGULUS(INLINED)
+   void TRayPacket<T, N>::Set(Offset lane, const RayType& ray, T maxDistance) noexcept {
+      for (Offset c = 0; c < 3; ++c) {
+         mOrigin[c][lane] = ray.mOrigin[c];
+         mDirection[c][lane] = ray.mNormal[c];
+      }
+      mDistance[lane] = maxDistance;
+      mU[lane] = mV[lane] = 0;
+      mIndex[lane] = 0;
+   }
+
+   /// Gather a ray from the packet                                           
+   template<CT::Real T, Count N> LANGULUS(INLINED)
+   auto TRayPacket<T, N>::GetRay(Offset lane) const noexcept -> RayType {
+      return {
+         PointType {mOrigin[0][lane], mOrigin[1][lane], mOrigin[2][lane]},
+         PointType {mDirection[0][lane], mDirection[1][lane], mDirection[2][lane]}
+      };
+   }
+
+   /// Gather the closest hit of a ray in the packet, without a normal        
+   template<CT::Real T, Count N> LANGULUS(INLINED)
+   auto TRayPacket<T, N>::GetHit(Offset lane) const noexcept -> HitType {
+      HitType hit;
+      hit.mDistance = mDistance[lane];
+      hit.mU = mU[lane];
+      hit.mV = mV[lane];
+      hit.mIndex = mIndex[lane];
+      return hit;
+   }
+
+
+   ///                                                                        
+   ///   Intersections                                                        
+   ///                                                                        
+   /// Find the closest triangle, hit by a ray                                
+   ///   @tparam TEST - the ray-triangle test to use                          
+   ///   @param ray - the ray                                                 
+   ///   @param triangles - the triangles                                     
+   ///   @return the closest hit, with the index of the hit triangle          
+   template<TriangleTest TEST, CT::Real T>
+   auto Intersect(const TRay<TVector<T, 3>>& ray, const TTriangleStream<T>& triangles) noexcept
+   -> TRayHit<TVector<T, 3>> {
+      constexpr Count Block = TTriangleStream<T>::StreamType::Block;
+      const Count count = triangles.GetCount();
+      TRayHit<TVector<T, 3>> result;
+
+      const T o[3] {ray.mOrigin[0], ray.mOrigin[1], ray.mOrigin[2]};
+      const T d[3] {ray.mNormal[0], ray.mNormal[1], ray.mNormal[2]};
+      Inner::WatertightRay<T> setup;
+      if constexpr (TEST == TriangleTest::Watertight)
+         setup = Inner::WatertightRay<T>(d);
+
+      const T* a[3];
+      const T* b[3];
+      const T* c[3];
+      for (Offset k = 0; k < 3; ++k) {
+         a[k] = triangles.mA.GetLane(k);
+         b[k] = triangles.mB.GetLane(k);
+         c[k] = triangles.mC.GetLane(k);
+      }
+
+      T best = ::std::numeric_limits<T>::infinity();
+      T bestU {}, bestV {};
+      Offset bestIndex = 0;
+
+      for (Offset start = 0; start < count; start += Block) {
+         // Padding past the count is zeroed, so it never hits          
+         T t[Block], u[Block], v[Block];
+         bool hit[Block];
+         for (Offset j = 0; j < Block; ++j) {
+            const Offset i = start + j;
+            const T A[3] {a[0][i], a[1][i], a[2][i]};
+            const T B[3] {b[0][i], b[1][i], b[2][i]};
+            const T C[3] {c[0][i], c[1][i], c[2][i]};
+            t[j] = 0;
+            if constexpr (TEST == TriangleTest::Watertight)
+               hit[j] = Inner::Watertight(setup, o, A, B, C, t[j], u[j], v[j]);
+            else
+               hit[j] = Inner::MollerTrumbore(o, d, A, B, C, t[j], u[j], v[j]);
+         }
+
+         const Count size = ::std::min(Block, count - start);
+         for (Offset j = 0; j < size; ++j) {
+            if (hit[j] and t[j] < best) {
+               best = t[j];
+               bestU = u[j];
+               bestV = v[j];
+               bestIndex = start + j;
+            }
+         }
+      }
+
+      if (best == ::std::numeric_limits<T>::infinity())
+         return result;
+
+      const auto triangle = triangles.Get(bestIndex);
+      result = Inner::TriangleHit(ray, triangle[0], triangle[1], triangle[2],
+         true, best, bestU, bestV);
+      result.mIndex = bestIndex;
+      return result;
+   }
+
+   /// Test a packet of rays against triangles, updating the closest hits     
+   ///   @tparam TEST - the ray-triangle test to use                          
+   ///   @param packet - [in/out] the rays and their closest hits             
+   ///   @param triangles - the triangles                                     
+   template<TriangleTest TEST, CT::Real T, Count N>
+   void Intersect(TRayPacket<T, N>& packet, const TTriangleStream<T>& triangles) noexcept {
+      const Count count = triangles.GetCount();
+
+      Inner::WatertightRay<T> setup[N];
+      if constexpr (TEST == TriangleTest::Watertight) {
+         for (Offset j = 0; j < N; ++j) {
+            setup[j] = Inner::WatertightRay<T>({
+               packet.mDirection[0][j],
+               packet.mDirection[1][j],
+               packet.mDirection[2][j]
+            });
+         }
+      }
+
+      const T* a[3];
+      const T* b[3];
+      const T* c[3];
+      for (Offset k = 0; k < 3; ++k) {
+         a[k] = triangles.mA.GetLane(k);
+         b[k] = triangles.mB.GetLane(k);
+         c[k] = triangles.mC.GetLane(k);
+      }
+
+      for (Offset i = 0; i < count; ++i) {
+         // Broadcast a triangle against all rays                       
+         const T A[3] {a[0][i], a[1][i], a[2][i]};
+         const T B[3] {b[0][i], b[1][i], b[2][i]};
+         const T C[3] {c[0][i], c[1][i], c[2][i]};
+
+         for (Offset j = 0; j < N; ++j) {
+            const T o[3] {packet.mOrigin[0][j], packet.mOrigin[1][j], packet.mOrigin[2][j]};
+            T t = 0, u = 0, v = 0;
+            bool hit;
+            if constexpr (TEST == TriangleTest::Watertight)
+               hit = Inner::Watertight(setup[j], o, A, B, C, t, u, v);
+            else {
+               const T d[3] {packet.mDirection[0][j], packet.mDirection[1][j], packet.mDirection[2][j]};
+               hit = Inner::MollerTrumbore(o, d, A, B, C, t, u, v);
+            }
+
+            hit = hit & (t < packet.mDistance[j]);
+            packet.mDistance[j] = hit ? t : packet.mDistance[j];
+            packet.mU[j]        = hit ? u : packet.mU[j];
+            packet.mV[j]        = hit ? v : packet.mV[j];
+            packet.mIndex[j]    = hit ? i : packet.mIndex[j];
+         }
+      }
+   }
+
+   /// Find the closest primitive, hit by a ray                               
+   ///   @param ray - the ray                                                 
+   ///   @param positions - the position of each primitive                    
+   ///   @param primitives - the primitives, centered at origin               
+   ///   @param count - number of primitives                                  
+   ///   @return the closest hit, with the index of the hit primitive         
+   template<class P>
+   auto Intersect(
+      const TRay<typename P::PointType>& ray, const typename P::PointType* positions,
+      const P* primitives, Count count
+   ) noexcept -> TRayHit<typename P::PointType> {
+      TRayHit<typename P::PointType> result;
+      for (Offset i = 0; i < count; ++i) {
+         // Move the ray into the primitive's space, instead of moving  
+         // the primitive                                               
+         auto local = ray;
+         local.mOrigin -= positions[i];
+
+         const auto hit = primitives[i].Intersect(local);
+         if (hit.mDistance < result.mDistance) {
+            result = hit;
+            result.mIndex = i;
+         }
+      }
+      return result;
+   }
+
+   /// Find the closest sphere, hit by a ray                                  
+   ///   @param ray - the ray, with a normalized direction                    
+   ///   @param centers - the sphere centers                                  
+   ///   @param radii - the sphere radii                                      
+   ///   @return the closest hit, with the index of the hit sphere            
+   template<CT::Real T>
+   auto IntersectSpheres(
+      const TRay<TVector<T, 3>>& ray,
+      const TVectorStream<T, 3>& centers, const TVectorStream<T, 1>& radii
+   ) noexcept -> TRayHit<TVector<T, 3>> {
+      LANGULUS_ASSUME(UserAssumes, centers.GetCount() == radii.GetCount(),
+         "Sphere stream size mismatch");
+      constexpr Count Block = TVectorStream<T, 3>::Block;
+      const Count count = centers.GetCount();
+      TRayHit<TVector<T, 3>> result;
+
+      const T* c[3] {centers.GetLane(0), centers.GetLane(1), centers.GetLane(2)};
+      const T* r = radii.GetLane(0);
+      T best = ::std::numeric_limits<T>::infinity();
+      Offset bestIndex = 0;
+
+      for (Offset start = 0; start < count; start += Block) {
+         T t[Block];
+         bool hit[Block];
+         for (Offset j = 0; j < Block; ++j) {
+            const Offset i = start + j;
+            T b = 0, oc2 = 0;
+            for (Offset k = 0; k < 3; ++k) {
+               const T oc = ray.mOrigin[k] - c[k][i];
+               b   += oc * ray.mNormal[k];
+               oc2 += oc * oc;
+            }
+
+            const T h = b * b - oc2 + r[i] * r[i];
+            const T sh = ::std::sqrt(h < 0 ? T {0} : h);
+            t[j] = -b - sh >= 0 ? -b - sh : -b + sh;
+            hit[j] = h >= 0 and t[j] >= 0;
+         }
+
+         // Zeroed padding past the count is a point, that can be hit   
+         const Count size = ::std::min(Block, count - start);
+         for (Offset j = 0; j < size; ++j) {
+            if (hit[j] and t[j] < best) {
+               best = t[j];
+               bestIndex = start + j;
+            }
+         }
+      }
+
+      if (best == ::std::numeric_limits<T>::infinity())
+         return result;
+
+      result.mDistance = best;
+      result.mNormal = (ray.Point(best) - centers.Get(bestIndex)) / radii.Get(bestIndex)[0];
+      result.mIndex = bestIndex;
+      return result;
+   }
+
+   /// Find the closest axis-aligned box, hit by a ray                        
+   ///   @param ray - the ray, with a normalized direction                    
+   ///   @param min - the minimum corners of the boxes                        
+   ///   @param max - the maximum corners of the boxes                        
+   ///   @return the closest hit, with the index of the hit box               
+   template<CT::Real T>
+   auto IntersectBoxes(
+      const TRay<TVector<T, 3>>& ray,
+      const TVectorStream<T, 3>& min, const TVectorStream<T, 3>& max
+   ) noexcept -> TRayHit<TVector<T, 3>> {
+      LANGULUS_ASSUME(UserAssumes, min.GetCount() == max.GetCount(),
+         "AABB stream size mismatch");
+      constexpr Count Block = TVectorStream<T, 3>::Block;
+      constexpr T Infinity = ::std::numeric_limits<T>::infinity();
+      const Count count = min.GetCount();
+      TRayHit<TVector<T, 3>> result;
+
+      T best = Infinity;
+      Offset bestIndex = 0;
+
+      for (Offset start = 0; start < count; start += Block) {
+         T enter[Block], leave[Block];
+         for (Offset j = 0; j < Block; ++j) {
+            enter[j] = 0;
+            leave[j] = Infinity;
+         }
+
+         for (Offset k = 0; k < 3; ++k) {
+            const T* lo = min.GetLane(k) + start;
+            const T* hi = max.GetLane(k) + start;
+            const T o = ray.mOrigin[k];
+            const T d = ray.mNormal[k];
+
+            if (d == 0) {
+               // Parallel to this slab, so the origin must be within   
+               for (Offset j = 0; j < Block; ++j) {
+                  const bool outside = o < lo[j] or o > hi[j];
+                  leave[j] = outside ? -Infinity : leave[j];
+               }
+               continue;
+            }
+
+            const T inverse = T {1} / d;
+            for (Offset j = 0; j < Block; ++j) {
+               const T t0 = (lo[j] - o) * inverse;
+               const T t1 = (hi[j] - o) * inverse;
+               enter[j] = ::std::max(enter[j], ::std::min(t0, t1));
+               leave[j] = ::std::min(leave[j], ::std::max(t0, t1));
+            }
+         }
+
+         // Rays starting inside a box hit it at its exit               
+         const Count size = ::std::min(Block, count - start);
+         for (Offset j = 0; j < size; ++j) {
+            if (enter[j] > leave[j] or leave[j] == Infinity)
+               continue;
+
+            const T t = enter[j] > 0 ? enter[j] : leave[j];
+            if (t < best) {
+               best = t;
+               bestIndex = start + j;
+            }
+         }
+      }
+
+      if (best == Infinity)
+         return result;
+
+      // Find the normal with the single box test                       
+      const auto lo = min.Get(bestIndex);
+      const auto hi = max.Get(bestIndex);
+      TBox<TVector<T, 3>> box;
+      box.mOffsets = (hi - lo) / T {2};
+      auto local = ray;
+      local.mOrigin -= (hi + lo) / T {2};
+      result = box.Intersect(local);
+      result.mIndex = bestIndex;
+      return result;
+   }
+
+} // namespace Langulus::Math
\ No newline at end of file
@@ -7,6 +7,7 @@
 ///                                                                           
 #pragma once
 #include "Primitive.hpp"
+#include "TRay.hpp"
 
 
 namespace Langulus
@@ -116,6 +117,7 @@ namespace Langulus::Math
       NOD() constexpr bool IsDegenerate() const noexcept;
       NOD() constexpr bool IsHollow() const noexcept;
       NOD() auto SignedDistance(const T&) const;
+      NOD() auto Intersect(const TRay<T>&) const noexcept -> TRayHit<T>;
 
       NOD() explicit operator Anyness::Text() const;
       NOD() explicit operator Flow::Code() const;
@@ -177,6 +179,7 @@ namespace Langulus::Math
       NOD() constexpr bool IsDegenerate() const noexcept;
       NOD() constexpr bool IsHollow() const noexcept;
       NOD() auto SignedDistance(const T&) const;
+      NOD() auto Intersect(const TRay<T>&) const noexcept -> TRayHit<T>;
 
       NOD() explicit operator Anyness::Text() const;
       NOD() explicit operator Flow::Code() const;
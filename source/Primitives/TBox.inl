@@ -9,6 +9,7 @@
 #include "TBox.hpp"
 #include "../SignedDistance/TBox.inl"
 #include "../SignedDistance/TBoxRounded.inl"
+#include <cmath>
 
 #define TEMPLATE()   template<CT::Vector T>
 #define TME()        TBox<T>
@@ -39,6 +40,64 @@ namespace Langulus::Math
       return Math::SignedDistance(point, *this);
    }
 
+   /// Intersect with a ray, using the slab test                              
+   ///   @param ray - the ray, with a normalized direction                    
+   ///   @return the nearest hit in front of the ray origin, with an          
+   ///      outward normal; rays starting inside hit from within              
+   TEMPLATE()
+   auto TME()::Intersect(const TRay<T>& ray) const noexcept -> TRayHit<T> {
+      using S = TypeOf<T>;
+      constexpr S Infinity = ::std::numeric_limits<S>::infinity();
+      TRayHit<T> result;
+      S enter = -Infinity;
+      S leave =  Infinity;
+      Offset enterAxis = 0;
+      Offset leaveAxis = 0;
+
+      for (Offset c = 0; c < MemberCount; ++c) {
+         const S o = ray.mOrigin[c];
+         const S d = ray.mNormal[c];
+         const S e = mOffsets[c];
+
+         // Rays parallel to a slab either always or never overlap it   
+         if (d == 0) {
+            if (o < -e or o > e)
+               return result;
+            continue;
+         }
+
+         S t0 = (-e - o) / d;
+         S t1 = ( e - o) / d;
+         if (t0 > t1) {
+            const S swap = t0;
+            t0 = t1;
+            t1 = swap;
+         }
+
+         if (t0 > enter) {
+            enter = t0;
+            enterAxis = c;
+         }
+         if (t1 < leave) {
+            leave = t1;
+            leaveAxis = c;
+         }
+      }
+
+      if (enter > leave or leave < 0 or leave == Infinity)
+         return result;
+
+      if (enter >= 0) {
+         result.mDistance = enter;
+         result.mNormal[enterAxis] = ray.mNormal[enterAxis] < 0 ? S {1} : S {-1};
+      }
+      else {
+         result.mDistance = leave;
+         result.mNormal[leaveAxis] = ray.mNormal[leaveAxis] > 0 ? S {1} : S {-1};
+      }
+      return result;
+   }
+
    /// Stringify box for debugging                                            
    TEMPLATE() LANGULUS(INLINED)
    TME()::operator Anyness::Text() const {
@@ -82,6 +141,100 @@ namespace Langulus::Math
       return Math::SignedDistance(point, *this);
    }
 
+   /// Intersect with a ray, by clipping it to the bounds and then testing    
+   /// the faces, the nearest corner sphere and the nearest edge cylinders    
+   /// Based on Inigo Quilez's rounded box intersector                        
+   ///   @attention rays that start inside the rounded box always miss        
+   ///   @param ray - the ray, with a normalized direction                    
+   ///   @return the nearest hit in front of the ray origin, with an          
+   ///      outward normal                                                    
+   TEMPLATE()
+   auto TME()::Intersect(const TRay<T>& ray) const noexcept -> TRayHit<T> {
+      static_assert(MemberCount == 3, "Only 3D rounded boxes can be intersected");
+      using S = TypeOf<T>;
+      TRayHit<T> result;
+
+      // Clip against the bounds first                                  
+      Base bounds;
+      bounds.mOffsets = mOffsets + mRadius;
+      const auto clip = bounds.Intersect(ray);
+      if (not clip)
+         return result;
+
+      // A ray that starts within the bounds is either inside the       
+      // rounded box, or in a gap around a corner or an edge, and is    
+      // tested from its origin instead                                 
+      bool inside = true;
+      for (Offset c = 0; c < MemberCount; ++c)
+         inside &= ::std::abs(ray.mOrigin[c]) < bounds.mOffsets[c];
+      if (inside and SignedDistance(ray.mOrigin) <= 0)
+         return result;
+
+      // Mirror everything into the first octant                        
+      S t = inside ? S {0} : clip.mDistance;
+      T ro, rd, pos;
+      for (Offset c = 0; c < MemberCount; ++c) {
+         const S p = ray.mOrigin[c] + ray.mNormal[c] * t;
+         const S sign = p < 0 ? S {-1} : S {1};
+         ro[c]  = ray.mOrigin[c] * sign;
+         rd[c]  = ray.mNormal[c] * sign;
+         pos[c] = p * sign - mOffsets[c];
+      }
+
+      // The normal points away from the nearest point on the inner box 
+      const auto finish = [&](S distance) {
+         result.mDistance = distance;
+         T n;
+         for (Offset c = 0; c < MemberCount; ++c) {
+            const S p = ray.mOrigin[c] + ray.mNormal[c] * distance;
+            const S excess = ::std::abs(p) - mOffsets[c];
+            n[c] = excess > 0 ? (p < 0 ? -excess : excess) : S {0};
+         }
+         result.mNormal = n.Normalize();
+         return result;
+      };
+
+      // Hitting one of the flat faces                                  
+      if ((pos[0] < 0 and pos[1] < 0) or (pos[1] < 0 and pos[2] < 0)
+      or  (pos[2] < 0 and pos[0] < 0))
+         return finish(t);
+
+      const T oc = ro - mOffsets;
+      const S ra2 = mRadius * mRadius;
+      t = ::std::numeric_limits<S>::infinity();
+
+      // The corner sphere                                              
+      {
+         const S b = oc[0] * rd[0] + oc[1] * rd[1] + oc[2] * rd[2];
+         const S c = oc[0] * oc[0] + oc[1] * oc[1] + oc[2] * oc[2] - ra2;
+         S h = b * b - c;
+         if (h > 0) {
+            h = -b - ::std::sqrt(h);
+            if (h > 0)
+               t = h;
+         }
+      }
+
+      // The three edge cylinders, along each axis                      
+      for (Offset axis = 0; axis < MemberCount; ++axis) {
+         const Offset u = (axis + 1) % 3;
+         const Offset v = (axis + 2) % 3;
+         const S a = rd[u] * rd[u] + rd[v] * rd[v];
+         const S b = oc[u] * rd[u] + oc[v] * rd[v];
+         const S c = oc[u] * oc[u] + oc[v] * oc[v] - ra2;
+         S h = b * b - a * c;
+         if (h > 0) {
+            h = (-b - ::std::sqrt(h)) / a;
+            if (h > 0 and h < t and ::std::abs(ro[axis] + rd[axis] * h) < mOffsets[axis])
+               t = h;
+         }
+      }
+
+      if (t == ::std::numeric_limits<S>::infinity())
+         return result;
+      return finish(t);
+   }
+
    /// Stringify box for debugging                                            
    TEMPLATE() LANGULUS(INLINED)
    TME()::operator Anyness::Text() const {
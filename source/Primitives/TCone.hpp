@@ -7,6 +7,7 @@
 ///                                                                           
 #pragma once
 #include "Primitive.hpp"
+#include "TRay.hpp"
 #include "../Numbers/TAngle.hpp"
 
 
@@ -25,7 +26,7 @@ namespace Langulus::Math
 
       using PointType = T;
       using Dimension = D;
-      using T::MemberCount;
+      static constexpr Count MemberCount = T::MemberCount;
       static_assert(MemberCount == 3, "Can't have a non-3D cone");
       static_assert(D::Index < 3, "Can't extend cone in that dimension");
 
@@ -39,6 +40,7 @@ namespace Langulus::Math
       NOD() constexpr bool IsDegenerate() const noexcept;
       NOD() constexpr bool IsHollow() const noexcept;
       NOD() auto SignedDistance(const T&) const;
+      NOD() auto Intersect(const TRay<T>&) const noexcept -> TRayHit<T>;
    };
 
 } // namespace Langulus::Math
\ No newline at end of file
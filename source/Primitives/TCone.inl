@@ -8,6 +8,7 @@
 #pragma once
 #include "TCone.hpp"
 #include "../SignedDistance/TCone.inl"
+#include <cmath>
 
 namespace Langulus::Math
 {
@@ -34,5 +35,79 @@ namespace Langulus::Math
       return ::Langulus::Math::SignedDistance(point, *this);
    }
 
+   /// Intersect with a ray                                                   
+   /// The cone's tip is at the origin, and its base is at -mHeight along D,  
+   /// so the side is tested as a double cone, clipped to that range, and     
+   /// the base is tested as a disc                                           
+   ///   @param ray - the ray, with a normalized direction                    
+   ///   @return the nearest hit in front of the ray origin, with an          
+   ///      outward normal; rays starting inside hit from within              
+   template<CT::Vector T, CT::Dimension D>
+   auto TCone<T, D>::Intersect(const TRay<T>& ray) const noexcept -> TRayHit<T> {
+      using S = TypeOf<T>;
+      constexpr Offset A = D::Index;
+      constexpr Offset U = (A + 1) % 3;
+      constexpr Offset V = (A + 2) % 3;
+      TRayHit<T> result;
+      const T& o = ray.mOrigin;
+      const T& d = ray.mNormal;
+      const S sn = static_cast<S>(Sin(mAngle));
+      const S cs = static_cast<S>(Cos(mAngle));
+      const S sn2 = sn * sn;
+      const S cs2 = cs * cs;
+
+      const auto hitSide = [&](S t) {
+         if (t < 0 or t >= result.mDistance)
+            return;
+
+         const T p = ray.Point(t);
+         if (p[A] < -mHeight or p[A] > 0)
+            return;
+
+         const S q = ::std::sqrt(p[U] * p[U] + p[V] * p[V]);
+         result.mDistance = t;
+         result.mNormal = {};
+         result.mNormal[A] = cs;
+         if (q > 0) {
+            result.mNormal[U] = sn * p[U] / q;
+            result.mNormal[V] = sn * p[V] / q;
+         }
+      };
+
+      // The side: sn^2 * (u^2 + v^2) = cs^2 * y^2, as a*t^2 + 2b*t + c 
+      const S a = (d[U] * d[U] + d[V] * d[V]) * sn2 - d[A] * d[A] * cs2;
+      const S b = (o[U] * d[U] + o[V] * d[V]) * sn2 - o[A] * d[A] * cs2;
+      const S c = (o[U] * o[U] + o[V] * o[V]) * sn2 - o[A] * o[A] * cs2;
+      if (::std::abs(a) <= ::std::numeric_limits<S>::epsilon()) {
+         // Ray is parallel to the slope, so there's at most one hit    
+         if (b != 0)
+            hitSide(-c / (2 * b));
+      }
+      else {
+         const S h = b * b - a * c;
+         if (h >= 0) {
+            const S sh = ::std::sqrt(h);
+            hitSide((-b - sh) / a);
+            hitSide((-b + sh) / a);
+         }
+      }
+
+      // The base disc                                                  
+      if (d[A] != 0) {
+         const S t = (-mHeight - o[A]) / d[A];
+         if (t >= 0 and t < result.mDistance) {
+            const T p = ray.Point(t);
+            const S baseRadius = mHeight * cs / sn;
+            if (p[U] * p[U] + p[V] * p[V] <= baseRadius * baseRadius) {
+               result.mDistance = t;
+               result.mNormal = {};
+               result.mNormal[A] = S {-1};
+            }
+         }
+      }
+
+      return result;
+   }
+
 } // namespace Langulus::Math
 
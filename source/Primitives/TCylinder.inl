@@ -9,6 +9,7 @@
 #include "TCylinder.hpp"
 #include "../SignedDistance/TCylinder.inl"
 #include "../SignedDistance/TCylinderCapped.inl"
+#include <cmath>
 
 #define TEMPLATE() template<CT::Vector T, CT::Dimension D>
 
@@ -37,6 +38,44 @@ namespace Langulus::Math
    auto TCylinder<T, D>::SignedDistance(const T& point) const {
       return Math::SignedDistance(point, *this);
    }
+
+   /// Intersect with a ray, by solving the circle equation in the plane      
+   /// perpendicular to the cylinder's direction                              
+   ///   @param ray - the ray, with a normalized direction                    
+   ///   @return the nearest hit in front of the ray origin, with an          
+   ///      outward normal; rays starting inside hit from within              
+   TEMPLATE()
+   auto TCylinder<T, D>::Intersect(const TRay<T>& ray) const noexcept -> TRayHit<T> {
+      using S = TypeOf<T>;
+      constexpr Offset U = (D::Index + 1) % 3;
+      constexpr Offset V = (D::Index + 2) % 3;
+      TRayHit<T> result;
+
+      // Rays parallel to the cylinder never hit its side               
+      const S a = ray.mNormal[U] * ray.mNormal[U] + ray.mNormal[V] * ray.mNormal[V];
+      if (a == 0)
+         return result;
+
+      const S b = ray.mOrigin[U] * ray.mNormal[U] + ray.mOrigin[V] * ray.mNormal[V];
+      const S c = ray.mOrigin[U] * ray.mOrigin[U] + ray.mOrigin[V] * ray.mOrigin[V]
+                - mRadius * mRadius;
+      S h = b * b - a * c;
+      if (h < 0)
+         return result;
+
+      h = ::std::sqrt(h);
+      S t = (-b - h) / a;
+      if (t < 0)
+         t = (-b + h) / a;
+      if (t < 0)
+         return result;
+
+      const T p = ray.Point(t);
+      result.mDistance = t;
+      result.mNormal[U] = p[U] / mRadius;
+      result.mNormal[V] = p[V] / mRadius;
+      return result;
+   }
    
    /// Check if cylinder is degenerate                                        
    ///   @return true if at least one offset is zero                          
@@ -60,6 +99,66 @@ namespace Langulus::Math
       return Math::SignedDistance(point, *this);
    }
 
+   /// Intersect with a ray, by testing the side within the height, and       
+   /// both caps within the radius                                            
+   ///   @param ray - the ray, with a normalized direction                    
+   ///   @return the nearest hit in front of the ray origin, with an          
+   ///      outward normal; rays starting inside hit from within              
+   TEMPLATE()
+   auto TCylinderCapped<T, D>::Intersect(const TRay<T>& ray) const noexcept -> TRayHit<T> {
+      using S = TypeOf<T>;
+      constexpr Offset A = D::Index;
+      constexpr Offset U = (A + 1) % 3;
+      constexpr Offset V = (A + 2) % 3;
+      TRayHit<T> result;
+      const T& o = ray.mOrigin;
+      const T& d = ray.mNormal;
+      const S r2 = mRadius * mRadius;
+
+      // The side, only where it is within the height                   
+      const S a = d[U] * d[U] + d[V] * d[V];
+      if (a != 0) {
+         const S b = o[U] * d[U] + o[V] * d[V];
+         const S c = o[U] * o[U] + o[V] * o[V] - r2;
+         S h = b * b - a * c;
+         if (h >= 0) {
+            h = ::std::sqrt(h);
+            for (const S t : {(-b - h) / a, (-b + h) / a}) {
+               if (t < 0 or t >= result.mDistance)
+                  continue;
+
+               const T p = ray.Point(t);
+               if (p[A] < -mHeight or p[A] > mHeight)
+                  continue;
+
+               result.mDistance = t;
+               result.mNormal = {};
+               result.mNormal[U] = p[U] / mRadius;
+               result.mNormal[V] = p[V] / mRadius;
+            }
+         }
+      }
+
+      // The caps, only where they are within the radius                
+      if (d[A] != 0) {
+         for (const S cap : {-mHeight, mHeight}) {
+            const S t = (cap - o[A]) / d[A];
+            if (t < 0 or t >= result.mDistance)
+               continue;
+
+            const T p = ray.Point(t);
+            if (p[U] * p[U] + p[V] * p[V] > r2)
+               continue;
+
+            result.mDistance = t;
+            result.mNormal = {};
+            result.mNormal[A] = cap < 0 ? S {-1} : S {1};
+         }
+      }
+
+      return result;
+   }
+
 } // namespace Langulus::Math
 
 #undef TEMPLATE
\ No newline at end of file
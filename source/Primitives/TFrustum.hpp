@@ -9,6 +9,7 @@
 #include "TPlane.hpp"
 #include "../Ranges/TRange.hpp"
 #include "../Matrices/TMatrix.hpp"
+#include "../Vectors/TVectorStream.hpp"
 
 
 namespace Langulus
@@ -66,12 +67,22 @@ namespace Langulus::Math
       using PointType  = T;
       using ScalarType = TypeOf<PointType>;
       using MatrixType = TMatrix<ScalarType, MemberCount + 1>;
+      using StreamType = TVectorStream<ScalarType, MemberCount>;
+      using RadiusStreamType = TVectorStream<ScalarType, 1>;
       static_assert(MemberCount > 1, "Can't have one-dimensional frustum");
 
+      // Visibility masks are arrays of these words, where bit N of word
+      // M corresponds to the volume at index M * 64 + N                
+      using MaskType = ::std::uint64_t;
+      static constexpr Count MaskBits = sizeof(MaskType) * 8;
+
       ::std::array<TPlane<T>, MemberCount * 2> mPlanes;
 
       enum {Left = 0, Right, Top, Bottom, Near, Far};
 
+      // How a volume relates to a single plane                         
+      enum class Side : ::std::uint8_t {Outside, Intersecting, Inside};
+
    public:
       constexpr TFrustum() noexcept;
       template<template<class> class S> requires CT::Intent<S<TFrustum<T>>>
@@ -82,6 +93,15 @@ namespace Langulus::Math
       NOD() constexpr bool IsHollow() const noexcept;
       NOD() auto SignedDistance(const T&) const;
       NOD() bool Intersects(const TRange<T>&) const noexcept;
+      NOD() Side Classify(Offset, const TRange<T>&) const noexcept;
+
+      NOD() static constexpr Count GetMaskSize(Count) noexcept;
+      void Cull(const StreamType&, const StreamType&, MaskType*) const;
+      void Cull(const StreamType&, const RadiusStreamType&, MaskType*) const;
+
+   protected:
+      template<class PLANE_TEST>
+      void CullBlocks(Count, MaskType*, PLANE_TEST&&) const;
    };
 
 } // namespace Langulus::Math
\ No newline at end of file
@@ -8,6 +8,7 @@
 #pragma once
 #include "TFrustum.hpp"
 #include "TPlane.inl"
+#include "../Vectors/TVectorStream.inl"
 
 #define TEMPLATE() template<CT::Vector T>
 
@@ -103,11 +104,9 @@ namespace Langulus::Math
       // Not quite as fast, but wastes less space                       
       for (const auto& plane : mPlanes) {
          const auto& normal = plane.mNormal;
-         const PointType point = {
-            normal[0] >= 0 ? box.mMin[0] : box.mMax[0],
-            normal[1] >= 0 ? box.mMin[1] : box.mMax[1],
-            normal[2] >= 0 ? box.mMin[2] : box.mMax[2]
-         };
+         PointType point;
+         for (Offset c = 0; c < MemberCount; ++c)
+            point[c] = normal[c] >= 0 ? box.mMin[c] : box.mMax[c];
 
          if (point.Dot(normal) > -plane.mOffset)
             return false;
@@ -116,6 +115,168 @@ namespace Langulus::Math
       return true;
    }
 
+   /// Classify a box against a single plane of the frustum                   
+   ///   @param index - the plane index                                       
+   ///   @param box - the box to classify                                     
+   ///   @return the side of the plane the box is on                          
+   TEMPLATE() LANGULUS(INLINED)
+   auto TFrustum<T>::Classify(Offset index, const TRange<T>& box) const noexcept -> Side {
+      const auto& plane = mPlanes[index];
+      const auto& normal = plane.mNormal;
+
+      // The corner furthest along the negative side decides whether the
+      // box is outside, the opposite corner whether it is fully inside 
+      PointType nearest, furthest;
+      for (Offset c = 0; c < MemberCount; ++c) {
+         nearest[c]  = normal[c] >= 0 ? box.mMin[c] : box.mMax[c];
+         furthest[c] = normal[c] >= 0 ? box.mMax[c] : box.mMin[c];
+      }
+
+      if (nearest.Dot(normal) > -plane.mOffset)
+         return Side::Outside;
+      if (furthest.Dot(normal) <= -plane.mOffset)
+         return Side::Inside;
+      return Side::Intersecting;
+   }
+
+   /// Get the number of mask words required to cull a number of volumes      
+   ///   @param count - the number of volumes                                 
+   ///   @return the number of MaskType words                                 
+   TEMPLATE() LANGULUS(INLINED)
+   constexpr Count TFrustum<T>::GetMaskSize(Count count) noexcept {
+      return (count + MaskBits - 1) / MaskBits;
+   }
+
+   /// Cull a batch of axis-aligned bounding boxes                            
+   /// Produces the same results as Intersects(), but tests a whole block     
+   /// of boxes per plane (one 512-bit register worth), and stops testing     
+   /// a block as soon as all of its boxes are outside a plane                
+   ///   @param min - the minimum corners of the boxes                        
+   ///   @param max - the maximum corners of the boxes                        
+   ///   @param visible - [out] the visibility mask, must have at least       
+   ///      GetMaskSize(min.GetCount()) words; bit is set if box is visible   
+   TEMPLATE()
+   void TFrustum<T>::Cull(const StreamType& min, const StreamType& max, MaskType* visible) const {
+      LANGULUS_ASSUME(UserAssumes, min.GetCount() == max.GetCount(),
+         "AABB stream size mismatch");
+      constexpr Count Block = StreamType::Block;
+
+      const ScalarType* mins[MemberCount];
+      const ScalarType* maxs[MemberCount];
+      for (Offset c = 0; c < MemberCount; ++c) {
+         mins[c] = min.GetLane(c);
+         maxs[c] = max.GetLane(c);
+      }
+
+      CullBlocks(min.GetCount(), visible, [&](const TPlane<T>* plane, Offset start) {
+         MaskType outside {};
+         if (not plane) {
+            // Boxes with zero size along any axis are never visible,   
+            // same as in Intersects()                                  
+            for (Offset j = 0; j < Block; ++j) {
+               bool degenerate = false;
+               for (Offset c = 0; c < MemberCount; ++c)
+                  degenerate |= mins[c][start + j] == maxs[c][start + j];
+               outside |= MaskType {degenerate} << j;
+            }
+            return outside;
+         }
+
+         // Only the box corner that is furthest along the negative     
+         // side of the plane is tested. The corner is picked per plane 
+         // instead of per box, so the loops have no branches           
+         ScalarType distance[Block];
+         for (Offset j = 0; j < Block; ++j)
+            distance[j] = plane->mOffset;
+
+         for (Offset c = 0; c < MemberCount; ++c) {
+            const ScalarType n = plane->mNormal[c];
+            const ScalarType* lane = (n >= 0 ? mins[c] : maxs[c]) + start;
+            for (Offset j = 0; j < Block; ++j)
+               distance[j] += lane[j] * n;
+         }
+
+         for (Offset j = 0; j < Block; ++j)
+            outside |= MaskType {distance[j] > 0} << j;
+         return outside;
+      });
+   }
+
+   /// Cull a batch of bounding spheres                                       
+   ///   @param centers - the centers of the spheres                          
+   ///   @param radii - the radii of the spheres                              
+   ///   @param visible - [out] the visibility mask, must have at least       
+   ///      GetMaskSize(centers.GetCount()) words; bit is set if visible      
+   TEMPLATE()
+   void TFrustum<T>::Cull(const StreamType& centers, const RadiusStreamType& radii, MaskType* visible) const {
+      LANGULUS_ASSUME(UserAssumes, centers.GetCount() == radii.GetCount(),
+         "Sphere stream size mismatch");
+      constexpr Count Block = StreamType::Block;
+
+      const ScalarType* lanes[MemberCount];
+      for (Offset c = 0; c < MemberCount; ++c)
+         lanes[c] = centers.GetLane(c);
+      const ScalarType* radius = radii.GetLane(0);
+
+      CullBlocks(centers.GetCount(), visible, [&](const TPlane<T>* plane, Offset start) {
+         if (not plane)
+            return MaskType {};
+
+         // A sphere is outside, if its center is further than its      
+         // radius along the positive side of the plane                 
+         ScalarType distance[Block];
+         for (Offset j = 0; j < Block; ++j)
+            distance[j] = plane->mOffset - radius[start + j];
+
+         for (Offset c = 0; c < MemberCount; ++c) {
+            const ScalarType n = plane->mNormal[c];
+            const ScalarType* lane = lanes[c] + start;
+            for (Offset j = 0; j < Block; ++j)
+               distance[j] += lane[j] * n;
+         }
+
+         MaskType outside {};
+         for (Offset j = 0; j < Block; ++j)
+            outside |= MaskType {distance[j] > 0} << j;
+         return outside;
+      });
+   }
+
+   /// Iterate blocks of volumes, testing each block against all planes       
+   /// until all volumes in it are outside, and write the visibility mask     
+   ///   @param count - the number of volumes                                 
+   ///   @param visible - [out] the visibility mask                           
+   ///   @param test - called once with nullptr plane for an initial mask,    
+   ///      and then once per plane; returns the mask of volumes that are     
+   ///      outside, for the block that begins at the given offset            
+   TEMPLATE() template<class PLANE_TEST>
+   void TFrustum<T>::CullBlocks(Count count, MaskType* visible, PLANE_TEST&& test) const {
+      constexpr Count Block = StreamType::Block;
+      static_assert(MaskBits % Block == 0,
+         "Blocks must not straddle mask words");
+      constexpr MaskType Full = Block == MaskBits
+         ? ~MaskType {} : (MaskType {1} << Block) - 1;
+
+      for (Offset w = 0; w < GetMaskSize(count); ++w)
+         visible[w] = 0;
+
+      for (Offset start = 0; start < count; start += Block) {
+         MaskType outside = test(nullptr, start);
+         for (const auto& plane : mPlanes) {
+            // Early-out, if the whole block is outside                 
+            if (outside == Full)
+               break;
+            outside |= test(&plane, start);
+         }
+
+         // Padding past the end of the streams is never visible        
+         MaskType inside = ~outside & Full;
+         if (count - start < Block)
+            inside &= (MaskType {1} << (count - start)) - 1;
+         visible[start / MaskBits] |= inside << (start % MaskBits);
+      }
+   }
+
 } // namespace Langulus::Math
 
 #undef TEMPLATE
\ No newline at end of file
@@ -0,0 +1,74 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "TFrustum.hpp"
+
+
+namespace Langulus::Math
+{
+
+   template<CT::Vector T>
+   struct TFrustumCuller;
+
+   using FrustumCuller2 = TFrustumCuller<Vec2>;
+   using FrustumCuller3 = TFrustumCuller<Vec3>;
+
+   using FrustumCuller = FrustumCuller3;
+
+
+   ///                                                                        
+   ///   Stateful frustum culler                                              
+   ///                                                                        
+   /// Gives the same answers as TFrustum::Intersects, but exploits frame to  
+   /// frame and parent to child coherency:                                   
+   ///   - remembers, per object, which plane last rejected it, and tests     
+   ///     that plane first next time - stationary objects that were out      
+   ///     of view are usually rejected by a single plane test                
+   ///   - reports a mask of the planes a box is fully inside of, which can   
+   ///     be passed when testing that box's children, so they skip these     
+   ///     planes altogether; a child of a box that is fully inside the       
+   ///     whole frustum is accepted without testing any planes               
+   ///                                                                        
+   template<CT::Vector T>
+   struct TFrustumCuller {
+      using FrustumType = TFrustum<T>;
+      using RangeType   = TRange<T>;
+      using PointType   = T;
+      using ScalarType  = TypeOf<T>;
+      using MaskType    = typename FrustumType::MaskType;
+
+      static constexpr Count PlaneCount = FrustumType::MemberCount * 2;
+
+      // Bit N is set if a box is fully inside plane N of the frustum   
+      using PlaneMask = ::std::uint8_t;
+      static constexpr PlaneMask AllPlanes = (1 << PlaneCount) - 1;
+
+      using Side = typename FrustumType::Side;
+
+   protected:
+      FrustumType mFrustum;
+      // Index of the plane that last rejected each object              
+      TMany<::std::uint8_t> mLastRejected;
+
+   public:
+      TFrustumCuller() = default;
+      TFrustumCuller(const FrustumType&, Count = 0);
+
+      void SetFrustum(const FrustumType&) noexcept;
+      NOD() auto GetFrustum() const noexcept -> const FrustumType&;
+
+      void Resize(Count);
+      void Forget() noexcept;
+      NOD() Count GetCount() const noexcept;
+
+      NOD() bool Cull(Offset, const RangeType&);
+      NOD() bool Cull(Offset, const RangeType&, PlaneMask&);
+      void Cull(const RangeType*, Count, MaskType*);
+   };
+
+} // namespace Langulus::Math
\ No newline at end of file
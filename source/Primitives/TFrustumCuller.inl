@@ -0,0 +1,155 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "TFrustumCuller.hpp"
+#include "TFrustum.inl"
+
+#define TEMPLATE() template<CT::Vector T>
+
+
+namespace Langulus::Math
+{
+
+   /// Create a culler for a frustum                                          
+   ///   @param frustum - the frustum to cull against                         
+   ///   @param count - number of objects to remember planes for              
+   TEMPLATE() LANGULUS(INLINED)
+   TFrustumCuller<T>::TFrustumCuller(const FrustumType& frustum, Count count)
+      : mFrustum {frustum} {
+      Resize(count);
+   }
+
+   /// Change the frustum, usually once per frame                             
+   /// Remembered planes are kept, because the plane order doesn't change     
+   /// when the frustum moves, and they're only used as a hint anyways        
+   ///   @param frustum - the new frustum                                     
+   TEMPLATE() LANGULUS(INLINED)
+   void TFrustumCuller<T>::SetFrustum(const FrustumType& frustum) noexcept {
+      mFrustum = frustum;
+   }
+
+   /// Get the frustum                                                        
+   ///   @return a reference to the frustum                                   
+   TEMPLATE() LANGULUS(INLINED)
+   auto TFrustumCuller<T>::GetFrustum() const noexcept -> const FrustumType& {
+      return mFrustum;
+   }
+
+   /// Change the number of objects to remember planes for                    
+   /// Objects that were already remembered retain their planes               
+   ///   @param count - the new number of objects                             
+   TEMPLATE()
+   void TFrustumCuller<T>::Resize(Count count) {
+      if (count == mLastRejected.GetCount())
+         return;
+
+      TMany<::std::uint8_t> resized;
+      if (count) {
+         resized.template Reserve<true>(count);
+         const Count kept = ::std::min(count, mLastRejected.GetCount());
+         if (kept)
+            ::std::memcpy(resized.GetRaw(), mLastRejected.GetRaw(), kept);
+         ::std::memset(resized.GetRaw() + kept, 0, count - kept);
+      }
+      mLastRejected = ::std::move(resized);
+   }
+
+   /// Forget all remembered planes, without changing the object count        
+   TEMPLATE() LANGULUS(INLINED)
+   void TFrustumCuller<T>::Forget() noexcept {
+      if (mLastRejected.GetCount())
+         ::std::memset(mLastRejected.GetRaw(), 0, mLastRejected.GetCount());
+   }
+
+   /// Get the number of objects planes are remembered for                    
+   TEMPLATE() LANGULUS(INLINED)
+   Count TFrustumCuller<T>::GetCount() const noexcept {
+      return mLastRejected.GetCount();
+   }
+
+   /// Cull an object's box, testing the plane that last rejected it first    
+   ///   @param object - the object index, must be smaller than GetCount()    
+   ///   @param box - the object's bounding box                               
+   ///   @return true if box intersects the frustum                           
+   TEMPLATE() LANGULUS(INLINED)
+   bool TFrustumCuller<T>::Cull(Offset object, const RangeType& box) {
+      PlaneMask inside = 0;
+      return Cull(object, box, inside);
+   }
+
+   /// Cull an object's box in a hierarchy                                    
+   ///   @param object - the object index, must be smaller than GetCount()    
+   ///   @param box - the object's bounding box                               
+   ///   @param inside - [in/out] on input, the planes the parent box was     
+   ///      fully inside, and will be skipped (use zero for root objects);    
+   ///      on output, the planes this box is fully inside, to be passed      
+   ///      when culling its children                                         
+   ///   @return true if box intersects the frustum                           
+   TEMPLATE()
+   bool TFrustumCuller<T>::Cull(Offset object, const RangeType& box, PlaneMask& inside) {
+      LANGULUS_ASSUME(UserAssumes, object < mLastRejected.GetCount(),
+         "Object index out of range");
+
+      // Same as in TFrustum::Intersects                                
+      if (box.IsDegenerate() or box.Length().IsDegenerate())
+         return false;
+
+      // A box inside a box that is fully inside the frustum is visible 
+      if ((inside & AllPlanes) == AllPlanes)
+         return true;
+
+      auto& last = mLastRejected.GetRaw()[object];
+      const Offset first = last < PlaneCount ? last : 0;
+
+      for (Offset i = 0; i < PlaneCount; ++i) {
+         // Start with the remembered plane, then continue with the     
+         // rest in the usual order, skipping the remembered one        
+         const Offset p = i == 0 ? first : (i <= first ? i - 1 : i);
+         const PlaneMask bit = PlaneMask(1 << p);
+         if (inside & bit)
+            continue;
+
+         switch (mFrustum.Classify(p, box)) {
+         case Side::Outside:
+            last = static_cast<::std::uint8_t>(p);
+            return false;
+         case Side::Inside:
+            inside |= bit;
+            break;
+         default:
+            break;
+         }
+      }
+
+      return true;
+   }
+
+   /// Cull an array of objects' boxes into a visibility mask                 
+   /// Box at index N is considered to be object N                            
+   ///   @param boxes - the boxes to cull                                     
+   ///   @param count - number of boxes, must not exceed GetCount()           
+   ///   @param visible - [out] the visibility mask, must have at least       
+   ///      FrustumType::GetMaskSize(count) words; bit is set if visible      
+   TEMPLATE()
+   void TFrustumCuller<T>::Cull(const RangeType* boxes, Count count, MaskType* visible) {
+      LANGULUS_ASSUME(UserAssumes, count <= mLastRejected.GetCount(),
+         "Object count out of range");
+      constexpr Count Bits = FrustumType::MaskBits;
+
+      for (Offset w = 0; w < FrustumType::GetMaskSize(count); ++w)
+         visible[w] = 0;
+
+      for (Offset i = 0; i < count; ++i) {
+         if (Cull(i, boxes[i]))
+            visible[i / Bits] |= MaskType {1} << (i % Bits);
+      }
+   }
+
+} // namespace Langulus::Math
+
+#undef TEMPLATE
\ No newline at end of file
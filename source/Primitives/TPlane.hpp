@@ -7,6 +7,7 @@
 ///                                                                           
 #pragma once
 #include "Primitive.hpp"
+#include "TRay.hpp"
 
 
 namespace Langulus::Math
@@ -44,6 +45,7 @@ namespace Langulus::Math
       NOD() constexpr bool IsDegenerate() const noexcept;
       NOD() constexpr bool IsHollow() const noexcept;
       NOD() auto SignedDistance(const T&) const;
+      NOD() auto Intersect(const TRay<T>&) const noexcept -> TRayHit<T>;
    };
 
 } // namespace Langulus::Math
\ No newline at end of file
@@ -83,5 +83,25 @@ namespace Langulus::Math
       return Math::SignedDistance(point, *this);
    }
 
+   /// Intersect with a ray                                                   
+   ///   @param ray - the ray, with a normalized direction                    
+   ///   @return the hit in front of the ray origin, if any; the normal is    
+   ///      always the plane normal, regardless of the side that was hit      
+   template<CT::Vector T>
+   auto TPlane<T>::Intersect(const TRay<T>& ray) const noexcept -> TRayHit<T> {
+      TRayHit<T> result;
+      const auto denominator = mNormal.Dot(ray.mNormal);
+      if (denominator == 0)
+         return result;
+
+      const auto t = -(mNormal.Dot(ray.mOrigin) + mOffset) / denominator;
+      if (t < 0)
+         return result;
+
+      result.mDistance = t;
+      result.mNormal = mNormal;
+      return result;
+   }
+
 } // namespace Langulus::Math
 
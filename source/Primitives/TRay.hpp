@@ -7,6 +7,7 @@
 ///                                                                           
 #pragma once
 #include "Primitive.hpp"
+#include <limits>
 
 
 namespace Langulus
@@ -89,6 +90,32 @@ namespace Langulus
          }
       };
 
+
+      ///                                                                     
+      ///   Result of a ray intersection                                      
+      ///                                                                     
+      template<CT::Vector T>
+      struct TRayHit {
+         using ScalarType = TypeOf<T>;
+
+         // Distance along the ray, infinity if nothing was hit         
+         ScalarType mDistance = ::std::numeric_limits<ScalarType>::infinity();
+         // Surface normal at the hit point                             
+         T mNormal {};
+         // Surface parameters at the hit point, where applicable, i.e. 
+         // barycentric coordinates of the second and third triangle    
+         // points                                                      
+         ScalarType mU {};
+         ScalarType mV {};
+         // Index of the primitive that was hit, for batched tests      
+         Offset mIndex {};
+
+         /// Check if anything was hit                                        
+         NOD() constexpr explicit operator bool() const noexcept {
+            return mDistance != ::std::numeric_limits<ScalarType>::infinity();
+         }
+      };
+
    } // namespace Langulus::Math
 
 } // namespace Langulus
\ No newline at end of file
@@ -7,6 +7,8 @@
 ///                                                                           
 #pragma once
 #include "Primitive.hpp"
+#include "TRay.hpp"
+#include <cmath>
 
 
 namespace Langulus
@@ -118,6 +120,29 @@ namespace Langulus::Math
       NOD() auto SignedDistance(const T& point) const {
          return point.Length() - mRadius;
       }
+
+      /// Intersect with a ray                                                
+      ///   @param ray - the ray, with a normalized direction                 
+      ///   @return the nearest hit in front of the ray origin, with an       
+      ///      outward normal; rays starting inside hit from within           
+      NOD() auto Intersect(const TRay<T>& ray) const noexcept -> TRayHit<T> {
+         using S = TypeOf<T>;
+         TRayHit<T> result;
+         const S b = ray.mOrigin.Dot(ray.mNormal);
+         const S c = ray.mOrigin.Dot(ray.mOrigin) - mRadius * mRadius;
+         S h = b * b - c;
+         if (h < 0)
+            return result;
+
+         h = ::std::sqrt(h);
+         const S t = -b - h >= 0 ? -b - h : -b + h;
+         if (t < 0)
+            return result;
+
+         result.mDistance = t;
+         result.mNormal = ray.Point(t) / mRadius;
+         return result;
+      }
    };
 
 
@@ -187,6 +212,32 @@ namespace Langulus::Math
          const auto k1 = (point / (mRadii * mRadii)).Length();
          return k0 * (k0 - TypeOf<T> {1}) / k1;
       }
+
+      /// Intersect with a ray, by scaling the ellipsoid to a unit sphere     
+      ///   @param ray - the ray, with a normalized direction                 
+      ///   @return the nearest hit in front of the ray origin, with an       
+      ///      outward normal; rays starting inside hit from within           
+      NOD() auto Intersect(const TRay<T>& ray) const noexcept -> TRayHit<T> {
+         using S = TypeOf<T>;
+         TRayHit<T> result;
+         const T o = ray.mOrigin / mRadii;
+         const T d = ray.mNormal / mRadii;
+         const S a = d.Dot(d);
+         const S b = o.Dot(d);
+         const S c = o.Dot(o);
+         S h = b * b - a * (c - S {1});
+         if (h < 0)
+            return result;
+
+         h = ::std::sqrt(h);
+         const S t = -b - h >= 0 ? (-b - h) / a : (-b + h) / a;
+         if (t < 0)
+            return result;
+
+         result.mDistance = t;
+         result.mNormal = (ray.Point(t) / (mRadii * mRadii)).Normalize();
+         return result;
+      }
    };
 
 } // namespace Langulus::Math
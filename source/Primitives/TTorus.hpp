@@ -7,6 +7,8 @@
 ///                                                                           
 #pragma once
 #include "Primitive.hpp"
+#include "TRay.hpp"
+#include <cmath>
 
 
 namespace Langulus::Math
@@ -22,7 +24,7 @@ namespace Langulus::Math
       LANGULUS_BASES(A::Primitive);
 
       using PointType = T;
-      using T::MemberCount;
+      static constexpr Count MemberCount = T::MemberCount;
       static_assert(MemberCount == 3, "Can't have a non-three-dimensional torus");
       static_assert(D::Index < 3, "Can't extend torus in that dimension");
 
@@ -60,6 +62,122 @@ namespace Langulus::Math
          }
          else static_assert(false, "Unsupported dimension");
       }
+
+      /// Intersect with a ray, by solving the quartic in closed form         
+      /// Based on Inigo Quilez's torus intersector, solved in double         
+      /// precision, because the quartic is ill-conditioned in float          
+      ///   @param ray - the ray, with a normalized direction                 
+      ///   @return the nearest hit in front of the ray origin, with an       
+      ///      outward normal; rays starting inside hit from within           
+      NOD() auto Intersect(const TRay<T>& ray) const noexcept -> TRayHit<T> {
+         TRayHit<T> result;
+
+         // Permute, so that the torus axis is along the third component
+         constexpr Offset A = D::Index;
+         constexpr Offset U = (A + 1) % 3;
+         constexpr Offset V = (A + 2) % 3;
+         const double o[3] {ray.mOrigin[U], ray.mOrigin[V], ray.mOrigin[A]};
+         const double d[3] {ray.mNormal[U], ray.mNormal[V], ray.mNormal[A]};
+         const double R2 = double(mOuterRadius) * mOuterRadius;
+         const double r2 = double(mInnerRadius) * mInnerRadius;
+         const double m = o[0] * o[0] + o[1] * o[1] + o[2] * o[2];
+         const double n = o[0] * d[0] + o[1] * d[1] + o[2] * d[2];
+
+         // Reject rays that miss the bounding sphere                   
+         const double bound = double(mOuterRadius) + mInnerRadius;
+         if (n * n - m + bound * bound < 0)
+            return result;
+
+         // Reduce to a depressed quartic, reversing it if its linear   
+         // term is too close to zero                                   
+         double po = 1;
+         double k = (m - r2 - R2) * 0.5;
+         double k3 = n;
+         double k2 = n * n + R2 * d[2] * d[2] + k;
+         double k1 = k * n + R2 * o[2] * d[2];
+         double k0 = k * k + R2 * o[2] * o[2] - R2 * r2;
+         if (::std::abs(k3 * (k3 * k3 - k2) + k1) < 0.01) {
+            po = -1;
+            const double swap = k1;
+            k1 = k3;
+            k3 = swap;
+            k0 = 1 / k0;
+            k1 = k1 * k0;
+            k2 = k2 * k0;
+            k3 = k3 * k0;
+         }
+
+         double c2 = 2 * k2 - 3 * k3 * k3;
+         double c1 = k3 * (k3 * k3 - k2) + k1;
+         double c0 = k3 * (k3 * (-3 * k3 * k3 + 4 * k2) - 8 * k1) + 4 * k0;
+         c2 /= 3;
+         c1 *= 2;
+         c0 /= 3;
+
+         // Solve the resolvent cubic                                   
+         const double Q = c2 * c2 + c0;
+         const double R = 3 * c0 * c2 - c2 * c2 * c2 - c1 * c1;
+         double h = R * R - Q * Q * Q;
+         double z;
+         if (h < 0) {
+            const double sQ = ::std::sqrt(Q);
+            z = 2 * sQ * ::std::cos(::std::acos(R / (sQ * Q)) / 3);
+         }
+         else {
+            const double sQ = ::std::cbrt(::std::sqrt(h) + ::std::abs(R));
+            z = (R < 0 ? -1 : 1) * ::std::abs(sQ + Q / sQ);
+         }
+         z = c2 - z;
+
+         // Factor into two quadratics                                  
+         double d1 = z - 3 * c2;
+         double d2 = z * z - 3 * c0;
+         if (::std::abs(d1) < 1e-4) {
+            if (d2 < 0)
+               return result;
+            d2 = ::std::sqrt(d2);
+         }
+         else {
+            if (d1 < 0)
+               return result;
+            d1 = ::std::sqrt(d1 * 0.5);
+            d2 = c1 / d1;
+         }
+
+         double t = ::std::numeric_limits<double>::infinity();
+         const auto consider = [&](double root) {
+            root = po < 0 ? 2 / root : root;
+            if (root > 0 and root < t)
+               t = root;
+         };
+
+         h = d1 * d1 - z + d2;
+         if (h > 0) {
+            h = ::std::sqrt(h);
+            consider(-d1 - h - k3);
+            consider(-d1 + h - k3);
+         }
+
+         h = d1 * d1 - z - d2;
+         if (h > 0) {
+            h = ::std::sqrt(h);
+            consider(d1 - h - k3);
+            consider(d1 + h - k3);
+         }
+
+         if (t == ::std::numeric_limits<double>::infinity())
+            return result;
+
+         // Gradient of the implicit torus, in permuted space           
+         const double p[3] {o[0] + d[0] * t, o[1] + d[1] * t, o[2] + d[2] * t};
+         const double s = p[0] * p[0] + p[1] * p[1] + p[2] * p[2] - r2;
+         result.mDistance = static_cast<TypeOf<T>>(t);
+         result.mNormal[U] = static_cast<TypeOf<T>>(p[0] * (s - R2));
+         result.mNormal[V] = static_cast<TypeOf<T>>(p[1] * (s - R2));
+         result.mNormal[A] = static_cast<TypeOf<T>>(p[2] * (s + R2));
+         result.mNormal = result.mNormal.Normalize();
+         return result;
+      }
    };
 
 } // namespace Langulus::Math
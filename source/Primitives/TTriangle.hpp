@@ -7,6 +7,8 @@
 ///                                                                           
 #pragma once
 #include "Primitive.hpp"
+#include "TRay.hpp"
+#include <cmath>
 
 
 namespace Langulus
@@ -87,6 +89,165 @@ namespace Langulus
 namespace Langulus::Math
 {
 
+   namespace Inner
+   {
+
+      /// Moller-Trumbore ray-triangle test                                   
+      /// Written branchless, so that it vectorizes when called in loops over 
+      /// either rays or triangles. Both sides of the triangle are hit        
+      ///   @param o - ray origin                                             
+      ///   @param d - ray direction                                          
+      ///   @param a, b, c - triangle points                                  
+      ///   @param t - [out] distance along the ray                           
+      ///   @param u, v - [out] barycentric coordinates of b and c            
+      ///   @return true if the ray hits the triangle                         
+      template<CT::Real T> LANGULUS(INLINED)
+      constexpr bool MollerTrumbore(
+         const T(&o)[3], const T(&d)[3],
+         const T(&a)[3], const T(&b)[3], const T(&c)[3],
+         T& t, T& u, T& v
+      ) noexcept {
+         const T e1[3] {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+         const T e2[3] {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+         const T p[3] {
+            d[1] * e2[2] - d[2] * e2[1],
+            d[2] * e2[0] - d[0] * e2[2],
+            d[0] * e2[1] - d[1] * e2[0]
+         };
+
+         const T det = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+         const T inv = T(1) / (det != 0 ? det : T(1));
+         const T s[3] {o[0] - a[0], o[1] - a[1], o[2] - a[2]};
+         const T q[3] {
+            s[1] * e1[2] - s[2] * e1[1],
+            s[2] * e1[0] - s[0] * e1[2],
+            s[0] * e1[1] - s[1] * e1[0]
+         };
+
+         u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * inv;
+         v = (d[0] * q[0] + d[1] * q[1] + d[2] * q[2]) * inv;
+         t = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) * inv;
+         return (det != 0) & (u >= 0) & (v >= 0) & (u + v <= 1) & (t >= 0);
+      }
+
+      /// Per-ray setup for the watertight ray-triangle test                  
+      /// Woop, Benthin, Wald - "Watertight Ray/Triangle Intersection", 2013  
+      template<CT::Real T>
+      struct WatertightRay {
+         // Axes, permuted so that kz is the dominant ray direction     
+         int mKX, mKY, mKZ;
+         // Shear constants                                             
+         T mSX, mSY, mSZ;
+
+         constexpr WatertightRay() noexcept = default;
+         constexpr WatertightRay(const T(&d)[3]) noexcept {
+            const T ax = d[0] < 0 ? -d[0] : d[0];
+            const T ay = d[1] < 0 ? -d[1] : d[1];
+            const T az = d[2] < 0 ? -d[2] : d[2];
+            mKZ = ax > ay ? (ax > az ? 0 : 2) : (ay > az ? 1 : 2);
+            mKX = (mKZ + 1) % 3;
+            mKY = (mKX + 1) % 3;
+
+            // Swap to preserve the winding                             
+            if (d[mKZ] < 0) {
+               const int swap = mKX;
+               mKX = mKY;
+               mKY = swap;
+            }
+
+            mSZ = T(1) / d[mKZ];
+            mSX = d[mKX] * mSZ;
+            mSY = d[mKY] * mSZ;
+         }
+      };
+
+      /// Watertight ray-triangle test                                        
+      /// Never misses along shared edges and vertices of a mesh, unlike the  
+      /// Moller-Trumbore test, at a slightly higher cost. Both sides of the  
+      /// triangle are hit                                                    
+      ///   @param ray - per-ray setup                                        
+      ///   @param o - ray origin                                             
+      ///   @param a, b, c - triangle points                                  
+      ///   @param t - [out] distance along the ray                           
+      ///   @param u, v - [out] barycentric coordinates of b and c            
+      ///   @return true if the ray hits the triangle                         
+      template<CT::Real T> LANGULUS(INLINED)
+      bool Watertight(
+         const WatertightRay<T>& ray, const T(&o)[3],
+         const T(&a)[3], const T(&b)[3], const T(&c)[3],
+         T& t, T& u, T& v
+      ) noexcept {
+         const T A[3] {a[0] - o[0], a[1] - o[1], a[2] - o[2]};
+         const T B[3] {b[0] - o[0], b[1] - o[1], b[2] - o[2]};
+         const T C[3] {c[0] - o[0], c[1] - o[1], c[2] - o[2]};
+
+         // Shear and scale the points, so the ray is along +Z          
+         const T ax = A[ray.mKX] - ray.mSX * A[ray.mKZ];
+         const T ay = A[ray.mKY] - ray.mSY * A[ray.mKZ];
+         const T bx = B[ray.mKX] - ray.mSX * B[ray.mKZ];
+         const T by = B[ray.mKY] - ray.mSY * B[ray.mKZ];
+         const T cx = C[ray.mKX] - ray.mSX * C[ray.mKZ];
+         const T cy = C[ray.mKY] - ray.mSY * C[ray.mKZ];
+
+         // Scaled barycentric coordinates                              
+         T U = cx * by - cy * bx;
+         T V = ax * cy - ay * cx;
+         T W = bx * ay - by * ax;
+
+         // Fall back to double precision on edges                      
+         if constexpr (CT::Same<T, float>) {
+            if (U == 0 or V == 0 or W == 0) {
+               U = static_cast<T>(double(cx) * double(by) - double(cy) * double(bx));
+               V = static_cast<T>(double(ax) * double(cy) - double(ay) * double(cx));
+               W = static_cast<T>(double(bx) * double(ay) - double(by) * double(ax));
+            }
+         }
+
+         if (((U < 0) | (V < 0) | (W < 0)) & ((U > 0) | (V > 0) | (W > 0)))
+            return false;
+
+         const T det = U + V + W;
+         if (det == 0)
+            return false;
+
+         const T az = ray.mSZ * A[ray.mKZ];
+         const T bz = ray.mSZ * B[ray.mKZ];
+         const T cz = ray.mSZ * C[ray.mKZ];
+         const T inv = T(1) / det;
+         t = (U * az + V * bz + W * cz) * inv;
+         u = V * inv;
+         v = W * inv;
+         return t >= 0;
+      }
+
+      /// Fill a ray-triangle hit                                             
+      ///   @param ray - the ray that hit                                     
+      ///   @param a, b, c - triangle points                                  
+      ///   @param hit - whether the triangle was hit at all                  
+      ///   @param t - the distance along the ray                             
+      ///   @param u, v - barycentric coordinates of b and c                  
+      ///   @return the hit, with the normal facing the ray                   
+      template<CT::Vector T> LANGULUS(INLINED)
+      auto TriangleHit(
+         const TRay<T>& ray, const T& a, const T& b, const T& c,
+         bool hit, TypeOf<T> t, TypeOf<T> u, TypeOf<T> v
+      ) noexcept -> TRayHit<T> {
+         TRayHit<T> result;
+         if (not hit)
+            return result;
+
+         result.mDistance = t;
+         result.mU = u;
+         result.mV = v;
+         result.mNormal = (b - a).Cross(c - a).Normalize();
+         if (result.mNormal.Dot(ray.mNormal) > 0)
+            result.mNormal = result.mNormal * TypeOf<T> {-1};
+         return result;
+      }
+
+   } // namespace Langulus::Math::Inner
+
+
    ///                                                                        
    ///   A templated triangle                                                 
    ///                                                                        
@@ -223,6 +384,45 @@ namespace Langulus::Math
          }
       }
 
+      /// Intersect with a ray, using the Moller-Trumbore test                
+      ///   @param ray - the ray                                              
+      ///   @return the hit, with barycentric coordinates of second and third 
+      ///      points, and the normal facing the ray                          
+      NOD() auto Intersect(const TRay<T>& ray) const noexcept -> TRayHit<T>
+      requires (MemberCount == 3) {
+         using S = TypeOf<T>;
+         S t, u, v;
+         const bool hit = Inner::MollerTrumbore<S>(
+            {ray.mOrigin[0], ray.mOrigin[1], ray.mOrigin[2]},
+            {ray.mNormal[0], ray.mNormal[1], ray.mNormal[2]},
+            {mABC[0][0], mABC[0][1], mABC[0][2]},
+            {mABC[1][0], mABC[1][1], mABC[1][2]},
+            {mABC[2][0], mABC[2][1], mABC[2][2]},
+            t, u, v
+         );
+         return Inner::TriangleHit(ray, mABC[0], mABC[1], mABC[2], hit, t, u, v);
+      }
+
+      /// Intersect with a ray, using the watertight test, that never misses  
+      /// along edges shared with neighbouring triangles                      
+      ///   @param ray - the ray                                              
+      ///   @return the hit, with barycentric coordinates of second and third 
+      ///      points, and the normal facing the ray                          
+      NOD() auto IntersectWatertight(const TRay<T>& ray) const noexcept -> TRayHit<T>
+      requires (MemberCount == 3) {
+         using S = TypeOf<T>;
+         S t, u, v;
+         const bool hit = Inner::Watertight<S>(
+            Inner::WatertightRay<S>({ray.mNormal[0], ray.mNormal[1], ray.mNormal[2]}),
+            {ray.mOrigin[0], ray.mOrigin[1], ray.mOrigin[2]},
+            {mABC[0][0], mABC[0][1], mABC[0][2]},
+            {mABC[1][0], mABC[1][1], mABC[1][2]},
+            {mABC[2][0], mABC[2][1], mABC[2][2]},
+            t, u, v
+         );
+         return Inner::TriangleHit(ray, mABC[0], mABC[1], mABC[2], hit, t, u, v);
+      }
+
       ///   Access points                                                     
       NOD() auto& operator [] (Offset index) const noexcept {
          return mABC[index];
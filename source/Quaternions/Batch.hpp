@@ -0,0 +1,74 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "TQuaternion.hpp"
+#include "../Vectors/TVectorStream.hpp"
+
+
+namespace Langulus::Math
+{
+
+   ///                                                                        
+   ///   Batched quaternion operations                                        
+   ///                                                                        
+   ///   Rotate large amounts of vectors, and blend large amounts of          
+   /// orientations (i.e. skeletal animation). Unlike the quaternion * vector 
+   /// operator, which does two full quaternion products per vector, rotation 
+   /// here is done via two cross products, and is written branchless, so     
+   /// that loops vectorize. Streams are processed lane-wise.                 
+   ///   All quaternions are assumed to be normalized, and produce the same   
+   /// rotations as the quaternion * vector operator.                         
+   ///   All functions allow operating in place (input same as output).       
+   ///                                                                        
+   template<CT::Real T>
+   void Rotate(const TQuaternion<T>&, const TVector<T, 3>*, TVector<T, 3>*, Count) noexcept;
+   template<CT::Real T>
+   void Rotate(const TQuaternion<T>*, const TVector<T, 3>*, TVector<T, 3>*, Count) noexcept;
+   template<CT::Real T> NOD()
+   auto Rotate(const TQuaternion<T>&, const TMany<TVector<T, 3>>&) -> TMany<TVector<T, 3>>;
+   template<CT::Real T> NOD()
+   auto Rotate(const TQuaternion<T>&, const TVectorStream<T, 3>&) -> TVectorStream<T, 3>;
+   template<CT::Real T> NOD()
+   auto Rotate(const TVectorStream<T, 4>&, const TVectorStream<T, 3>&) -> TVectorStream<T, 3>;
+
+   /// Batched interpolation of orientations, sharing a single factor         
+   template<CT::Real T>
+   void Nlerp(const TQuaternion<T>*, const TQuaternion<T>*, const CT::Real auto&, TQuaternion<T>*, Count) noexcept;
+   template<CT::Real T> NOD()
+   auto Nlerp(const TMany<TQuaternion<T>>&, const TMany<TQuaternion<T>>&, const CT::Real auto&) -> TMany<TQuaternion<T>>;
+   template<CT::Real T> NOD()
+   auto Nlerp(const TVectorStream<T, 4>&, const TVectorStream<T, 4>&, const CT::Real auto&) -> TVectorStream<T, 4>;
+
+   template<CT::Real T>
+   void Slerp(const TQuaternion<T>*, const TQuaternion<T>*, const CT::Real auto&, TQuaternion<T>*, Count) noexcept;
+   template<CT::Real T> NOD()
+   auto Slerp(const TMany<TQuaternion<T>>&, const TMany<TQuaternion<T>>&, const CT::Real auto&) -> TMany<TQuaternion<T>>;
+   template<CT::Real T> NOD()
+   auto Slerp(const TVectorStream<T, 4>&, const TVectorStream<T, 4>&, const CT::Real auto&) -> TVectorStream<T, 4>;
+
+   template<CT::Real T>
+   void Squad(
+      const TQuaternion<T>*, const TQuaternion<T>*,
+      const TQuaternion<T>*, const TQuaternion<T>*,
+      const CT::Real auto&, TQuaternion<T>*, Count
+   ) noexcept;
+
+   /// Batched composition of transformations from orientation, position      
+   /// and scale, directly into 4x4 or compact affine 4x3 matrices            
+   template<CT::Real T, Count ROWS>
+   void Compose(
+      const TQuaternion<T>*, const TVector<T, 3>*, const TVector<T, 3>*,
+      TMatrix<T, 4, ROWS>*, Count
+   ) noexcept;
+   template<CT::Real T, Count ROWS>
+   void Compose(
+      const TVectorStream<T, 4>&, const TVectorStream<T, 3>&, const TVectorStream<T, 3>&,
+      TMatrix<T, 4, ROWS>*
+   );
+
+} // namespace Langulus::Math
\ No newline at end of file
@@ -0,0 +1,382 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Batch.hpp"
+#include "TQuaternion.inl"
+#include "../Vectors/TVectorStream.inl"
+
+
+namespace Langulus::Math
+{
+   namespace Inner
+   {
+
+      /// Rotate a single vector by a unit quaternion, component-wise         
+      /// Uses v' = v + w * t + q x t, where t = 2 * (q x v), which is much   
+      /// cheaper than two full quaternion products                           
+      ///   @param q - the quaternion components                              
+      ///   @param v - the vector components                                  
+      ///   @param o - [out] the rotated vector components                    
+      template<CT::Real T> LANGULUS(INLINED)
+      void Rotate(
+         T qx, T qy, T qz, const T qw,
+         const T vx, const T vy, const T vz,
+         T& ox, T& oy, T& oz
+      ) noexcept {
+         // The quaternion * vector operator rotates by the conjugate   
+         qx = -qx;
+         qy = -qy;
+         qz = -qz;
+
+         const T tx = T {2} * (qy * vz - qz * vy);
+         const T ty = T {2} * (qz * vx - qx * vz);
+         const T tz = T {2} * (qx * vy - qy * vx);
+         ox = vx + qw * tx + (qy * tz - qz * ty);
+         oy = vy + qw * ty + (qz * tx - qx * tz);
+         oz = vz + qw * tz + (qx * ty - qy * tx);
+      }
+
+      /// Interpolate two streams of quaternions lane-wise                    
+      ///   @tparam SPHERICAL - true to slerp, false to nlerp                 
+      ///   @param a - the starting orientations                              
+      ///   @param b - the target orientations                                
+      ///   @param t - the interpolation factor                               
+      ///   @return the interpolated orientations                             
+      template<bool SPHERICAL, CT::Real T>
+      auto Interpolate(const TVectorStream<T, 4>& a, const TVectorStream<T, 4>& b, const T t)
+      -> TVectorStream<T, 4> {
+         LANGULUS_ASSUME(UserAssumes, a.GetCount() == b.GetCount(),
+            "Quaternion stream size mismatch");
+
+         const Count count = a.GetCount();
+         TVectorStream<T, 4> result {count};
+         const T* ax = a.GetLane(0);
+         const T* ay = a.GetLane(1);
+         const T* az = a.GetLane(2);
+         const T* aw = a.GetLane(3);
+         const T* bx = b.GetLane(0);
+         const T* by = b.GetLane(1);
+         const T* bz = b.GetLane(2);
+         const T* bw = b.GetLane(3);
+         T* rx = result.GetLane(0);
+         T* ry = result.GetLane(1);
+         T* rz = result.GetLane(2);
+         T* rw = result.GetLane(3);
+
+         for (Offset i = 0; i < count; ++i) {
+            const T d = ax[i] * bx[i] + ay[i] * by[i] + az[i] * bz[i] + aw[i] * bw[i];
+            T k0, k1;
+            if constexpr (SPHERICAL)
+               SlerpWeights<true>(d, t, k0, k1);
+            else {
+               k0 = T {1} - t;
+               k1 = d < T {0} ? -t : t;
+            }
+
+            const T x = ax[i] * k0 + bx[i] * k1;
+            const T y = ay[i] * k0 + by[i] * k1;
+            const T z = az[i] * k0 + bz[i] * k1;
+            const T w = aw[i] * k0 + bw[i] * k1;
+            const T lengthInv = T {1} / ::std::sqrt(x * x + y * y + z * z + w * w);
+            rx[i] = x * lengthInv;
+            ry[i] = y * lengthInv;
+            rz[i] = z * lengthInv;
+            rw[i] = w * lengthInv;
+         }
+         return result;
+      }
+
+   } // namespace Langulus::Math::Inner
+
+
+   /// Rotate an array of vectors by a single quaternion                      
+   ///   @param q - the unit quaternion                                       
+   ///   @param in - the vectors to rotate                                    
+   ///   @param out - [out] the rotated vectors (can be same as in)           
+   ///   @param count - number of vectors to rotate                           
+   template<CT::Real T>
+   void Rotate(
+      const TQuaternion<T>& q, const TVector<T, 3>* in, TVector<T, 3>* out, Count count
+   ) noexcept {
+      const T qx = q.x, qy = q.y, qz = q.z, qw = q.w;
+      for (Offset i = 0; i < count; ++i) {
+         const auto& v = in[i];
+         auto& o = out[i];
+         Inner::Rotate(qx, qy, qz, qw, v.all[0], v.all[1], v.all[2],
+            o.all[0], o.all[1], o.all[2]);
+      }
+   }
+
+   /// Rotate an array of vectors, each by its own quaternion                 
+   ///   @param q - the unit quaternions, one for each vector                 
+   ///   @param in - the vectors to rotate                                    
+   ///   @param out - [out] the rotated vectors (can be same as in)           
+   ///   @param count - number of vectors to rotate                           
+   template<CT::Real T>
+   void Rotate(
+      const TQuaternion<T>* q, const TVector<T, 3>* in, TVector<T, 3>* out, Count count
+   ) noexcept {
+      for (Offset i = 0; i < count; ++i) {
+         const auto& v = in[i];
+         auto& o = out[i];
+         Inner::Rotate(q[i].x, q[i].y, q[i].z, q[i].w, v.all[0], v.all[1], v.all[2],
+            o.all[0], o.all[1], o.all[2]);
+      }
+   }
+
+   /// Rotate a container of vectors by a single quaternion                   
+   ///   @param q - the unit quaternion                                       
+   ///   @param in - the vectors to rotate                                    
+   ///   @return the rotated vectors                                          
+   template<CT::Real T>
+   auto Rotate(const TQuaternion<T>& q, const TMany<TVector<T, 3>>& in)
+   -> TMany<TVector<T, 3>> {
+      TMany<TVector<T, 3>> result;
+      if (in.GetCount()) {
+         result.template Reserve<true>(in.GetCount());
+         Rotate(q, in.GetRaw(), result.GetRaw(), in.GetCount());
+      }
+      return result;
+   }
+
+   /// Rotate a stream of vectors by a single quaternion                      
+   ///   @param q - the unit quaternion                                       
+   ///   @param in - the vectors to rotate                                    
+   ///   @return the rotated vectors                                          
+   template<CT::Real T>
+   auto Rotate(const TQuaternion<T>& q, const TVectorStream<T, 3>& in)
+   -> TVectorStream<T, 3> {
+      const Count count = in.GetCount();
+      TVectorStream<T, 3> result {count};
+      const T* vx = in.GetLane(0);
+      const T* vy = in.GetLane(1);
+      const T* vz = in.GetLane(2);
+      T* ox = result.GetLane(0);
+      T* oy = result.GetLane(1);
+      T* oz = result.GetLane(2);
+
+      const T qx = q.x, qy = q.y, qz = q.z, qw = q.w;
+      for (Offset i = 0; i < count; ++i)
+         Inner::Rotate(qx, qy, qz, qw, vx[i], vy[i], vz[i], ox[i], oy[i], oz[i]);
+      return result;
+   }
+
+   /// Rotate a stream of vectors, each by its own quaternion                 
+   ///   @param q - the unit quaternions, as a stream of x, y, z, w lanes     
+   ///   @param in - the vectors to rotate                                    
+   ///   @return the rotated vectors                                          
+   template<CT::Real T>
+   auto Rotate(const TVectorStream<T, 4>& q, const TVectorStream<T, 3>& in)
+   -> TVectorStream<T, 3> {
+      LANGULUS_ASSUME(UserAssumes, q.GetCount() == in.GetCount(),
+         "Quaternion and vector stream size mismatch");
+
+      const Count count = in.GetCount();
+      TVectorStream<T, 3> result {count};
+      const T* qx = q.GetLane(0);
+      const T* qy = q.GetLane(1);
+      const T* qz = q.GetLane(2);
+      const T* qw = q.GetLane(3);
+      const T* vx = in.GetLane(0);
+      const T* vy = in.GetLane(1);
+      const T* vz = in.GetLane(2);
+      T* ox = result.GetLane(0);
+      T* oy = result.GetLane(1);
+      T* oz = result.GetLane(2);
+
+      for (Offset i = 0; i < count; ++i) {
+         Inner::Rotate(qx[i], qy[i], qz[i], qw[i], vx[i], vy[i], vz[i],
+            ox[i], oy[i], oz[i]);
+      }
+      return result;
+   }
+
+   /// Normalized linear interpolation of arrays of quaternions               
+   ///   @param a - the starting orientations                                 
+   ///   @param b - the target orientations                                   
+   ///   @param t - the interpolation factor, shared for all                  
+   ///   @param out - [out] the interpolated orientations (can be same as a)  
+   ///   @param count - number of quaternions to interpolate                  
+   template<CT::Real T>
+   void Nlerp(
+      const TQuaternion<T>* a, const TQuaternion<T>* b,
+      const CT::Real auto& t, TQuaternion<T>* out, Count count
+   ) noexcept {
+      const T tt = static_cast<T>(t);
+      for (Offset i = 0; i < count; ++i)
+         out[i] = Math::Nlerp(a[i], b[i], tt);
+   }
+
+   /// Normalized linear interpolation of containers of quaternions           
+   ///   @param a - the starting orientations                                 
+   ///   @param b - the target orientations                                   
+   ///   @param t - the interpolation factor, shared for all                  
+   ///   @return the interpolated orientations                                
+   template<CT::Real T>
+   auto Nlerp(
+      const TMany<TQuaternion<T>>& a, const TMany<TQuaternion<T>>& b, const CT::Real auto& t
+   ) -> TMany<TQuaternion<T>> {
+      LANGULUS_ASSUME(UserAssumes, a.GetCount() == b.GetCount(),
+         "Quaternion container size mismatch");
+
+      TMany<TQuaternion<T>> result;
+      if (a.GetCount()) {
+         result.template Reserve<true>(a.GetCount());
+         Nlerp(a.GetRaw(), b.GetRaw(), t, result.GetRaw(), a.GetCount());
+      }
+      return result;
+   }
+
+   /// Normalized linear interpolation of streams of quaternions              
+   ///   @param a - the starting orientations                                 
+   ///   @param b - the target orientations                                   
+   ///   @param t - the interpolation factor, shared for all                  
+   ///   @return the interpolated orientations                                
+   template<CT::Real T>
+   auto Nlerp(
+      const TVectorStream<T, 4>& a, const TVectorStream<T, 4>& b, const CT::Real auto& t
+   ) -> TVectorStream<T, 4> {
+      return Inner::Interpolate<false>(a, b, static_cast<T>(t));
+   }
+
+   /// Spherical linear interpolation of arrays of quaternions                
+   ///   @attention uses approximate trigonometry, see Slerp                  
+   ///   @param a - the starting orientations                                 
+   ///   @param b - the target orientations                                   
+   ///   @param t - the interpolation factor, shared for all                  
+   ///   @param out - [out] the interpolated orientations (can be same as a)  
+   ///   @param count - number of quaternions to interpolate                  
+   template<CT::Real T>
+   void Slerp(
+      const TQuaternion<T>* a, const TQuaternion<T>* b,
+      const CT::Real auto& t, TQuaternion<T>* out, Count count
+   ) noexcept {
+      const T tt = static_cast<T>(t);
+      for (Offset i = 0; i < count; ++i)
+         out[i] = Math::Slerp(a[i], b[i], tt);
+   }
+
+   /// Spherical linear interpolation of containers of quaternions            
+   ///   @attention uses approximate trigonometry, see Slerp                  
+   ///   @param a - the starting orientations                                 
+   ///   @param b - the target orientations                                   
+   ///   @param t - the interpolation factor, shared for all                  
+   ///   @return the interpolated orientations                                
+   template<CT::Real T>
+   auto Slerp(
+      const TMany<TQuaternion<T>>& a, const TMany<TQuaternion<T>>& b, const CT::Real auto& t
+   ) -> TMany<TQuaternion<T>> {
+      LANGULUS_ASSUME(UserAssumes, a.GetCount() == b.GetCount(),
+         "Quaternion container size mismatch");
+
+      TMany<TQuaternion<T>> result;
+      if (a.GetCount()) {
+         result.template Reserve<true>(a.GetCount());
+         Slerp(a.GetRaw(), b.GetRaw(), t, result.GetRaw(), a.GetCount());
+      }
+      return result;
+   }
+
+   /// Spherical linear interpolation of streams of quaternions               
+   ///   @attention uses approximate trigonometry, see Slerp                  
+   ///   @param a - the starting orientations                                 
+   ///   @param b - the target orientations                                   
+   ///   @param t - the interpolation factor, shared for all                  
+   ///   @return the interpolated orientations                                
+   template<CT::Real T>
+   auto Slerp(
+      const TVectorStream<T, 4>& a, const TVectorStream<T, 4>& b, const CT::Real auto& t
+   ) -> TVectorStream<T, 4> {
+      return Inner::Interpolate<true>(a, b, static_cast<T>(t));
+   }
+
+   /// Spherical quadrangle interpolation of arrays of quaternions            
+   ///   @attention uses approximate trigonometry, see Slerp                  
+   ///   @param q0 - the orientations at the start of the segments            
+   ///   @param q1 - the orientations at the end of the segments              
+   ///   @param s0 - the control points of q0, see SquadControl               
+   ///   @param s1 - the control points of q1, see SquadControl               
+   ///   @param t - the interpolation factor, shared for all                  
+   ///   @param out - [out] the interpolated orientations (can be same as q0) 
+   ///   @param count - number of quaternions to interpolate                  
+   template<CT::Real T>
+   void Squad(
+      const TQuaternion<T>* q0, const TQuaternion<T>* q1,
+      const TQuaternion<T>* s0, const TQuaternion<T>* s1,
+      const CT::Real auto& t, TQuaternion<T>* out, Count count
+   ) noexcept {
+      const T tt = static_cast<T>(t);
+      for (Offset i = 0; i < count; ++i)
+         out[i] = Math::Squad(q0[i], q1[i], s0[i], s1[i], tt);
+   }
+
+   /// Compose transformations from arrays of orientations, positions and     
+   /// scales, writing directly into the matrices - each one is composed the  
+   /// same way as A::Matrix::From (or A::Matrix::FromAffine for 4x3)         
+   ///   @param q - the orientations                                          
+   ///   @param p - the positions                                             
+   ///   @param s - the scales                                                
+   ///   @param out - [out] the composed matrices                             
+   ///   @param count - number of transformations to compose                  
+   template<CT::Real T, Count ROWS>
+   void Compose(
+      const TQuaternion<T>* q, const TVector<T, 3>* p, const TVector<T, 3>* s,
+      TMatrix<T, 4, ROWS>* out, Count count
+   ) noexcept {
+      static_assert(ROWS == 4 or ROWS == 3,
+         "Can only compose 4x4, or compact affine 4x3 matrices");
+
+      for (Offset i = 0; i < count; ++i) {
+         if constexpr (ROWS == 4)
+            out[i] = A::Matrix::From<TVector<T, 3>>(q[i], p[i], s[i]);
+         else
+            out[i] = A::Matrix::FromAffine<TVector<T, 3>>(q[i], p[i], s[i]);
+      }
+   }
+
+   /// Compose transformations from streams of orientations, positions and    
+   /// scales, writing directly into the matrices                             
+   ///   @param q - the orientations, as a stream of x, y, z, w lanes         
+   ///   @param p - the positions                                             
+   ///   @param s - the scales                                                
+   ///   @param out - [out] the composed matrices, must have enough room      
+   template<CT::Real T, Count ROWS>
+   void Compose(
+      const TVectorStream<T, 4>& q, const TVectorStream<T, 3>& p, const TVectorStream<T, 3>& s,
+      TMatrix<T, 4, ROWS>* out
+   ) {
+      static_assert(ROWS == 4 or ROWS == 3,
+         "Can only compose 4x4, or compact affine 4x3 matrices");
+      LANGULUS_ASSUME(UserAssumes,
+         q.GetCount() == p.GetCount() and q.GetCount() == s.GetCount(),
+         "Orientation, position and scale stream size mismatch");
+
+      const Count count = q.GetCount();
+      const T* qx = q.GetLane(0);
+      const T* qy = q.GetLane(1);
+      const T* qz = q.GetLane(2);
+      const T* qw = q.GetLane(3);
+      const T* px = p.GetLane(0);
+      const T* py = p.GetLane(1);
+      const T* pz = p.GetLane(2);
+      const T* sx = s.GetLane(0);
+      const T* sy = s.GetLane(1);
+      const T* sz = s.GetLane(2);
+
+      for (Offset i = 0; i < count; ++i) {
+         const TQuaternion<T> orientation {qx[i], qy[i], qz[i], qw[i]};
+         const TVector<T, 3> position {px[i], py[i], pz[i]};
+         const TVector<T, 3> scale {sx[i], sy[i], sz[i]};
+         if constexpr (ROWS == 4)
+            out[i] = A::Matrix::From<TVector<T, 3>>(orientation, position, scale);
+         else
+            out[i] = A::Matrix::FromAffine<TVector<T, 3>>(orientation, position, scale);
+      }
+   }
+
+} // namespace Langulus::Math
\ No newline at end of file
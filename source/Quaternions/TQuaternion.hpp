@@ -162,4 +162,22 @@ namespace Langulus::Math
    NOD() constexpr auto operator / (const CT::QuaternionBased auto&, const CT::ScalarBased auto&);
    NOD() constexpr auto operator / (const CT::ScalarBased auto&, const CT::QuaternionBased auto&);
 
+   ///                                                                        
+   ///   Interpolation                                                        
+   ///                                                                        
+   namespace Inner
+   {
+      template<bool SHORTEST, CT::Real T>
+      void SlerpWeights(T, T, T&, T&) noexcept;
+   }
+
+   template<CT::Real T> NOD()
+   auto Nlerp(const TQuaternion<T>&, const TQuaternion<T>&, const CT::Real auto&) noexcept -> TQuaternion<T>;
+   template<CT::Real T> NOD()
+   auto Slerp(const TQuaternion<T>&, const TQuaternion<T>&, const CT::Real auto&) noexcept -> TQuaternion<T>;
+   template<CT::Real T> NOD()
+   auto Squad(const TQuaternion<T>&, const TQuaternion<T>&, const TQuaternion<T>&, const TQuaternion<T>&, const CT::Real auto&) noexcept -> TQuaternion<T>;
+   template<CT::Real T> NOD()
+   auto SquadControl(const TQuaternion<T>&, const TQuaternion<T>&, const TQuaternion<T>&) noexcept -> TQuaternion<T>;
+
 } // namespace Langulus::Math
\ No newline at end of file
@@ -412,6 +412,168 @@ namespace Langulus::Math
       return Q {SIMD::Divide(lhs, rhs)};
    }
 
+
+   ///                                                                        
+   ///   Interpolation                                                        
+   ///                                                                        
+   namespace Inner
+   {
+
+      /// Quaternions closer than this are interpolated linearly, because     
+      /// the sine of the angle between them gets too small to divide by      
+      template<CT::Real T>
+      constexpr T SlerpThreshold = T {0.9995};
+
+      /// Compute the weights of two quaternions for spherical interpolation  
+      /// This is the core of all slerp kernels - it is branchless, and       
+      /// uses FastAcos and FastSin, so it vectorizes when inlined in loops   
+      ///   @attention combined with a normalization of the weighted sum,     
+      ///      the resulting rotation deviates from the exact slerp by less   
+      ///      than 2e-5 radians (in double precision)                        
+      ///   @tparam SHORTEST - whether to flip the second quaternion, if it   
+      ///      is on the other hemisphere, taking the shortest path           
+      ///   @param cosTheta - the dot product of the two quaternions          
+      ///   @param t - the interpolation factor                               
+      ///   @param k0 - [out] the weight of the first quaternion              
+      ///   @param k1 - [out] the weight of the second quaternion             
+      template<bool SHORTEST, CT::Real T> LANGULUS(INLINED)
+      void SlerpWeights(T cosTheta, T t, T& k0, T& k1) noexcept {
+         T sign {1};
+         if constexpr (SHORTEST) {
+            sign = cosTheta < 0 ? T {-1} : T {1};
+            cosTheta *= sign;
+         }
+
+         // Nearly antipodal quaternions can only occur when not taking 
+         // the shortest path - their sine is clamped to avoid infinity 
+         const bool linear = cosTheta > SlerpThreshold<T>;
+         const T theta = FastAcos(linear ? T {0} : cosTheta);
+         const T sinTheta = linear ? T {1} : FastSin(theta);
+         const T sinThetaInv = T {1} / (sinTheta > T {1e-6} ? sinTheta : T {1e-6});
+         k0 = linear ? T {1} - t : FastSin((T {1} - t) * theta) * sinThetaInv;
+         k1 = (linear ? t : FastSin(t * theta) * sinThetaInv) * sign;
+      }
+
+      /// Dot product of two quaternions                                      
+      template<CT::Real T> LANGULUS(INLINED)
+      constexpr T Dot(const TQuaternion<T>& a, const TQuaternion<T>& b) noexcept {
+         return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+      }
+
+      /// Normalize a weighted sum of two quaternions                         
+      /// The length is never zero for unit quaternions, since the weights    
+      /// are either both positive, or the quaternions are far apart          
+      template<CT::Real T> LANGULUS(INLINED)
+      TQuaternion<T> BlendNormalized(
+         const TQuaternion<T>& a, const TQuaternion<T>& b, T k0, T k1
+      ) noexcept {
+         T r[4];
+         T lengthSquared {};
+         for (Offset i = 0; i < 4; ++i) {
+            r[i] = a.all[i] * k0 + b.all[i] * k1;
+            lengthSquared += r[i] * r[i];
+         }
+
+         const T lengthInv = T {1} / ::std::sqrt(lengthSquared);
+         return {r[0] * lengthInv, r[1] * lengthInv, r[2] * lengthInv, r[3] * lengthInv};
+      }
+
+      /// Logarithm of a unit quaternion - the result has a zero real part    
+      template<CT::Real T>
+      TQuaternion<T> Log(const TQuaternion<T>& q) noexcept {
+         const T w = q.w < T {-1} ? T {-1} : (q.w > T {1} ? T {1} : q.w);
+         const T sinTheta = ::std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z);
+         const T k = sinTheta > T {0} ? ::std::acos(w) / sinTheta : T {1};
+         return {q.x * k, q.y * k, q.z * k, T {0}};
+      }
+
+      /// Exponent of a quaternion with zero real part                        
+      template<CT::Real T>
+      TQuaternion<T> Exp(const TQuaternion<T>& q) noexcept {
+         const T theta = ::std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z);
+         const T k = theta > T {0} ? ::std::sin(theta) / theta : T {1};
+         return {q.x * k, q.y * k, q.z * k, ::std::cos(theta)};
+      }
+
+   } // namespace Langulus::Math::Inner
+
+   /// Normalized linear interpolation between two unit quaternions           
+   /// Takes the shortest path, but doesn't have a constant angular velocity  
+   ///   @param a - the starting orientation                                  
+   ///   @param b - the target orientation                                    
+   ///   @param t - the interpolation factor in the [0, 1] range              
+   ///   @return the interpolated unit quaternion                             
+   template<CT::Real T> LANGULUS(INLINED)
+   auto Nlerp(const TQuaternion<T>& a, const TQuaternion<T>& b, const CT::Real auto& t) noexcept -> TQuaternion<T> {
+      const T k1 = Inner::Dot(a, b) < T {0} ? -static_cast<T>(t) : static_cast<T>(t);
+      return Inner::BlendNormalized(a, b, T {1} - static_cast<T>(t), k1);
+   }
+
+   /// Spherical linear interpolation between two unit quaternions            
+   /// Takes the shortest path with constant angular velocity                 
+   ///   @attention uses approximate trigonometry - the result deviates from  
+   ///      the exact slerp by less than 2e-5 radians of rotation             
+   ///   @param a - the starting orientation                                  
+   ///   @param b - the target orientation                                    
+   ///   @param t - the interpolation factor in the [0, 1] range              
+   ///   @return the interpolated unit quaternion                             
+   template<CT::Real T> LANGULUS(INLINED)
+   auto Slerp(const TQuaternion<T>& a, const TQuaternion<T>& b, const CT::Real auto& t) noexcept -> TQuaternion<T> {
+      T k0, k1;
+      Inner::SlerpWeights<true>(Inner::Dot(a, b), static_cast<T>(t), k0, k1);
+      return Inner::BlendNormalized(a, b, k0, k1);
+   }
+
+   /// Spherical quadrangle interpolation - a smooth curve through a series   
+   /// of orientations, with continuous angular velocity at the keys          
+   ///   @attention uses approximate trigonometry, same as Slerp              
+   ///   @param q0 - the orientation at the start of the segment              
+   ///   @param q1 - the orientation at the end of the segment                
+   ///   @param s0 - the control point of q0, see SquadControl                
+   ///   @param s1 - the control point of q1, see SquadControl                
+   ///   @param t - the interpolation factor in the [0, 1] range              
+   ///   @return the interpolated unit quaternion                             
+   template<CT::Real T> LANGULUS(INLINED)
+   auto Squad(
+      const TQuaternion<T>& q0, const TQuaternion<T>& q1,
+      const TQuaternion<T>& s0, const TQuaternion<T>& s1,
+      const CT::Real auto& t
+   ) noexcept -> TQuaternion<T> {
+      const T tt = static_cast<T>(t);
+      T k0, k1;
+      Inner::SlerpWeights<false>(Inner::Dot(q0, q1), tt, k0, k1);
+      const auto outer = Inner::BlendNormalized(q0, q1, k0, k1);
+      Inner::SlerpWeights<false>(Inner::Dot(s0, s1), tt, k0, k1);
+      const auto inner = Inner::BlendNormalized(s0, s1, k0, k1);
+      Inner::SlerpWeights<false>(Inner::Dot(outer, inner), T {2} * tt * (T {1} - tt), k0, k1);
+      return Inner::BlendNormalized(outer, inner, k0, k1);
+   }
+
+   /// Compute the Squad control point of a key, from its neighbours          
+   /// These are usually computed once per key, so exact trigonometry is used 
+   ///   @param prev - the previous key                                       
+   ///   @param current - the key to compute the control point of             
+   ///   @param next - the next key                                           
+   ///   @return the control point                                            
+   template<CT::Real T>
+   auto SquadControl(
+      const TQuaternion<T>& prev, const TQuaternion<T>& current, const TQuaternion<T>& next
+   ) noexcept -> TQuaternion<T> {
+      // Make sure neighbours are on the same hemisphere as the key     
+      const auto p = Inner::Dot(current, prev) < T {0} ? prev * T {-1} : prev;
+      const auto n = Inner::Dot(current, next) < T {0} ? next * T {-1} : next;
+      const auto inverse = current.Conjugate();
+      const auto logNext = Inner::Log(TQuaternion<T> {inverse * n});
+      const auto logPrev = Inner::Log(TQuaternion<T> {inverse * p});
+      const TQuaternion<T> tangent {
+         (logNext.x + logPrev.x) * T {-0.25},
+         (logNext.y + logPrev.y) * T {-0.25},
+         (logNext.z + logPrev.z) * T {-0.25},
+         T {0}
+      };
+      return TQuaternion<T> {current * Inner::Exp(tangent)};
+   }
+
 } // namespace Langulus::Math
 
 namespace Langulus::A
@@ -423,11 +585,35 @@ namespace Langulus::A
    ///   @param p - the position vector                                       
    ///   @param s - the scale vector                                          
    ///   @return the composed matrix                                          
-   template<CT::VectorBased T>
-   NOD() constexpr Math::TMatrix<TypeOf<T>, T::MemberCount + 1>
-   Matrix::From(const Math::TQuaternion<TypeOf<T>>& q, const T& p, const T& s) noexcept {
+   template<CT::VectorBased T> LANGULUS(INLINED)
+   constexpr auto Matrix::From(const Math::TQuaternion<TypeOf<T>>& q, const T& p, const T& s) noexcept
+   -> Math::TMatrix<TypeOf<T>, T::MemberCount + 1> {
+      return Compose<Math::TMatrix<TypeOf<T>, T::MemberCount + 1>>(q, p, s);
+   }
+
+   /// Compose a compact affine transformation matrix, that doesn't store     
+   /// the last (0, ..., 0, 1) row, by combining position, orientation and    
+   /// scale. Results in the same transformation as Matrix::From              
+   ///   @param q - the orientation quaternion                                
+   ///   @param p - the position vector                                       
+   ///   @param s - the scale vector                                          
+   ///   @return the composed affine matrix                                   
+   template<CT::VectorBased T> LANGULUS(INLINED)
+   constexpr auto Matrix::FromAffine(const Math::TQuaternion<TypeOf<T>>& q, const T& p, const T& s) noexcept
+   -> Math::TMatrix<TypeOf<T>, T::MemberCount + 1, T::MemberCount> {
+      return Compose<Math::TMatrix<TypeOf<T>, T::MemberCount + 1, T::MemberCount>>(q, p, s);
+   }
+
+   /// Compose a transformation matrix of any kind                            
+   ///   @tparam M - the matrix type to compose                               
+   ///   @param q - the orientation quaternion                                
+   ///   @param p - the position vector                                       
+   ///   @param s - the scale vector                                          
+   ///   @return the composed matrix                                          
+   template<class M, CT::VectorBased T>
+   constexpr auto Matrix::Compose(const Math::TQuaternion<TypeOf<T>>& q, const T& p, const T& s) noexcept -> M {
       using K = TypeOf<T>;
-      Math::TMatrix<K, T::MemberCount + 1> result;
+      M result;
       auto x2 = q.x + q.x;
       auto y2 = q.y + q.y;
       auto z2 = q.z + q.z;
@@ -0,0 +1,71 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Philox.hpp"
+#include "../Ranges/TRange.hpp"
+#include "../Vectors/TVectorStream.hpp"
+#include "../Quaternions/TQuaternion.hpp"
+
+
+namespace Langulus::Math
+{
+
+   ///                                                                        
+   ///   Bulk random distributions                                            
+   ///                                                                        
+   ///   Fill whole arrays of numbers, vectors, colors and orientations.      
+   /// Random words are drawn in chunks via RNG::Fill(), and then mapped by   
+   /// branchless loops over the chunk, so that scattering large amounts of   
+   /// particles is bound by memory, and not by the generator.                
+   ///   Real components in a range are in [min:max), integer components in   
+   /// [min:max]. Normal deviates are made via the Box-Muller transform.      
+   ///                                                                        
+   template<CT::VectorBased T>
+   void RandomUniform(RNG&, const TRange<T>&, T*, Count) noexcept;
+   template<CT::VectorBased T> NOD()
+   auto RandomUniform(RNG&, const TRange<T>&, Count) -> TMany<T>;
+   template<CT::Real T, Count S>
+   void RandomUniform(RNG&, const TRange<TVector<T, S>>&, TVectorStream<T, S>&) noexcept;
+
+   /// Directions, uniformly distributed on the surface of a sphere, or       
+   /// points uniformly distributed inside it, around the origin              
+   template<CT::VectorBased T>
+   void RandomOnSphere(RNG&, T*, Count, TypeOf<T> radius = 1) noexcept;
+   template<CT::VectorBased T> NOD()
+   auto RandomOnSphere(RNG&, Count, TypeOf<T> radius = 1) -> TMany<T>;
+   template<CT::Real T, Count S>
+   void RandomOnSphere(RNG&, TVectorStream<T, S>&, T radius = 1) noexcept;
+
+   template<CT::VectorBased T>
+   void RandomInBall(RNG&, T*, Count, TypeOf<T> radius = 1) noexcept;
+   template<CT::VectorBased T> NOD()
+   auto RandomInBall(RNG&, Count, TypeOf<T> radius = 1) -> TMany<T>;
+   template<CT::Real T, Count S>
+   void RandomInBall(RNG&, TVectorStream<T, S>&, T radius = 1) noexcept;
+
+   /// Orientations, uniformly distributed over all rotations                 
+   template<CT::Real T>
+   void RandomRotation(RNG&, TQuaternion<T>*, Count) noexcept;
+   template<CT::Real T> NOD()
+   auto RandomRotation(RNG&, Count) -> TMany<TQuaternion<T>>;
+
+   /// Normally distributed numbers or vectors (component-wise)               
+   template<CT::Real T>
+   void RandomNormal(RNG&, T*, Count, T mean = 0, T sigma = 1) noexcept;
+   template<CT::Real T> NOD()
+   auto RandomNormal(RNG&, Count, T mean = 0, T sigma = 1) -> TMany<T>;
+   template<CT::VectorBased T>
+   void RandomNormal(RNG&, T*, Count, const T& mean, const T& sigma) noexcept;
+
+   /// Exponentially distributed numbers, with the given rate                 
+   template<CT::Real T>
+   void RandomExponential(RNG&, T*, Count, T rate = 1) noexcept;
+   template<CT::Real T> NOD()
+   auto RandomExponential(RNG&, Count, T rate = 1) -> TMany<T>;
+
+} // namespace Langulus::Math
\ No newline at end of file
@@ -0,0 +1,448 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Distributions.hpp"
+#include "../Ranges/TRange.inl"
+#include "../Vectors/TVectorStream.inl"
+#include "../Quaternions/TQuaternion.inl"
+#include "../Functions/Trigonometry.hpp"
+#include <cmath>
+
+
+namespace Langulus::Math
+{
+   namespace Inner
+   {
+
+      /// Number of scalars generated per pass                                
+      constexpr Count RandomChunk = 256;
+
+      /// Map uniform numbers from [-1:1) to (0:1], safe for logarithms       
+      template<CT::Real T> LANGULUS(INLINED)
+      T RandomOpenUnit(T u) noexcept {
+         return (T {1} - u) * T {0.5};
+      }
+
+      /// Generate standard normal deviates via the Box-Muller transform      
+      ///   @param rng - the generator                                        
+      ///   @param out - [out] the deviates                                   
+      ///   @param count - number of deviates, at most RandomChunk            
+      template<CT::Real T>
+      void StandardNormal(RNG& rng, T* out, Count count) noexcept {
+         // Deviates come in pairs, the last one might be dropped       
+         const Count pairs = (count + 1) / 2;
+         T u[RandomChunk];
+         T z[RandomChunk];
+         rng.Fill(::std::span<T> {u, pairs * 2});
+
+         for (Offset i = 0; i < pairs; ++i) {
+            const T r = ::std::sqrt(T {-2} * ::std::log(RandomOpenUnit(u[i * 2])));
+            const T a = PI<T> * u[i * 2 + 1];
+            z[i * 2]     = r * ::std::cos(a);
+            z[i * 2 + 1] = r * ::std::sin(a);
+         }
+
+         for (Offset i = 0; i < count; ++i)
+            out[i] = z[i];
+      }
+
+      /// Generate directions, uniformly distributed on a unit sphere         
+      ///   @param rng - the generator                                        
+      ///   @param out - [out] the direction components, lane-wise            
+      ///   @param count - number of directions, at most RandomChunk / 4      
+      template<CT::Real T, Count S>
+      void RandomDirections(RNG& rng, T (&out)[S][RandomChunk / 4], Count count) noexcept {
+         T u[RandomChunk];
+         if constexpr (S == 1) {
+            rng.Fill(::std::span<T> {u, count});
+            for (Offset i = 0; i < count; ++i)
+               out[0][i] = u[i] < T {0} ? T {-1} : T {1};
+         }
+         else if constexpr (S == 2) {
+            rng.Fill(::std::span<T> {u, count});
+            for (Offset i = 0; i < count; ++i) {
+               const T a = PI<T> * u[i];
+               out[0][i] = ::std::cos(a);
+               out[1][i] = ::std::sin(a);
+            }
+         }
+         else if constexpr (S == 3) {
+            // Archimedes - uniform height and angle around the axis    
+            // make for a uniform distribution on the surface           
+            rng.Fill(::std::span<T> {u, count * 2});
+            for (Offset i = 0; i < count; ++i) {
+               const T z = u[i * 2];
+               const T r = ::std::sqrt(::std::max(T {0}, T {1} - z * z));
+               const T a = PI<T> * u[i * 2 + 1];
+               out[0][i] = r * ::std::cos(a);
+               out[1][i] = r * ::std::sin(a);
+               out[2][i] = z;
+            }
+         }
+         else {
+            // Normalized vectors of normal deviates are uniform in any 
+            // number of dimensions                                     
+            T length[RandomChunk / 4] {};
+            for (Offset c = 0; c < S; ++c) {
+               StandardNormal(rng, out[c], count);
+               for (Offset i = 0; i < count; ++i)
+                  length[i] += out[c][i] * out[c][i];
+            }
+
+            for (Offset i = 0; i < count; ++i)
+               length[i] = length[i] > T {0} ? T {1} / ::std::sqrt(length[i]) : T {0};
+            for (Offset c = 0; c < S; ++c)
+               for (Offset i = 0; i < count; ++i)
+                  out[c][i] *= length[i];
+         }
+      }
+
+      /// Generate points on, or inside a sphere, a chunk at a time           
+      ///   @tparam INSIDE - true to fill the ball, false for the surface     
+      ///   @param rng - the generator                                        
+      ///   @param count - number of points                                   
+      ///   @param radius - radius of the sphere                              
+      ///   @param write - called for each generated chunk, with the          
+      ///      components, the offset of the chunk, and its size              
+      template<bool INSIDE, CT::Real T, Count S, class F>
+      void RandomSphere(RNG& rng, Count count, T radius, F&& write) noexcept {
+         constexpr Count Chunk = RandomChunk / 4;
+         T d[S][Chunk];
+         T u[Chunk];
+         for (Offset start = 0; start < count; start += Chunk) {
+            const Count n = ::std::min(Chunk, count - start);
+            RandomDirections<T, S>(rng, d, n);
+
+            if constexpr (INSIDE) {
+               // Volume grows with the S-th power of the radius        
+               rng.Fill(::std::span<T> {u, n});
+               for (Offset i = 0; i < n; ++i) {
+                  const T v = RandomOpenUnit(u[i]);
+                  if constexpr (S == 1)
+                     u[i] = radius * v;
+                  else if constexpr (S == 2)
+                     u[i] = radius * ::std::sqrt(v);
+                  else if constexpr (S == 3)
+                     u[i] = radius * ::std::cbrt(v);
+                  else
+                     u[i] = radius * ::std::pow(v, T {1} / T {S});
+               }
+            }
+            else {
+               for (Offset i = 0; i < n; ++i)
+                  u[i] = radius;
+            }
+
+            for (Offset c = 0; c < S; ++c)
+               for (Offset i = 0; i < n; ++i)
+                  d[c][i] *= u[i];
+            write(d, start, n);
+         }
+      }
+
+      /// Write chunks of components to an array of vectors                   
+      template<CT::VectorBased T>
+      auto RandomWriter(T* out) noexcept {
+         using ScalarType = TypeOf<T>;
+         constexpr Count S = T::MemberCount;
+         static_assert(CT::Real<ScalarType>, "Vector must contain reals");
+         return [out](const ScalarType (&d)[S][RandomChunk / 4], Offset start, Count n) {
+            for (Offset i = 0; i < n; ++i)
+               for (Offset c = 0; c < S; ++c)
+                  out[start + i].all[c] = d[c][i];
+         };
+      }
+
+      /// Write chunks of components to a vector stream                       
+      template<CT::Real T, Count S>
+      auto RandomWriter(TVectorStream<T, S>& out) noexcept {
+         return [&out](const T (&d)[S][RandomChunk / 4], Offset start, Count n) {
+            for (Offset c = 0; c < S; ++c) {
+               T* lane = out.GetLane(c) + start;
+               for (Offset i = 0; i < n; ++i)
+                  lane[i] = d[c][i];
+            }
+         };
+      }
+
+   } // namespace Langulus::Math::Inner
+
+
+   /// Fill an array with vectors or colors, uniformly distributed in a range 
+   ///   @param rng - the generator                                           
+   ///   @param range - the range, component-wise                             
+   ///   @param out - [out] the generated values                              
+   ///   @param count - number of values to generate                          
+   template<CT::VectorBased T>
+   void RandomUniform(RNG& rng, const TRange<T>& range, T* out, Count count) noexcept {
+      using ScalarType = TypeOf<T>;
+      constexpr Count S = T::MemberCount;
+
+      if constexpr (CT::Real<ScalarType>) {
+         constexpr Count Chunk = Inner::RandomChunk / 4;
+         ScalarType center[S], half[S];
+         for (Offset c = 0; c < S; ++c) {
+            center[c] = (range.mMax.all[c] + range.mMin.all[c]) * ScalarType {0.5};
+            half[c]   = (range.mMax.all[c] - range.mMin.all[c]) * ScalarType {0.5};
+         }
+
+         ScalarType u[Chunk * S];
+         for (Offset start = 0; start < count; start += Chunk) {
+            const Count n = ::std::min(Chunk, count - start);
+            rng.Fill(::std::span<ScalarType> {u, n * S});
+            for (Offset i = 0; i < n; ++i)
+               for (Offset c = 0; c < S; ++c)
+                  out[start + i].all[c] = center[c] + half[c] * u[i * S + c];
+         }
+      }
+      else {
+         // Integers are generated one at a time, to stay unbiased      
+         for (Offset i = 0; i < count; ++i) {
+            for (Offset c = 0; c < S; ++c) {
+               const auto min = range.mMin.all[c];
+               const auto max = range.mMax.all[c];
+               out[i].all[c] = min < max ? rng.template Get<ScalarType>(min, max) : min;
+            }
+         }
+      }
+   }
+
+   /// Generate vectors or colors, uniformly distributed in a range           
+   ///   @param rng - the generator                                           
+   ///   @param range - the range, component-wise                             
+   ///   @param count - number of values to generate                          
+   ///   @return the generated values                                         
+   template<CT::VectorBased T>
+   auto RandomUniform(RNG& rng, const TRange<T>& range, Count count) -> TMany<T> {
+      TMany<T> result;
+      if (count) {
+         result.template Reserve<true>(count);
+         RandomUniform(rng, range, result.GetRaw(), count);
+      }
+      return result;
+   }
+
+   /// Fill a vector stream with vectors, uniformly distributed in a range    
+   /// Lanes are generated straight in place                                  
+   ///   @param rng - the generator                                           
+   ///   @param range - the range, component-wise                             
+   ///   @param out - [in/out] the stream to fill, all GetCount() vectors     
+   template<CT::Real T, Count S>
+   void RandomUniform(RNG& rng, const TRange<TVector<T, S>>& range, TVectorStream<T, S>& out) noexcept {
+      const Count count = out.GetCount();
+      for (Offset c = 0; c < S; ++c) {
+         const T center = (range.mMax.all[c] + range.mMin.all[c]) * T {0.5};
+         const T half   = (range.mMax.all[c] - range.mMin.all[c]) * T {0.5};
+         T* lane = out.GetLane(c);
+         rng.Fill(::std::span<T> {lane, count});
+         for (Offset i = 0; i < count; ++i)
+            lane[i] = center + half * lane[i];
+      }
+   }
+
+   /// Fill an array with points, uniformly distributed on a sphere           
+   ///   @param rng - the generator                                           
+   ///   @param out - [out] the generated points                              
+   ///   @param count - number of points to generate                          
+   ///   @param radius - the radius of the sphere                             
+   template<CT::VectorBased T>
+   void RandomOnSphere(RNG& rng, T* out, Count count, TypeOf<T> radius) noexcept {
+      Inner::RandomSphere<false, TypeOf<T>, T::MemberCount>(
+         rng, count, radius, Inner::RandomWriter(out));
+   }
+
+   /// Generate points, uniformly distributed on a sphere                     
+   ///   @param rng - the generator                                           
+   ///   @param count - number of points to generate                          
+   ///   @param radius - the radius of the sphere                             
+   ///   @return the generated points                                         
+   template<CT::VectorBased T>
+   auto RandomOnSphere(RNG& rng, Count count, TypeOf<T> radius) -> TMany<T> {
+      TMany<T> result;
+      if (count) {
+         result.template Reserve<true>(count);
+         RandomOnSphere(rng, result.GetRaw(), count, radius);
+      }
+      return result;
+   }
+
+   /// Fill a vector stream with points, uniformly distributed on a sphere    
+   ///   @param rng - the generator                                           
+   ///   @param out - [in/out] the stream to fill, all GetCount() vectors     
+   ///   @param radius - the radius of the sphere                             
+   template<CT::Real T, Count S>
+   void RandomOnSphere(RNG& rng, TVectorStream<T, S>& out, T radius) noexcept {
+      Inner::RandomSphere<false, T, S>(
+         rng, out.GetCount(), radius, Inner::RandomWriter(out));
+   }
+
+   /// Fill an array with points, uniformly distributed inside a sphere       
+   ///   @param rng - the generator                                           
+   ///   @param out - [out] the generated points                              
+   ///   @param count - number of points to generate                          
+   ///   @param radius - the radius of the sphere                             
+   template<CT::VectorBased T>
+   void RandomInBall(RNG& rng, T* out, Count count, TypeOf<T> radius) noexcept {
+      Inner::RandomSphere<true, TypeOf<T>, T::MemberCount>(
+         rng, count, radius, Inner::RandomWriter(out));
+   }
+
+   /// Generate points, uniformly distributed inside a sphere                 
+   ///   @param rng - the generator                                           
+   ///   @param count - number of points to generate                          
+   ///   @param radius - the radius of the sphere                             
+   ///   @return the generated points                                         
+   template<CT::VectorBased T>
+   auto RandomInBall(RNG& rng, Count count, TypeOf<T> radius) -> TMany<T> {
+      TMany<T> result;
+      if (count) {
+         result.template Reserve<true>(count);
+         RandomInBall(rng, result.GetRaw(), count, radius);
+      }
+      return result;
+   }
+
+   /// Fill a vector stream with points, uniformly distributed inside a sphere
+   ///   @param rng - the generator                                           
+   ///   @param out - [in/out] the stream to fill, all GetCount() vectors     
+   ///   @param radius - the radius of the sphere                             
+   template<CT::Real T, Count S>
+   void RandomInBall(RNG& rng, TVectorStream<T, S>& out, T radius) noexcept {
+      Inner::RandomSphere<true, T, S>(
+         rng, out.GetCount(), radius, Inner::RandomWriter(out));
+   }
+
+   /// Fill an array with uniformly distributed rotations                     
+   /// Credit to Ken Shoemake - "Uniform random rotations"                    
+   ///   @param rng - the generator                                           
+   ///   @param out - [out] the generated unit quaternions                    
+   ///   @param count - number of quaternions to generate                     
+   template<CT::Real T>
+   void RandomRotation(RNG& rng, TQuaternion<T>* out, Count count) noexcept {
+      constexpr Count Chunk = Inner::RandomChunk / 4;
+      T u[Chunk * 3];
+      for (Offset start = 0; start < count; start += Chunk) {
+         const Count n = ::std::min(Chunk, count - start);
+         rng.Fill(::std::span<T> {u, n * 3});
+         for (Offset i = 0; i < n; ++i) {
+            const T t  = (u[i * 3] + T {1}) * T {0.5};
+            const T s1 = ::std::sqrt(T {1} - t);
+            const T s2 = ::std::sqrt(t);
+            const T a1 = PI<T> * u[i * 3 + 1];
+            const T a2 = PI<T> * u[i * 3 + 2];
+            auto& q = out[start + i];
+            q.x = s1 * ::std::sin(a1);
+            q.y = s1 * ::std::cos(a1);
+            q.z = s2 * ::std::sin(a2);
+            q.w = s2 * ::std::cos(a2);
+         }
+      }
+   }
+
+   /// Generate uniformly distributed rotations                               
+   ///   @param rng - the generator                                           
+   ///   @param count - number of quaternions to generate                     
+   ///   @return the generated unit quaternions                               
+   template<CT::Real T>
+   auto RandomRotation(RNG& rng, Count count) -> TMany<TQuaternion<T>> {
+      TMany<TQuaternion<T>> result;
+      if (count) {
+         result.template Reserve<true>(count);
+         RandomRotation(rng, result.GetRaw(), count);
+      }
+      return result;
+   }
+
+   /// Fill an array with normally distributed numbers                        
+   ///   @param rng - the generator                                           
+   ///   @param out - [out] the generated numbers                             
+   ///   @param count - number of numbers to generate                         
+   ///   @param mean - the mean of the distribution                           
+   ///   @param sigma - the standard deviation of the distribution            
+   template<CT::Real T>
+   void RandomNormal(RNG& rng, T* out, Count count, T mean, T sigma) noexcept {
+      for (Offset start = 0; start < count; start += Inner::RandomChunk) {
+         const Count n = ::std::min(Inner::RandomChunk, count - start);
+         Inner::StandardNormal(rng, out + start, n);
+         for (Offset i = 0; i < n; ++i)
+            out[start + i] = mean + sigma * out[start + i];
+      }
+   }
+
+   /// Generate normally distributed numbers                                  
+   ///   @param rng - the generator                                           
+   ///   @param count - number of numbers to generate                         
+   ///   @param mean - the mean of the distribution                           
+   ///   @param sigma - the standard deviation of the distribution            
+   ///   @return the generated numbers                                        
+   template<CT::Real T>
+   auto RandomNormal(RNG& rng, Count count, T mean, T sigma) -> TMany<T> {
+      TMany<T> result;
+      if (count) {
+         result.template Reserve<true>(count);
+         RandomNormal(rng, result.GetRaw(), count, mean, sigma);
+      }
+      return result;
+   }
+
+   /// Fill an array with vectors of normally distributed components          
+   ///   @param rng - the generator                                           
+   ///   @param out - [out] the generated vectors                             
+   ///   @param count - number of vectors to generate                         
+   ///   @param mean - the mean of the distribution, component-wise           
+   ///   @param sigma - the standard deviation, component-wise                
+   template<CT::VectorBased T>
+   void RandomNormal(RNG& rng, T* out, Count count, const T& mean, const T& sigma) noexcept {
+      using ScalarType = TypeOf<T>;
+      constexpr Count S = T::MemberCount;
+      constexpr Count Chunk = Inner::RandomChunk / S;
+      static_assert(CT::Real<ScalarType>, "Vector must contain reals");
+
+      ScalarType z[Inner::RandomChunk];
+      for (Offset start = 0; start < count; start += Chunk) {
+         const Count n = ::std::min(Chunk, count - start);
+         Inner::StandardNormal(rng, z, n * S);
+         for (Offset i = 0; i < n; ++i) {
+            for (Offset c = 0; c < S; ++c) {
+               out[start + i].all[c] = mean.all[c]
+                  + sigma.all[c] * z[i * S + c];
+            }
+         }
+      }
+   }
+
+   /// Fill an array with exponentially distributed numbers                   
+   ///   @param rng - the generator                                           
+   ///   @param out - [out] the generated numbers                             
+   ///   @param count - number of numbers to generate                         
+   ///   @param rate - the rate of the distribution (one over the mean)       
+   template<CT::Real T>
+   void RandomExponential(RNG& rng, T* out, Count count, T rate) noexcept {
+      LANGULUS_ASSUME(UserAssumes, rate > T {0}, "Rate must be positive");
+      const T scale = T {-1} / rate;
+      rng.Fill(::std::span<T> {out, count});
+      for (Offset i = 0; i < count; ++i)
+         out[i] = scale * ::std::log(Inner::RandomOpenUnit(out[i]));
+   }
+
+   /// Generate exponentially distributed numbers                             
+   ///   @param rng - the generator                                           
+   ///   @param count - number of numbers to generate                         
+   ///   @param rate - the rate of the distribution (one over the mean)       
+   ///   @return the generated numbers                                        
+   template<CT::Real T>
+   auto RandomExponential(RNG& rng, Count count, T rate) -> TMany<T> {
+      TMany<T> result;
+      if (count) {
+         result.template Reserve<true>(count);
+         RandomExponential(rng, result.GetRaw(), count, rate);
+      }
+      return result;
+   }
+
+} // namespace Langulus::Math
\ No newline at end of file
@@ -8,6 +8,10 @@
 #pragma once
 #include "../Functions/Arithmetics.hpp"
 #include "../Vectors/TVector.hpp"
+#include "../Vectors/TVectorStream.inl"
+#include "../Shaders/Snippets.hpp"
+#include <bit>
+#include <cstdint>
 
 
 namespace Langulus::Math
@@ -33,355 +37,122 @@ namespace Langulus::Math
 
       using V = TVector<T, 4>;
       static constexpr V seed {.1031, .1030, .0973, .1099};
-      static constexpr auto v1 = CT::Same<Real, float> ? "float" : "double";
-      static constexpr auto v2 = CT::Same<Real, float> ? "vec2" : "vec2d";
-      static constexpr auto v3 = CT::Same<Real, float> ? "vec3" : "vec3d";
-      static constexpr auto v4 = CT::Same<Real, float> ? "vec4" : "vec4d";
 
       /// Perform the hashing function, or get an equivalent shader code      
       template<bool GET_GLSL = false>
       NOD() static auto Hash(V p = {}) noexcept(!GET_GLSL) {
-         if constexpr (DIN == 1) {
+         if constexpr (GET_GLSL) {
+            // The shader code is the same as the snippet, in single    
+            // precision, named HoskinsHash{DOUT}{DIN}                  
+            using S = Shaders::HoskinsHash<DOUT, DIN>;
+            return TemplateFill(S::Code, S::Arguments[0], S::Arguments[1], S::Arguments[2]);
+         }
+         else if constexpr (DIN == 1) {
             if constexpr (DOUT == 1) {
                ///  1 out, 1 in...                                            
-               if constexpr (GET_GLSL) {
-                  return TemplateFill(
-                     R"shader(
-                        {0} HoskinsHash1({0} p) {{
-                           p = fract(p * {1});
-                           p *= p + 33.33;
-                           p *= p + p;
-                           return fract(p);
-                        }}
-                     )shader",
-                     v1, seed[0]
-                  );
-               }
-               else {
-                  p = Frac(p * seed[0]);
-                  p *= p + T {33.33};
-                  p *= p + p;
-                  return T {Frac(p)};
-               }
+               p = Frac(p * seed[0]);
+               p *= p + T {33.33};
+               p *= p + p;
+               return T {Frac(p)};
             }
             else if constexpr (DOUT == 2) {
                ///  2 out, 1 in...                                            
-               if constexpr (GET_GLSL) {
-                  return TemplateFill(
-                     R"shader(
-                        {0} HoskinsHash2({1} p) {{
-                           {2} p3 = fract(p * {2}({3}, {4}, {5}));
-                           p3 += dot(p3, p3.yzx + 31.32);
-                           return fract((p3.xx + p3.yz) * p3.zy);
-                        }}
-                     )shader",
-                     v2, v1, v3,
-                     seed[0], seed[1], seed[2]
-                  );
-               }
-               else {
-                  auto p3 = Frac(p[0] * TVector<T, 3> {seed});
-                  p3 += p3.Dot(p3.yzx() + T {31.32});
-                  return Frac((p3.xx() + p3.yz()) * p3.zy());
-               }
+               auto p3 = Frac(p[0] * TVector<T, 3> {seed});
+               p3 += p3.Dot(p3.yzx() + T {31.32});
+               return Frac((p3.xx() + p3.yz()) * p3.zy());
             }
             else if constexpr (DOUT == 3) {
                ///  3 out, 1 in...                                            
-               if constexpr (GET_GLSL) {
-                  return TemplateFill(
-                     R"shader(
-                        {0} HoskinsHash3({1} p) {{
-                           {0} p3 = fract(p * {0}({2}, {3}, {4}));
-                           p3 += dot(p3, p3.yzx + 33.33);
-                           return fract((p3.xxy + p3.yzz) * p3.zyx);
-                        }}
-                     )shader",
-                     v3, v1,
-                     seed[0], seed[1], seed[2]
-                  );
-               }
-               else {
-                  auto p3 = Frac(p[0] * TVector<T, 3> {seed});
-                  p3 += p3.Dot(p3.yzx() + T {33.33});
-                  return Frac((p3.xxy() + p3.yzz()) * p3.zyx());
-               }
+               auto p3 = Frac(p[0] * TVector<T, 3> {seed});
+               p3 += p3.Dot(p3.yzx() + T {33.33});
+               return Frac((p3.xxy() + p3.yzz()) * p3.zyx());
             }
             else if constexpr (DOUT == 4) {
                ///  4 out, 1 in...                                            
-               if constexpr (GET_GLSL) {
-                  return TemplateFill(
-                     R"shader(
-                        {0} HoskinsHash4({1} p) {{
-                           {0} p4 = fract(p * {0}({2}, {3}, {4}, {5}));
-                           p4 += dot(p4, p4.wzxy + 33.33);
-                           return fract((p4.xxyz + p4.yzzw) * p4.zywx);
-                        }}
-                     )shader",
-                     v4, v1,
-                     seed[0], seed[1], seed[2], seed[3]
-                  );
-               }
-               else {
-                  auto p4 = Frac(p[0] * seed);
-                  p4 += p4.Dot(p4.wzxy() + T {33.33});
-                  return Frac((p4.xxyz() + p4.yzzw()) * p4.zywx());
-               }
+               auto p4 = Frac(p[0] * seed);
+               p4 += p4.Dot(p4.wzxy() + T {33.33});
+               return Frac((p4.xxyz() + p4.yzzw()) * p4.zywx());
             }
             else static_assert(false, "Hash function with this output doesn't exist, for input 1");
          }
          else if constexpr (DIN == 2) {
             if constexpr (DOUT == 1) {
                ///  1 out, 2 in...                                            
-               if constexpr (GET_GLSL) {
-                  return TemplateFill(
-                     R"shader(
-                        {0} HoskinsHash1({1} p) {{
-                           {2} p3 = fract(p.xyx * {3});
-                           p3 += dot(p3, p3.yzx + 33.33);
-                           return fract((p3.x + p3.y) * p3.z);
-                        }}
-                     )shader",
-                     v1, v2, v3, seed[0]
-                  );
-               }
-               else {
-                  auto p3 = Frac(p.xyx() * seed[0]);
-                  p3 += p3.Dot(p3.yzx() + T {33.33});
-                  return T {Frac((p3[0] + p3[1]) * p3[2])};
-               }
+               auto p3 = Frac(p.xyx() * seed[0]);
+               p3 += p3.Dot(p3.yzx() + T {33.33});
+               return T {Frac((p3[0] + p3[1]) * p3[2])};
             }
             else if constexpr (DOUT == 2) {
                ///  2 out, 2 in...                                            
-               if constexpr (GET_GLSL) {
-                  return TemplateFill(
-                     R"shader(
-                        {0} HoskinsHash2({0} p) {{
-                           {1} p3 = fract(p.xyx * {1}({2}, {3}, {4}));
-                           p3 += dot(p3, p3.yzx + 33.33);
-                           return fract((p3.xx + p3.yz) * p3.zy);
-                        }}
-                     )shader",
-                     v2, v3,
-                     seed[0], seed[1], seed[2]
-                  );
-               }
-               else {
-                  auto p3 = Frac(p.xyx() * TVector<T, 3> {seed});
-                  p3 += p3.Dot(p3.yzx() + T {33.33});
-                  return Frac((p3.xx() + p3.yz()) * p3.zy());
-               }
+               auto p3 = Frac(p.xyx() * TVector<T, 3> {seed});
+               p3 += p3.Dot(p3.yzx() + T {33.33});
+               return Frac((p3.xx() + p3.yz()) * p3.zy());
             }
             else if constexpr (DOUT == 3) {
                ///  3 out, 2 in...                                            
-               if constexpr (GET_GLSL) {
-                  return TemplateFill(
-                     R"shader(
-                        {0} HoskinsHash3({1} p) {{
-                           {0} p3 = fract(p.xyx * {0}({2}, {3}, {4}));
-                           p3 += dot(p3, p3.yxz + 33.33);
-                           return fract((p3.xxy + p3.yzz) * p3.zyx);
-                        }}
-                     )shader",
-                     v3, v2,
-                     seed[0], seed[1], seed[2]
-                  );
-               }
-               else {
-                  auto p3 = Frac(p.xyx() * TVector<T, 3> {seed});
-                  p3 += p3.Dot(p3.yxz() + T {33.33});
-                  return Frac((p3.xxy() + p3.yzz()) * p3.zyx());
-               }
+               auto p3 = Frac(p.xyx() * TVector<T, 3> {seed});
+               p3 += p3.Dot(p3.yxz() + T {33.33});
+               return Frac((p3.xxy() + p3.yzz()) * p3.zyx());
             }
             else if constexpr (DOUT == 4) {
                ///  4 out, 2 in...                                            
-               if constexpr (GET_GLSL) {
-                  return TemplateFill(
-                     R"shader(
-                        {0} HoskinsHash4({1} p) {{
-                           {0} p4 = fract(p.xyxy * {0}({2}, {3}, {4}, {5}));
-                           p4 += dot(p4, p4.wzxy + 33.33);
-                           return fract((p4.xxyz + p4.yzzw) * p4.zywx);
-                        }}
-                     )shader",
-                     v4, v2,
-                     seed[0], seed[1], seed[2], seed[3]
-                  );
-               }
-               else {
-                  auto p4 = Frac(p.xyxy() * seed);
-                  p4 += p4.Dot(p4.wzxy() + T {33.33});
-                  return Frac((p4.xxyz() + p4.yzzw()) * p4.zywx());
-               }
+               auto p4 = Frac(p.xyxy() * seed);
+               p4 += p4.Dot(p4.wzxy() + T {33.33});
+               return Frac((p4.xxyz() + p4.yzzw()) * p4.zywx());
             }
             else static_assert(false, "Hash function with this output doesn't exist, for input 2");
          }
          else if constexpr (DIN == 3) {
             if constexpr (DOUT == 1) {
                ///  1 out, 3 in...                                            
-               if constexpr (GET_GLSL) {
-                  return TemplateFill(
-                     R"shader(
-                        {0} HoskinsHash1({1} p) {{
-                           p = fract(p * {2});
-                           p += dot(p, p.zyx + 31.32);
-                           return fract((p.x + p.y) * p.z);
-                        }}
-                     )shader",
-                     v1, v3,
-                     seed[0]
-                  );
-               }
-               else {
-                  p = Frac(p * seed[0]);
-                  p += p.Dot(p.zyx() + T {31.32});
-                  return T {Frac((p[0] + p[1]) * p[2])};
-               }
+               p = Frac(p * seed[0]);
+               p += p.Dot(p.zyx() + T {31.32});
+               return T {Frac((p[0] + p[1]) * p[2])};
             }
             else if constexpr (DOUT == 2) {
                ///  2 out, 3 in...                                            
-               if constexpr (GET_GLSL) {
-                  return TemplateFill(
-                     R"shader(
-                        {0} HoskinsHash2({1} p) {{
-                           p = fract(p * {1}({2}, {3}, {4}));
-                           p += dot(p, p.yzx + 33.33);
-                           return fract((p.xx + p.yz) * p.zy);
-                        }}
-                     )shader",
-                     v2, v3, 
-                     seed[0], seed[1], seed[2]
-                  );
-               }
-               else {
-                  p = Frac(p * TVector<T, 3> {seed});
-                  p += p.Dot(p.yzx() + T {33.33});
-                  return Frac((p.xx() + p.yz()) * p.zy());
-               }
+               p = Frac(p * TVector<T, 3> {seed});
+               p += p.Dot(p.yzx() + T {33.33});
+               return Frac((p.xx() + p.yz()) * p.zy());
             }
             else if constexpr (DOUT == 3) {
                ///  3 out, 3 in...                                            
-               if constexpr (GET_GLSL) {
-                  return TemplateFill(
-                     R"shader(
-                        {0} HoskinsHash3({0} p) {{
-                           p = fract(p * {0}({1}, {2}, {3}));
-                           p += dot(p, p.yxz + 33.33);
-                           return fract((p.xxy + p.yxx) * p.zyx);
-                        }}
-                     )shader",
-                     v3, seed[0], seed[1], seed[2]
-                  );
-               }
-               else {
-                  p = Frac(p * TVector<T, 3> {seed});
-                  p += p.Dot(p.yxz() + T {33.33});
-                  return Frac((p.xxy() + p.yxx()) * p.zyx());
-               }
+               p = Frac(p * TVector<T, 3> {seed});
+               p += p.Dot(p.yxz() + T {33.33});
+               return Frac((p.xxy() + p.yxx()) * p.zyx());
             }
             else if constexpr (DOUT == 4) {
                ///  4 out, 3 in...                                            
-               if constexpr (GET_GLSL) {
-                  return TemplateFill(
-                     R"shader(
-                        {0} HoskinsHash4({1} p) {{
-                           {0} p4 = fract(p.xyzx * {0}({2}, {3}, {4}, {5}));
-                           p4 += dot(p4, p4.wzxy + 33.33);
-                           return fract((p4.xxyz + p4.yzzw) * p4.zywx);
-                        }}
-                     )shader",
-                     v4, v3, seed[0], seed[1], seed[2], seed[3]
-                  );
-               }
-               else {
-                  auto p4 = Frac(p.xyzx() * seed);
-                  p4 += p4.Dot(p4.wzxy() + T {33.33});
-                  return Frac((p4.xxyz() + p4.yzzw()) * p4.zywx());
-               }
+               auto p4 = Frac(p.xyzx() * seed);
+               p4 += p4.Dot(p4.wzxy() + T {33.33});
+               return Frac((p4.xxyz() + p4.yzzw()) * p4.zywx());
             }
             else static_assert(false, "Hash function with this output doesn't exist, for input 3");
          }
          else if constexpr (DIN == 4) {
             if constexpr (DOUT == 1) {
                ///  1 out, 4 in...                                            
-               if constexpr (GET_GLSL) {
-                  return TemplateFill(
-                     R"shader(
-                        {0} HoskinsHash1({1} p) {{
-                           p = fract(p * {2});
-                           p += dot(p, p.ywxz + 32.31);
-                           return fract((p.x + p.y) * (p.z + p.w));
-                        }}
-                     )shader",
-                     v1, v4, seed[0]
-                  );
-               }
-               else {
-                  p = Frac(p * seed[0]);
-                  p += p.Dot(p.ywxz() + T {32.31});
-                  return T {Frac((p[0] + p[1]) * (p[2] + p[3]))};
-               }
+               p = Frac(p * seed[0]);
+               p += p.Dot(p.ywxz() + T {32.31});
+               return T {Frac((p[0] + p[1]) * (p[2] + p[3]))};
             }
             else if constexpr (DOUT == 2) {
                ///  2 out, 4 in...                                            
-               if constexpr (GET_GLSL) {
-                  return TemplateFill(
-                     R"shader(
-                        {0} HoskinsHash2({1] p) {{
-                           p = fract(p * {1}({2}, {3}, {4}, {5}));
-                           p += dot(p, p.wzxy + 33.33);
-                           return fract((p.xw + p.yz) * p.zy);
-                        }}
-                     )shader",
-                     v2, v4,
-                     seed[0], seed[1], seed[2], seed[3]
-                  );
-               }
-               else {
-                  p = Frac(p * seed);
-                  p += p.Dot(p.wzxy() + T {33.33});
-                  return Frac((p.xw() + p.yz()) * p.zy());
-               }
+               p = Frac(p * seed);
+               p += p.Dot(p.wzxy() + T {33.33});
+               return Frac((p.xw() + p.yz()) * p.zy());
             }
             else if constexpr (DOUT == 3) {
                ///  3 out, 4 in...                                            
-               if constexpr (GET_GLSL) {
-                  return TemplateFill(
-                     R"shader(
-                        {0} HoskinsHash3({1} p) {{
-                           p = fract(p * {1}({2}, {3}, {4}, {5}));
-                           p += dot(p, p.wzxy + 33.33);
-                           return fract((p.zwx + p.yxw) * p.zwy);
-                        }}
-                     )shader",
-                     v3, v4,
-                     seed[0], seed[1], seed[2], seed[3]
-                  );
-               }
-               else {
-                  p = Frac(p * seed);
-                  p += p.Dot(p.wzxy() + T {33.33});
-                  return Frac((p.zwx() + p.yxw()) * p.zwy());
-               }
+               p = Frac(p * seed);
+               p += p.Dot(p.wzxy() + T {33.33});
+               return Frac((p.zwx() + p.yxw()) * p.zwy());
             }
             else if constexpr (DOUT == 4) {
                ///  4 out, 4 in...                                            
-               if constexpr (GET_GLSL) {
-                  return TemplateFill(
-                     R"shader(
-                        {0} HoskinsHash4({0} p) {{
-                           p = fract(p * {0}({1}, {2}, {3}, {4}));
-                           p += dot(p, p.wzxy + 33.33);
-                           return fract((p.xxyz + p.yzzw) * p.zywx);
-                        }}
-                     )shader",
-                     v4, seed[0], seed[1], seed[2], seed[3]
-                  );
-               }
-               else {
-                  p = Frac(p * seed);
-                  p += p.Dot(p.wzxy() + T {33.33});
-                  return Frac((p.xxyz() + p.yzzw()) * p.zywx());
-               }
+               p = Frac(p * seed);
+               p += p.Dot(p.wzxy() + T {33.33});
+               return Frac((p.xxyz() + p.yzzw()) * p.zywx());
             }
             else static_assert(false, "Hash function with this output doesn't exist, for input 4");
          }
@@ -430,4 +201,222 @@ namespace Langulus::Math
       return n * (n ^ (n >> 15));
    }
 
+
+   ///                                                                        
+   ///   Integer hash finalizers                                              
+   ///                                                                        
+   ///   Unlike the hashes above, these have full avalanche - flipping any    
+   /// input bit flips each output bit with a probability of one half - and   
+   /// give the exact same results on all systems, for any input.             
+   ///                                                                        
+
+   /// MurmurHash3 32-bit finalizer, credit to Austin Appleby                 
+   ///   @param h - the number to mix                                         
+   ///   @return the hash                                                     
+   NOD() constexpr ::std::uint32_t Fmix32(::std::uint32_t h) noexcept {
+      h ^= h >> 16;
+      h *= 0x85EBCA6Bu;
+      h ^= h >> 13;
+      h *= 0xC2B2AE35u;
+      h ^= h >> 16;
+      return h;
+   }
+
+   /// MurmurHash3 64-bit finalizer, credit to Austin Appleby                 
+   ///   @param h - the number to mix                                         
+   ///   @return the hash                                                     
+   NOD() constexpr ::std::uint64_t Fmix64(::std::uint64_t h) noexcept {
+      h ^= h >> 33;
+      h *= 0xFF51AFD7ED558CCDull;
+      h ^= h >> 33;
+      h *= 0xC4CEB9FE1A85EC53ull;
+      h ^= h >> 33;
+      return h;
+   }
+
+   /// xxHash 32-bit avalanche, credit to Yann Collet                         
+   ///   @param h - the number to mix                                         
+   ///   @return the hash                                                     
+   NOD() constexpr ::std::uint32_t XXH32Avalanche(::std::uint32_t h) noexcept {
+      h ^= h >> 15;
+      h *= 0x85EBCA77u;
+      h ^= h >> 13;
+      h *= 0xC2B2AE3Du;
+      h ^= h >> 16;
+      return h;
+   }
+
+   /// xxHash 64-bit avalanche, credit to Yann Collet                         
+   ///   @param h - the number to mix                                         
+   ///   @return the hash                                                     
+   NOD() constexpr ::std::uint64_t XXH64Avalanche(::std::uint64_t h) noexcept {
+      h ^= h >> 33;
+      h *= 0xC2B2AE3D27D4EB4Full;
+      h ^= h >> 29;
+      h *= 0x165667B19E3779F9ull;
+      h ^= h >> 32;
+      return h;
+   }
+
+   /// PCG hash, credit to Jarzynski and Olano -                              
+   /// "Hash Functions for GPU Rendering"                                     
+   ///   @param v - the number to hash                                        
+   ///   @return the hash                                                     
+   NOD() constexpr ::std::uint32_t PCGHash(::std::uint32_t v) noexcept {
+      const ::std::uint32_t state = v * 747796405u + 2891336453u;
+      const ::std::uint32_t word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+      return (word >> 22u) ^ word;
+   }
+
+   namespace Inner
+   {
+
+      ///                                                                     
+      ///   Common interface of integer coordinate hashes                     
+      ///                                                                     
+      ///   Coordinates are converted to words first - signed coordinates     
+      /// wrap around, as their bits are in memory. Batches hash streams of   
+      /// coordinates lane-wise, each point taking the same branchless path,  
+      /// so that hashing vectorizes.                                         
+      ///   @tparam HASH - the hash, providing Mix(words, seed)               
+      ///   @tparam DIN - number of coordinates                               
+      ///   @tparam WORD - the word type, also the type of the hash           
+      template<class HASH, Count DIN, class WORD>
+      struct IntegerHash {
+         static_assert(DIN >= 1 and DIN <= 4,
+            "Integer hashes work only for inputs of 1-4 components");
+
+         using WordType = WORD;
+
+         /// Hash an array of coordinates                                     
+         ///   @param p - the coordinates                                     
+         ///   @param seed - the seed                                         
+         ///   @return the hash                                               
+         template<CT::Integer I> requires (sizeof(I) <= sizeof(WORD))
+         NOD() static constexpr WORD Hash(const I (&p)[DIN], WORD seed = 0) noexcept {
+            WORD words[DIN];
+            for (Offset c = 0; c < DIN; ++c)
+               words[c] = static_cast<WORD>(p[c]);
+            return HASH::Mix(words, seed);
+         }
+
+         /// Hash a vector of coordinates                                     
+         ///   @param p - the coordinates                                     
+         ///   @param seed - the seed                                         
+         ///   @return the hash                                               
+         template<CT::Integer I> requires (sizeof(I) <= sizeof(WORD))
+         NOD() static constexpr WORD Hash(const TVector<I, DIN>& p, WORD seed = 0) noexcept {
+            WORD words[DIN];
+            for (Offset c = 0; c < DIN; ++c)
+               words[c] = static_cast<WORD>(p[c]);
+            return HASH::Mix(words, seed);
+         }
+
+         /// Hash a stream of coordinates                                     
+         ///   @param points - the coordinates                                
+         ///   @param out - [out] the hashes, one for each point              
+         ///   @param seed - the seed                                         
+         template<CT::Integer I> requires (sizeof(I) <= sizeof(WORD))
+         static void Hash(const TVectorStream<I, DIN>& points, WORD* out, WORD seed = 0) noexcept {
+            const I* lanes[DIN];
+            for (Offset c = 0; c < DIN; ++c)
+               lanes[c] = points.GetLane(c);
+
+            const Count count = points.GetCount();
+            for (Offset i = 0; i < count; ++i) {
+               WORD words[DIN];
+               for (Offset c = 0; c < DIN; ++c)
+                  words[c] = static_cast<WORD>(lanes[c][i]);
+               out[i] = HASH::Mix(words, seed);
+            }
+         }
+      };
+
+   } // namespace Langulus::Math::Inner
+
+
+   ///                                                                        
+   ///   MurmurHash3 (x86, 32-bit) of 1-4 integer coordinates                 
+   ///                                                                        
+   ///   Same as hashing the bytes of 32-bit coordinates on little-endian     
+   /// systems, credit to Austin Appleby                                      
+   ///                                                                        
+   template<Count DIN>
+   struct TMurmur3 : Inner::IntegerHash<TMurmur3<DIN>, DIN, ::std::uint32_t> {
+      using WordType = ::std::uint32_t;
+
+      /// Mix the coordinate words                                            
+      NOD() static constexpr WordType Mix(const WordType (&words)[DIN], WordType seed) noexcept {
+         WordType h = seed;
+         for (Offset c = 0; c < DIN; ++c) {
+            WordType k = words[c] * 0xCC9E2D51u;
+            k = ::std::rotl(k, 15) * 0x1B873593u;
+            h = ::std::rotl(h ^ k, 13) * 5u + 0xE6546B64u;
+         }
+         return Fmix32(h ^ static_cast<WordType>(DIN * 4));
+      }
+   };
+
+   ///                                                                        
+   ///   xxHash (32-bit) of 1-4 integer coordinates                           
+   ///                                                                        
+   ///   Uses the short-input path of XXH32, which is the same as hashing the 
+   /// bytes of up to three 32-bit coordinates on little-endian systems,      
+   /// credit to Yann Collet                                                  
+   ///                                                                        
+   template<Count DIN>
+   struct TXXHash32 : Inner::IntegerHash<TXXHash32<DIN>, DIN, ::std::uint32_t> {
+      using WordType = ::std::uint32_t;
+
+      /// Mix the coordinate words                                            
+      NOD() static constexpr WordType Mix(const WordType (&words)[DIN], WordType seed) noexcept {
+         WordType h = seed + 0x165667B1u + static_cast<WordType>(DIN * 4);
+         for (Offset c = 0; c < DIN; ++c)
+            h = ::std::rotl(h + words[c] * 0xC2B2AE3Du, 17) * 0x27D4EB2Fu;
+         return XXH32Avalanche(h);
+      }
+   };
+
+   ///                                                                        
+   ///   xxHash (64-bit) of 1-4 integer coordinates                           
+   ///                                                                        
+   ///   Uses the short-input path of XXH64, which is the same as hashing the 
+   /// bytes of up to three 64-bit coordinates on little-endian systems.      
+   /// Smaller coordinates are widened to 64 bits, credit to Yann Collet      
+   ///                                                                        
+   template<Count DIN>
+   struct TXXHash64 : Inner::IntegerHash<TXXHash64<DIN>, DIN, ::std::uint64_t> {
+      using WordType = ::std::uint64_t;
+
+      /// Mix the coordinate words                                            
+      NOD() static constexpr WordType Mix(const WordType (&words)[DIN], WordType seed) noexcept {
+         WordType h = seed + 0x27D4EB2F165667C5ull + static_cast<WordType>(DIN * 8);
+         for (Offset c = 0; c < DIN; ++c) {
+            const WordType k = ::std::rotl(words[c] * 0xC2B2AE3D27D4EB4Full, 31) * 0x9E3779B185EBCA87ull;
+            h = ::std::rotl(h ^ k, 27) * 0x9E3779B185EBCA87ull + 0x85EBCA77C2B2AE63ull;
+         }
+         return XXH64Avalanche(h);
+      }
+   };
+
+   ///                                                                        
+   ///   PCG hash of 1-4 integer coordinates                                  
+   ///                                                                        
+   ///   Coordinates are hashed in a nested fashion, i.e. for three of them   
+   /// it's PCGHash(z + PCGHash(y + PCGHash(x + seed))). The cheapest of all  
+   /// hashes here, but with the weakest avalanche                            
+   ///                                                                        
+   template<Count DIN>
+   struct TPCG : Inner::IntegerHash<TPCG<DIN>, DIN, ::std::uint32_t> {
+      using WordType = ::std::uint32_t;
+
+      /// Mix the coordinate words                                            
+      NOD() static constexpr WordType Mix(const WordType (&words)[DIN], WordType seed) noexcept {
+         WordType h = seed;
+         for (Offset c = 0; c < DIN; ++c)
+            h = PCGHash(h + words[c]);
+         return h;
+      }
+   };
+
 } // namespace Langulus::Math
\ No newline at end of file
@@ -99,6 +99,4 @@ namespace Langulus::Math
       }
    };
 
-   using RNG = MersenneTwister;
-
 } // namespace Langulus::Math
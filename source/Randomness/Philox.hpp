@@ -0,0 +1,294 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "../Common.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+
+namespace Langulus::Math
+{
+
+   ///                                                                        
+   /// Philox4x32-10 counter-based random number generator                    
+   ///                                                                        
+   ///   Credit to Salmon et al. - "Parallel Random Numbers: As Easy as       
+   /// 1, 2, 3". The output is a pure function of a key (the seed) and a      
+   /// 128-bit counter, which is split here into a 64-bit position and a      
+   /// 64-bit stream number. That makes jumping ahead free, and gives each    
+   /// stream its own, independent sequence - so parallel workers can each    
+   /// Split() their own stream, and the results don't depend on how work     
+   /// is scheduled. The whole state is a few dozen bytes.                    
+   ///   Numbers are made of 32-bit words - 64-bit types consume two words,   
+   /// smaller types one. Fill() produces exactly the same numbers as         
+   /// calling Get() repeatedly, but generates a batch of counters at once,   
+   /// in branchless loops, that compilers vectorize.                         
+   ///                                                                        
+   class Philox {
+   public:
+      using WordType = ::std::uint32_t;
+      // Words produced per counter                                     
+      static constexpr Count BlockWords = 4;
+      // Counters generated together in bulk - a few registers worth    
+      static constexpr Count Lanes = 16;
+
+   private:
+      static constexpr WordType M0 = 0xD2511F53;
+      static constexpr WordType M1 = 0xCD9E8D57;
+      static constexpr WordType W0 = 0x9E3779B9;
+      static constexpr WordType W1 = 0xBB67AE85;
+
+      ::std::uint64_t mSeed {};
+      ::std::uint64_t mStream {};
+      // Number of words consumed from the stream                       
+      ::std::uint64_t mPosition {};
+      // The block of words at mPosition, cached                        
+      ::std::uint64_t mBufferBlock = ::std::numeric_limits<::std::uint64_t>::max();
+      WordType mBuffer[BlockWords] {};
+
+   public:
+      constexpr Philox() noexcept = default;
+
+      /// Create a generator                                                  
+      ///   @param seed - the key                                             
+      ///   @param stream - the stream number                                 
+      constexpr explicit Philox(::std::uint64_t seed, ::std::uint64_t stream = 0) noexcept
+         : mSeed {seed}
+         , mStream {stream} {}
+
+      /// Get an independent generator with the same seed                     
+      /// Streams don't overlap, no matter how many numbers are drawn         
+      ///   @param stream - the stream number, i.e. a worker index            
+      ///   @return the new generator, at the beginning of its stream         
+      NOD() constexpr Philox Split(::std::uint64_t stream) const noexcept {
+         return Philox {mSeed, stream};
+      }
+
+      /// Jump ahead, as if a number of words were generated                  
+      ///   @param words - number of words to skip                            
+      constexpr void Discard(::std::uint64_t words) noexcept {
+         mPosition += words;
+      }
+
+      /// Get the number of words generated so far                            
+      NOD() constexpr ::std::uint64_t GetPosition() const noexcept {
+         return mPosition;
+      }
+
+      /// Get the stream number                                               
+      NOD() constexpr ::std::uint64_t GetStream() const noexcept {
+         return mStream;
+      }
+
+      /// Get the seed                                                        
+      NOD() constexpr ::std::uint64_t GetSeed() const noexcept {
+         return mSeed;
+      }
+
+      /// Provide random numbers for different number types                   
+      /// Integer types provide random numbers is the entire integer range    
+      /// Real types provide random numbers in the range [-1:1)               
+      ///   @tparam T - type of the number                                    
+      ///   @return the newly generated number                                
+      template<CT::Number T>
+      T Get() noexcept {
+         WordType words[2];
+         words[0] = NextWord();
+         if constexpr (sizeof(T) > 4)
+            words[1] = NextWord();
+         return FromWords<T>(words);
+      }
+
+      /// Provide random numbers for different number types, in a range       
+      ///   @attention assumes min < max                                      
+      ///   @attention assumes than when using non-inclusive limits for       
+      ///      generating integers, the provided range (if T is integer) is   
+      ///      at least 4 units wide, in order to preserve uniformity when    
+      ///      offsetting from limits                                         
+      ///   @tparam T - type of the number (deducible)                        
+      ///   @tparam MIN_INCLUSIVE - whether minimum limit is inclusive        
+      ///   @tparam MAX_INCLUSIVE - whether maximum limit is inclusive        
+      ///   @param min - the lower end of the range                           
+      ///   @param max - the higher end of the range                          
+      ///   @return the newly generated number                                
+      template<CT::Number T, bool MIN_INCLUSIVE = true, bool MAX_INCLUSIVE = true>
+      T Get(const T& min, const T& max) noexcept {
+         LANGULUS_ASSUME(UserAssumes, min < max,
+            "Lower limit is not below higher limit");
+         LANGULUS_ASSUME(UserAssumes,
+            (MIN_INCLUSIVE and MAX_INCLUSIVE)
+            or CT::Real<T> or max - min >= T {4},
+            "Non-inclusive range can't be uniform - range too small"
+         );
+
+         T result;
+         if constexpr (CT::Integer<T>) {
+            // Unbiased, by rejecting the few words that would make     
+            // some results more likely than others                     
+            using U = ::std::make_unsigned_t<T>;
+            using W = ::std::conditional_t<(sizeof(T) > 4), ::std::uint64_t, WordType>;
+            const U span = static_cast<U>(static_cast<U>(max) - static_cast<U>(min));
+            if (span == ::std::numeric_limits<U>::max())
+               return Get<T>();
+
+            const W range = static_cast<W>(span) + 1;
+            const W threshold = static_cast<W>(W {0} - range) % range;
+            W word;
+            do word = Get<W>();
+            while (word < threshold);
+            result = static_cast<T>(static_cast<U>(static_cast<U>(min) + static_cast<U>(word % range)));
+         }
+         else result = min + (max - min) * Unit<T>(Get<T>());
+
+         if constexpr (not MIN_INCLUSIVE) {
+            // Offset from lower limit                                  
+            if (result == min) {
+               if constexpr (CT::Integer<T>)
+                  result += T {1};
+               else
+                  result += (max - min) * T {0.1};
+            }
+         }
+
+         if constexpr (not MAX_INCLUSIVE) {
+            // Offset from higher limit                                 
+            if (result == max) {
+               if constexpr (CT::Integer<T>)
+                  result -= T {1};
+               else
+                  result -= (max - min) * T {0.1};
+            }
+         }
+
+         return result;
+      }
+
+      /// Fill an array with random numbers, same as calling Get() for        
+      /// each element, but whole blocks at a time                            
+      ///   @param out - [out] the numbers                                    
+      template<CT::Number T>
+      void Fill(::std::span<T> out) noexcept {
+         constexpr Count Words = sizeof(T) > 4 ? 2 : 1;
+         constexpr Count PerBlock = BlockWords / Words;
+         T* data = out.data();
+         Count count = out.size();
+
+         // Finish the current block one number at a time. 64-bit       
+         // numbers at odd positions never line up with blocks, and     
+         // take this path all the way                                  
+         while (count and mPosition % BlockWords) {
+            *data++ = Get<T>();
+            --count;
+         }
+
+         WordType words[Lanes * BlockWords];
+         while (count >= PerBlock) {
+            const Count blocks = ::std::min(Lanes, count / PerBlock);
+            Generate(mSeed, mStream, mPosition / BlockWords, blocks, words);
+            for (Offset i = 0; i < blocks * PerBlock; ++i)
+               data[i] = FromWords<T>(words + i * Words);
+
+            data += blocks * PerBlock;
+            count -= blocks * PerBlock;
+            mPosition += blocks * BlockWords;
+         }
+
+         while (count) {
+            *data++ = Get<T>();
+            --count;
+         }
+      }
+
+      /// Generate consecutive blocks of a stream, straight from counters     
+      ///   @param seed - the key                                             
+      ///   @param stream - the stream number                                 
+      ///   @param counter - the position of the first block, in blocks       
+      ///   @param blocks - number of blocks to generate                      
+      ///   @param out - [out] the words, BlockWords per block                
+      static void Generate(
+         ::std::uint64_t seed, ::std::uint64_t stream,
+         ::std::uint64_t counter, Count blocks, WordType* out
+      ) noexcept {
+         for (Offset start = 0; start < blocks; start += Lanes) {
+            WordType c0[Lanes], c1[Lanes], c2[Lanes], c3[Lanes];
+            for (Offset i = 0; i < Lanes; ++i) {
+               const ::std::uint64_t position = counter + start + i;
+               c0[i] = static_cast<WordType>(position);
+               c1[i] = static_cast<WordType>(position >> 32);
+               c2[i] = static_cast<WordType>(stream);
+               c3[i] = static_cast<WordType>(stream >> 32);
+            }
+
+            WordType k0 = static_cast<WordType>(seed);
+            WordType k1 = static_cast<WordType>(seed >> 32);
+            for (int round = 0; round < 10; ++round) {
+               for (Offset i = 0; i < Lanes; ++i) {
+                  const ::std::uint64_t p0 = ::std::uint64_t {M0} * c0[i];
+                  const ::std::uint64_t p1 = ::std::uint64_t {M1} * c2[i];
+                  const WordType n0 = static_cast<WordType>(p1 >> 32) ^ c1[i] ^ k0;
+                  const WordType n2 = static_cast<WordType>(p0 >> 32) ^ c3[i] ^ k1;
+                  c1[i] = static_cast<WordType>(p1);
+                  c3[i] = static_cast<WordType>(p0);
+                  c0[i] = n0;
+                  c2[i] = n2;
+               }
+               k0 += W0;
+               k1 += W1;
+            }
+
+            const Count count = ::std::min(Lanes, blocks - start);
+            for (Offset i = 0; i < count; ++i) {
+               out[(start + i) * BlockWords + 0] = c0[i];
+               out[(start + i) * BlockWords + 1] = c1[i];
+               out[(start + i) * BlockWords + 2] = c2[i];
+               out[(start + i) * BlockWords + 3] = c3[i];
+            }
+         }
+      }
+
+   private:
+      /// Get the next word of the stream                                     
+      WordType NextWord() noexcept {
+         const ::std::uint64_t block = mPosition / BlockWords;
+         if (block != mBufferBlock) {
+            Generate(mSeed, mStream, block, 1, mBuffer);
+            mBufferBlock = block;
+         }
+         return mBuffer[mPosition++ % BlockWords];
+      }
+
+      /// Make a number out of one or two words                               
+      /// Reals are made in [-1:1), from as many bits as they can hold        
+      template<CT::Number T>
+      static T FromWords(const WordType* words) noexcept {
+         if constexpr (CT::Real<T>) {
+            if constexpr (sizeof(T) > 4) {
+               const auto bits = (::std::uint64_t {words[1]} << 32) | words[0];
+               return static_cast<T>(bits >> 11) * T {0x1p-52} - T {1};
+            }
+            else return static_cast<T>(words[0] >> 8) * T {0x1p-23} - T {1};
+         }
+         else if constexpr (sizeof(T) > 4)
+            return static_cast<T>((::std::uint64_t {words[1]} << 32) | words[0]);
+         else
+            return static_cast<T>(words[0]);
+      }
+
+      /// Map a real from [-1:1) to [0:1)                                     
+      template<CT::Real T>
+      static constexpr T Unit(T value) noexcept {
+         return (value + T {1}) * T {0.5};
+      }
+   };
+
+   using RNG = Philox;
+
+} // namespace Langulus::Math
\ No newline at end of file
@@ -7,6 +7,7 @@
 ///                                                                           
 #pragma once
 #include "Hashes.hpp"
+#include "../Vectors/TVectorStream.hpp"
 
 
 namespace Langulus::Math
@@ -15,6 +16,16 @@ namespace Langulus::Math
    ///                                                                        
    ///   Simplex noise functions                                              
    ///                                                                        
+   ///   Credit to Ken Perlin, and to Stefan Gustavson - "Simplex noise       
+   /// demystified". Each output component is an independent noise channel,   
+   /// in the range [-1:1]. Lattice points are hashed with integer            
+   /// arithmetic, so the noise doesn't lose quality far from the origin.     
+   /// Derivatives are analytic. Batches over point streams run a whole       
+   /// stream block through the same branchless path, so they vectorize,      
+   /// and match sampling the points one by one.                              
+   ///   The shader code is an approximation, based on THoskins hashes, and   
+   /// is available only for a single channel of 2D or 3D input.              
+   ///                                                                        
    ///   @tparam DOUT - number of output dimensions                           
    ///   @tparam DIN - number of input dimensions                             
    ///   @tparam T - real number type to use for computation                  
@@ -27,238 +38,136 @@ namespace Langulus::Math
 
       // Vector type                                                    
       using V = TVector<T, 4>;
+      // A number for a single channel, a vector for more channels      
+      using OutputType = Conditional<DOUT == 1, T, TVector<T, DOUT>>;
+      // The noise value, followed by its gradient                      
+      using DerivativeType = TVector<T, DIN + 1>;
+
+      using StreamType = TVectorStream<T, DIN>;
+      using OutputStreamType = TVectorStream<T, DOUT>;
+      using DerivativeStreamType = TVectorStream<T, DIN + 1>;
+      static constexpr Count Block = StreamType::Block;
 
       // Hash function                                                  
       using HF = THoskins<DIN, DIN, T>;
 
+      /// How octaves are combined into fractal noise                         
+      enum Stacking {
+         // Fractional Brownian motion, a plain sum, in [-1:1]          
+         FBM,
+         // Inverted and squared octaves, making sharp ridges, in [0:1] 
+         Ridged,
+         // Absolute octaves, making billowy creases, in [0:1]          
+         Turbulence
+      };
+
+      /// Fractal noise settings                                              
+      struct Octaves {
+         // Number of octaves                                           
+         Count mCount = 6;
+         // Frequency multiplier for each next octave                   
+         T mLacunarity = 2;
+         // Amplitude multiplier for each next octave                   
+         T mGain = T {0.5};
+      };
+
       /// Perform the noise function, or get an equivalent shader code        
       ///   @tparam GET_GLSL - true to get shader code equivalent to function 
       template<bool GET_GLSL = false>
       NOD() static auto Hash(V p = {}) noexcept(not GET_GLSL) {
-         (void)p;
-
-         if constexpr (DIN == 1) {
-            if constexpr (DOUT == 1) {
-               ///  1 out, 1 in...                                            
-               if constexpr (GET_GLSL) {
-                  TODO();
-               }
-               else {
-                  TODO();
-               }
-            }
-            else if constexpr (DOUT == 2) {
-               ///  2 out, 1 in...                                            
-               if constexpr (GET_GLSL) {
-                  TODO();
-               }
-               else {
-                  TODO();
-               }
-            }
-            else if constexpr (DOUT == 3) {
-               ///  3 out, 1 in...                                            
-               if constexpr (GET_GLSL) {
-                  TODO();
-               }
-               else {
-                  TODO();
-               }
-            }
-            else if constexpr (DOUT == 4) {
-               ///  4 out, 1 in...                                            
-               if constexpr (GET_GLSL) {
-                  TODO();
-               }
-               else {
-                  TODO();
-               }
-            }
-            else static_assert(false, "Hash function with this output doesn't exist, for input 1");
+         if constexpr (not GET_GLSL)
+            return Sample(p);
+         else if constexpr (DIN == 2 and DOUT == 1) {
+            ///  1 out, 2 in...                                               
+            return R"shader(
+               float SimplexNoise1(in vec2 p) {
+                  const float K1 = 0.366025404; // (sqrt(3)-1)/2;
+                  const float K2 = 0.211324865; // (3-sqrt(3))/6;
+
+                  vec2 i = floor(p + (p.x + p.y) * K1);
+                  vec2 a = p - i + (i.x + i.y) * K2;
+                  vec2 o = (a.x > a.y) ? vec2(1.0, 0.0) : vec2(0.0, 1.0);
+                  vec2 b = a - o + K2;
+                  vec2 c = a - 1.0 + 2.0 * K2;
+                  vec3 h = max(0.5 - vec3(dot(a, a), dot(b, b), dot(c, c)), 0.0);
+                  vec3 n = h * h * h * h * vec3(
+                     dot(a, HoskinsHash22(i + 0.0)),
+                     dot(b, HoskinsHash22(i + o)),
+                     dot(c, HoskinsHash22(i + 1.0))
+                  );
+                  return dot(n, vec3(70.0));
+               }
+            )shader";
          }
-         else if constexpr (DIN == 2) {
-            if constexpr (DOUT == 1) {
-               ///  1 out, 2 in...                                            
-               if constexpr (GET_GLSL) {
-                  return R"shader(
-                     float SimplexNoise1(in vec2 p) {
-                        const float K1 = 0.366025404; // (sqrt(3)-1)/2;
-                        const float K2 = 0.211324865; // (3-sqrt(3))/6;
-
-                        vec2 i = floor(p + (p.x + p.y) * K1);
-                        vec2 a = p - i + (i.x + i.y) * K2;
-                        vec2 o = (a.x > a.y) ? vec2(1.0, 0.0) : vec2(0.0, 1.0);
-                        vec2 b = a - o + K2;
-                        vec2 c = a - 1.0 + 2.0 * K2;
-                        vec3 h = max(0.5 - vec3(dot(a, a), dot(b, b), dot(c, c)), 0.0);
-                        vec3 n = h * h * h * h * vec3(
-                           dot(a, HoskinsHash22(i + 0.0)),
-                           dot(b, HoskinsHash22(i + o)),
-                           dot(c, HoskinsHash22(i + 1.0))
-                        );
-                        return dot(n, vec3(70.0));
-                     }
-                  )shader";
-               }
-               else {
-                  TODO();
-               }
-            }
-            else if constexpr (DOUT == 2) {
-               ///  2 out, 2 in...                                            
-               if constexpr (GET_GLSL) {
-                  TODO();
-               }
-               else {
-                  TODO();
-               }
-            }
-            else if constexpr (DOUT == 3) {
-               ///  3 out, 2 in...                                            
-               if constexpr (GET_GLSL) {
-                  TODO();
-               }
-               else {
-                  TODO();
-               }
-            }
-            else if constexpr (DOUT == 4) {
-               ///  4 out, 2 in...                                            
-               if constexpr (GET_GLSL) {
-                  TODO();
-               }
-               else {
-                  TODO();
-               }
-            }
-            else static_assert(false, "Hash function with this output doesn't exist, for input 2");
+         else if constexpr (DIN == 3 and DOUT == 1) {
+            ///  1 out, 3 in...                                               
+            return R"shader(
+               float SimplexNoise1(in vec3 p) {
+                  // 1. find current tetrahedron T and it's four vertices
+                  //    s, s+i1, s+i2, s+1.0 - absolute skewed (integer) coordinates of T vertices
+                  //    x, x1, x2, x3 - unskewed coordinates of p relative to each of T vertices
+
+                  // calculate s and x
+                  vec3 s = floor(p + dot(p, vec3(F3)));
+                  vec3 x = p - s + dot(s, vec3(G3));
+
+                  // calculate i1 and i2
+                  vec3 e = step(vec3(0.0), x - x.yzx);
+                  vec3 i1 = e * (1.0 - e.zxy);
+                  vec3 i2 = 1.0 - e.zxy * (1.0 - e);
+
+                  // x1, x2, x3
+                  vec3 x1 = x - i1 + G3;
+                  vec3 x2 = x - i2 + 2.0 * G3;
+                  vec3 x3 = x - 1.0 + 3.0 * G3;
+
+                  // 2. find four surflets and store them in d
+                  vec4 w, d;
+
+                  // calculate surflet weights
+                  w.x = dot(x, x);
+                  w.y = dot(x1, x1);
+                  w.z = dot(x2, x2);
+                  w.w = dot(x3, x3);
+
+                  // w fades from 0.6 at the center of the surflet to 0.0 at the margin
+                  w = max(0.6 - w, 0.0);
+
+                  // calculate surflet components
+                  d.x = dot(HoskinsHash33(s), x);
+                  d.y = dot(HoskinsHash33(s + i1), x1);
+                  d.z = dot(HoskinsHash33(s + i2), x2);
+                  d.w = dot(HoskinsHash33(s + 1.0), x3);
+
+                  // multiply d by w^4
+                  w *= w;
+                  w *= w;
+                  d *= w;
+
+                  // 3. return the sum of the four surflets
+                  return dot(d, vec4(52.0));
+               }
+            )shader";
          }
-         else if constexpr (DIN == 3) {
-            if constexpr (DOUT == 1) {
-               ///  1 out, 3 in...                                            
-               if constexpr (GET_GLSL) {
-                  return R"shader(
-                     float SimplexNoise1(in vec3 p) {
-                        // 1. find current tetrahedron T and it's four vertices
-                        //    s, s+i1, s+i2, s+1.0 - absolute skewed (integer) coordinates of T vertices
-                        //    x, x1, x2, x3 - unskewed coordinates of p relative to each of T vertices
-
-                        // calculate s and x
-                        vec3 s = floor(p + dot(p, vec3(F3)));
-                        vec3 x = p - s + dot(s, vec3(G3));
-
-                        // calculate i1 and i2
-                        vec3 e = step(vec3(0.0), x - x.yzx);
-                        vec3 i1 = e * (1.0 - e.zxy);
-                        vec3 i2 = 1.0 - e.zxy * (1.0 - e);
-
-                        // x1, x2, x3
-                        vec3 x1 = x - i1 + G3;
-                        vec3 x2 = x - i2 + 2.0 * G3;
-                        vec3 x3 = x - 1.0 + 3.0 * G3;
-
-                        // 2. find four surflets and store them in d
-                        vec4 w, d;
-
-                        // calculate surflet weights
-                        w.x = dot(x, x);
-                        w.y = dot(x1, x1);
-                        w.z = dot(x2, x2);
-                        w.w = dot(x3, x3);
-
-                        // w fades from 0.6 at the center of the surflet to 0.0 at the margin
-                        w = max(0.6 - w, 0.0);
-
-                        // calculate surflet components
-                        d.x = dot(HoskinsHash33(s), x);
-                        d.y = dot(HoskinsHash33(s + i1), x1);
-                        d.z = dot(HoskinsHash33(s + i2), x2);
-                        d.w = dot(HoskinsHash33(s + 1.0), x3);
-
-                        // multiply d by w^4
-                        w *= w;
-                        w *= w;
-                        d *= w;
-
-                        // 3. return the sum of the four surflets
-                        return dot(d, vec4(52.0));
-                     }
-                  )shader";
-               }
-               else {
-                  TODO();
-               }
-            }
-            else if constexpr (DOUT == 2) {
-               ///  2 out, 3 in...                                            
-               if constexpr (GET_GLSL) {
-                  TODO();
-               }
-               else {
-                  TODO();
-               }
-            }
-            else if constexpr (DOUT == 3) {
-               ///  3 out, 3 in...                                            
-               if constexpr (GET_GLSL) {
-                  TODO();
-               }
-               else {
-                  TODO();
-               }
-            }
-            else if constexpr (DOUT == 4) {
-               ///  4 out, 3 in...                                            
-               if constexpr (GET_GLSL) {
-                  TODO();
-               }
-               else {
-                  TODO();
-               }
-            }
-            else static_assert(false, "Hash function with this output doesn't exist, for input 3");
-         }
-         else if constexpr (DIN == 4) {
-            if constexpr (DOUT == 1) {
-               ///  1 out, 4 in...                                            
-               if constexpr (GET_GLSL) {
-                  TODO();
-               }
-               else {
-                  TODO();
-               }
-            }
-            else if constexpr (DOUT == 2) {
-               ///  2 out, 4 in...                                            
-               if constexpr (GET_GLSL) {
-                  TODO();
-               }
-               else {
-                  TODO();
-               }
-            }
-            else if constexpr (DOUT == 3) {
-               ///  3 out, 4 in...                                            
-               if constexpr (GET_GLSL) {
-                  TODO();
-               }
-               else {
-                  TODO();
-               }
-            }
-            else if constexpr (DOUT == 4) {
-               ///  4 out, 4 in...                                            
-               if constexpr (GET_GLSL) {
-                  TODO();
-               }
-               else {
-                  TODO();
-               }
-            }
-            else static_assert(false, "Hash function with this output doesn't exist, for input 4");
-         }
-         else static_assert(false, "Hash function with this input doesn't exist");
+         else static_assert(false,
+            "Simplex noise shader code exists only for a single channel of 2D or 3D input");
       }
+
+      NOD() static DerivativeType Derivative(const V&, Offset channel = 0) noexcept;
+      template<Stacking = FBM>
+      NOD() static OutputType Fractal(const V&, const Octaves& = {}) noexcept;
+
+      NOD() static OutputStreamType Hash(const StreamType&);
+      NOD() static DerivativeStreamType Derivative(const StreamType&, Offset channel = 0);
+      template<Stacking = FBM>
+      NOD() static OutputStreamType Fractal(const StreamType&, const Octaves& = {});
+
+   protected:
+      NOD() static OutputType Sample(const V&) noexcept;
+      template<Stacking, Count W>
+      static void Stack(const T (&)[DIN][W], Offset, const Octaves&, T (&)[W]) noexcept;
+      template<class F>
+      NOD() static OutputStreamType Batch(const StreamType&, F&&);
    };
 
 } // namespace Langulus::Math
\ No newline at end of file
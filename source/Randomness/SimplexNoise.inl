@@ -0,0 +1,368 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "SimplexNoise.hpp"
+#include "../Vectors/TVectorStream.inl"
+#include <cmath>
+#include <cstdint>
+
+#define TEMPLATE()   template<Count DOUT, Count DIN, CT::Real T>
+#define TME()        TSimplex<DOUT, DIN, T>
+
+
+namespace Langulus::Math
+{
+   namespace Inner
+   {
+
+      /// Skewing factors, corner radius, and normalization of simplex noise  
+      ///   @tparam D - number of dimensions                                  
+      template<Count D, CT::Real T>
+      struct SimplexTraits {
+         // Factor for skewing into the simplex lattice, and back       
+         static constexpr T F = D == 1 ? T {0}
+                              : D == 2 ? T {0.36602540378443865}  // (sqrt(3) - 1) / 2
+                              : D == 3 ? T {1} / T {3}
+                                       : T {0.30901699437494745}; // (sqrt(5) - 1) / 4
+         static constexpr T G = D == 1 ? T {0}
+                              : D == 2 ? T {0.21132486540518713}  // (3 - sqrt(3)) / 6
+                              : D == 3 ? T {1} / T {6}
+                                       : T {0.13819660112501050}; // (5 - sqrt(5)) / 20
+         // Squared radius of influence of each corner. Using 0.5       
+         // instead of the classic 0.6 keeps the noise continuous       
+         static constexpr T R2 = D == 1 ? T {1} : T {0.5};
+         // Largest magnitude of the unscaled noise, rounded up: the    
+         // maximum over a cell of the sum of (r^2 - |x|^2)^4 * |x|_1,  
+         // reached when all gradient components are -1 or 1, along x   
+         static constexpr T Peak = D == 1 ? T {0.31640625}   // 81 / 256
+                                 : D == 2 ? T {0.0142556}
+                                 : D == 3 ? T {0.0160892}
+                                          : T {0.0184217};
+         // Brings the result in the range [-1:1]                       
+         static constexpr T Scale = T {1} / Peak;
+      };
+
+      /// Evaluate simplex noise for a block of points                        
+      /// The loop over the block is branchless, with constant inner loops,   
+      /// so that it vectorizes, and a block of one point matches a larger    
+      /// one, up to floating point contraction                               
+      ///   @tparam D - number of dimensions                                  
+      ///   @tparam W - number of points in the block                         
+      ///   @tparam GRADIENT - whether or not to compute the gradient         
+      ///   @param p - the points, component-wise                             
+      ///   @param channel - the noise channel, hashed with lattice points    
+      ///   @param value - [out] the noise values                             
+      ///   @param gradient - [out] the gradients, if GRADIENT is true        
+      template<Count D, Count W, bool GRADIENT, CT::Real T>
+      void Simplex(
+         const T (&p)[D][W], ::std::uint32_t channel,
+         T (&value)[W], T (&gradient)[D][W]
+      ) noexcept {
+         using Traits = SimplexTraits<D, T>;
+         using Int = ::std::int32_t;
+         using UInt = ::std::uint32_t;
+
+         for (Offset j = 0; j < W; ++j) {
+            // Skew the input space to find the origin of the simplex   
+            // cell, and the position relative to it, in unskewed space.
+            // Floor is done via truncation, because std::floor doesn't 
+            // vectorize unless math is allowed to ignore traps         
+            T s = 0;
+            for (Offset c = 0; c < D; ++c)
+               s += p[c][j];
+
+            T t = 0;
+            Int cell[D];
+            T x0[D];
+            for (Offset c = 0; c < D; ++c) {
+               const T q = p[c][j] + s * Traits::F;
+               const Int i = static_cast<Int>(q);
+               cell[c] = i - static_cast<Int>(q < static_cast<T>(i));
+               const T f = static_cast<T>(cell[c]);
+               x0[c] = p[c][j] - f;
+               t += f;
+            }
+
+            for (Offset c = 0; c < D; ++c)
+               x0[c] += t * Traits::G;
+
+            // Rank the components - the corners of the simplex are     
+            // reached by stepping along the largest components first   
+            Int rank[D] {};
+            for (Offset a = 0; a < D; ++a) {
+               for (Offset b = 0; b < D; ++b) {
+                  if (a < b) {
+                     const Int greater = x0[a] > x0[b];
+                     rank[a] += greater;
+                     rank[b] += 1 - greater;
+                  }
+               }
+            }
+
+            T v = 0;
+            T dv[D] {};
+            for (Offset k = 0; k <= D; ++k) {
+               // The k largest components are offset by one for corner 
+               // k, and the corner's lattice point is hashed           
+               T x[D];
+               UInt h = channel * 0x9E3779B9u + 0x165667B1u;
+               for (Offset c = 0; c < D; ++c) {
+                  const Int o = rank[c] >= static_cast<Int>(D - k);
+                  x[c] = x0[c] - static_cast<T>(o) + static_cast<T>(k) * Traits::G;
+                  h = (h ^ static_cast<UInt>(cell[c] + o)) * 0x27D4EB2Du;
+               }
+
+               h = Fmix32(h);
+
+               // Each byte of the hash is a gradient component in [-1:1]
+               T g[D];
+               T r2 = 0;
+               T gx = 0;
+               for (Offset c = 0; c < D; ++c) {
+                  const auto byte = static_cast<Int>((h >> (c * 8)) & 0xFF);
+                  g[c] = static_cast<T>(byte) * T {2.0 / 255.0} - T {1};
+                  gx += g[c] * x[c];
+                  r2 += x[c] * x[c];
+               }
+
+               // Each corner contributes (r^2 - |x|^2)^4 * dot(g, x)   
+               const T f = ::std::max(Traits::R2 - r2, T {0});
+               const T f2 = f * f;
+               v += f2 * f2 * gx;
+
+               if constexpr (GRADIENT) {
+                  const T f3 = f2 * f;
+                  for (Offset c = 0; c < D; ++c)
+                     dv[c] += f3 * f * g[c] - T {8} * f3 * gx * x[c];
+               }
+            }
+
+            value[j] = v * Traits::Scale;
+            if constexpr (GRADIENT) {
+               for (Offset c = 0; c < D; ++c)
+                  gradient[c][j] = dv[c] * Traits::Scale;
+            }
+         }
+      }
+
+   } // namespace Langulus::Math::Inner
+
+
+   /// Sample all noise channels at a point                                   
+   ///   @param p - the point, only the first DIN components are used         
+   ///   @return the noise, one channel per output component                  
+   TEMPLATE()
+   auto TME()::Sample(const V& p) noexcept -> OutputType {
+      T point[DIN][1];
+      for (Offset c = 0; c < DIN; ++c)
+         point[c][0] = p[c];
+
+      OutputType result;
+      T value[1];
+      T unused[DIN][1];
+      for (Offset channel = 0; channel < DOUT; ++channel) {
+         Inner::Simplex<DIN, 1, false>(point, static_cast<::std::uint32_t>(channel), value, unused);
+         if constexpr (DOUT == 1)
+            result = value[0];
+         else
+            result[channel] = value[0];
+      }
+      return result;
+   }
+
+   /// Sample a noise channel and its gradient at a point                     
+   ///   @param p - the point, only the first DIN components are used         
+   ///   @param channel - the noise channel                                   
+   ///   @return the noise value, followed by the gradient                    
+   TEMPLATE()
+   auto TME()::Derivative(const V& p, Offset channel) noexcept -> DerivativeType {
+      T point[DIN][1];
+      for (Offset c = 0; c < DIN; ++c)
+         point[c][0] = p[c];
+
+      T value[1];
+      T gradient[DIN][1];
+      Inner::Simplex<DIN, 1, true>(point, static_cast<::std::uint32_t>(channel), value, gradient);
+
+      DerivativeType result;
+      result[0] = value[0];
+      for (Offset c = 0; c < DIN; ++c)
+         result[c + 1] = gradient[c][0];
+      return result;
+   }
+
+   /// Sample fractal noise at a point, in all channels                       
+   ///   @tparam S - how octaves are combined                                 
+   ///   @param p - the point, only the first DIN components are used         
+   ///   @param octaves - the fractal settings                                
+   ///   @return the fractal noise, one channel per output component          
+   TEMPLATE() template<typename TME()::Stacking S>
+   auto TME()::Fractal(const V& p, const Octaves& octaves) noexcept -> OutputType {
+      T point[DIN][1];
+      for (Offset c = 0; c < DIN; ++c)
+         point[c][0] = p[c];
+
+      OutputType result;
+      T value[1];
+      for (Offset channel = 0; channel < DOUT; ++channel) {
+         Stack<S>(point, channel, octaves, value);
+         if constexpr (DOUT == 1)
+            result = value[0];
+         else
+            result[channel] = value[0];
+      }
+      return result;
+   }
+
+   /// Sample all noise channels for a stream of points                       
+   ///   @param points - the points                                           
+   ///   @return the noise, one lane per channel                              
+   TEMPLATE()
+   auto TME()::Hash(const StreamType& points) -> OutputStreamType {
+      return Batch(points, [](const T (&p)[DIN][Block], Offset channel, T (&out)[Block]) {
+         T unused[DIN][Block];
+         Inner::Simplex<DIN, Block, false>(p, static_cast<::std::uint32_t>(channel), out, unused);
+      });
+   }
+
+   /// Sample a noise channel and its gradient for a stream of points         
+   ///   @param points - the points                                           
+   ///   @param channel - the noise channel                                   
+   ///   @return the noise values in lane 0, followed by gradient lanes       
+   TEMPLATE()
+   auto TME()::Derivative(const StreamType& points, Offset channel) -> DerivativeStreamType {
+      const Count count = points.GetCount();
+      DerivativeStreamType result {count};
+
+      T p[DIN][Block];
+      T value[Block];
+      T gradient[DIN][Block];
+      for (Offset start = 0; start < count; start += Block) {
+         // Lanes are padded to whole blocks, so reading a whole block  
+         // is always safe                                              
+         for (Offset c = 0; c < DIN; ++c) {
+            const T* lane = points.GetLane(c) + start;
+            for (Offset j = 0; j < Block; ++j)
+               p[c][j] = lane[j];
+         }
+
+         Inner::Simplex<DIN, Block, true>(p, static_cast<::std::uint32_t>(channel), value, gradient);
+
+         const Count n = ::std::min(Block, count - start);
+         T* out = result.GetLane(0) + start;
+         for (Offset j = 0; j < n; ++j)
+            out[j] = value[j];
+
+         for (Offset c = 0; c < DIN; ++c) {
+            out = result.GetLane(c + 1) + start;
+            for (Offset j = 0; j < n; ++j)
+               out[j] = gradient[c][j];
+         }
+      }
+      return result;
+   }
+
+   /// Sample fractal noise for a stream of points, in all channels           
+   ///   @tparam S - how octaves are combined                                 
+   ///   @param points - the points                                           
+   ///   @param octaves - the fractal settings                                
+   ///   @return the fractal noise, one lane per channel                      
+   TEMPLATE() template<typename TME()::Stacking S>
+   auto TME()::Fractal(const StreamType& points, const Octaves& octaves) -> OutputStreamType {
+      return Batch(points, [&octaves](const T (&p)[DIN][Block], Offset channel, T (&out)[Block]) {
+         Stack<S>(p, channel, octaves, out);
+      });
+   }
+
+   /// Stack octaves of a single noise channel, for a block of points         
+   /// Each octave is hashed as a different channel, so that lattices of      
+   /// different octaves don't correlate around the origin                    
+   ///   @tparam S - how octaves are combined                                 
+   ///   @tparam W - number of points in the block                            
+   ///   @param p - the points, component-wise                                
+   ///   @param channel - the noise channel                                   
+   ///   @param octaves - the fractal settings                                
+   ///   @param out - [out] the fractal noise                                 
+   TEMPLATE() template<typename TME()::Stacking S, Count W>
+   void TME()::Stack(
+      const T (&p)[DIN][W], Offset channel, const Octaves& octaves, T (&out)[W]
+   ) noexcept {
+      T point[DIN][W];
+      for (Offset c = 0; c < DIN; ++c)
+         for (Offset j = 0; j < W; ++j)
+            point[c][j] = p[c][j];
+      for (Offset j = 0; j < W; ++j)
+         out[j] = 0;
+
+      T value[W];
+      T unused[DIN][W];
+      T amplitude = 1;
+      T total = 0;
+      for (Offset octave = 0; octave < octaves.mCount; ++octave) {
+         const auto seed = static_cast<::std::uint32_t>(channel + octave * DOUT);
+         Inner::Simplex<DIN, W, false>(point, seed, value, unused);
+
+         for (Offset j = 0; j < W; ++j) {
+            if constexpr (S == FBM)
+               out[j] += amplitude * value[j];
+            else if constexpr (S == Ridged) {
+               const T ridge = T {1} - ::std::abs(value[j]);
+               out[j] += amplitude * ridge * ridge;
+            }
+            else
+               out[j] += amplitude * ::std::abs(value[j]);
+         }
+
+         total += amplitude;
+         amplitude *= octaves.mGain;
+         for (Offset c = 0; c < DIN; ++c)
+            for (Offset j = 0; j < W; ++j)
+               point[c][j] *= octaves.mLacunarity;
+      }
+
+      // Normalize by the sum of all amplitudes                         
+      const T norm = total > T {0} ? T {1} / total : T {0};
+      for (Offset j = 0; j < W; ++j)
+         out[j] *= norm;
+   }
+
+   /// Run a channel function over all blocks of a stream, for all channels   
+   ///   @param points - the points                                           
+   ///   @param f - the function, filling a block of a single channel         
+   ///   @return the results, one lane per channel                            
+   TEMPLATE() template<class F>
+   auto TME()::Batch(const StreamType& points, F&& f) -> OutputStreamType {
+      const Count count = points.GetCount();
+      OutputStreamType result {count};
+
+      T p[DIN][Block];
+      T value[Block];
+      for (Offset start = 0; start < count; start += Block) {
+         // Lanes are padded to whole blocks, so reading a whole block  
+         // is always safe                                              
+         for (Offset c = 0; c < DIN; ++c) {
+            const T* lane = points.GetLane(c) + start;
+            for (Offset j = 0; j < Block; ++j)
+               p[c][j] = lane[j];
+         }
+
+         const Count n = ::std::min(Block, count - start);
+         for (Offset channel = 0; channel < DOUT; ++channel) {
+            f(p, channel, value);
+            T* out = result.GetLane(channel) + start;
+            for (Offset j = 0; j < n; ++j)
+               out[j] = value[j];
+         }
+      }
+      return result;
+   }
+
+} // namespace Langulus::Math
+
+#undef TEMPLATE
+#undef TME
\ No newline at end of file
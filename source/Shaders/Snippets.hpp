@@ -0,0 +1,583 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "TShaderLibrary.hpp"
+
+
+/// Shader equivalents of functions in this library, to be gathered with      
+/// TShaderLibrary. All of them work in single precision. Each snippet        
+/// defines exactly one function, named the same as the snippet               
+namespace Langulus::Math::Shaders
+{
+
+   namespace Inner
+   {
+      /// Type names by number of components                                  
+      constexpr Token TypeNames[] {"", "float", "vec2", "vec3", "vec4"};
+
+      /// Swizzles for a 3D axis, and for the plane perpendicular to it       
+      constexpr Token AxisNames[] {"x", "y", "z"};
+      constexpr Token PlaneNames[] {"yz", "xz", "xy"};
+
+      constexpr Token HoskinsNames[4][4] {
+         {"HoskinsHash11", "HoskinsHash12", "HoskinsHash13", "HoskinsHash14"},
+         {"HoskinsHash21", "HoskinsHash22", "HoskinsHash23", "HoskinsHash24"},
+         {"HoskinsHash31", "HoskinsHash32", "HoskinsHash33", "HoskinsHash34"},
+         {"HoskinsHash41", "HoskinsHash42", "HoskinsHash43", "HoskinsHash44"}
+      };
+   }
+
+
+   ///                                                                        
+   ///   Hoskins hash, same as THoskins<DOUT, DIN>::Hash                      
+   ///                                                                        
+   ///   THoskins::Hash<true> returns this code too, so there is a single     
+   /// copy of it                                                             
+   ///                                                                        
+   ///   Named HoskinsHash{DOUT}{DIN}, for example HoskinsHash22              
+   ///   @tparam DOUT - number of output dimensions                           
+   ///   @tparam DIN - number of input dimensions                             
+   ///                                                                        
+   template<Count DOUT, Count DIN>
+   struct HoskinsHash {
+      static_assert(DIN >= 1 and DIN <= 4,
+         "Hoskin's hashes work only for inputs of 1-4 components");
+      static_assert(DOUT >= 1 and DOUT <= 4,
+         "Hoskin's hashes work only for outputs of 1-4 components");
+
+      using Dependencies = Depends<>;
+      static constexpr Token Name = Inner::HoskinsNames[DOUT - 1][DIN - 1];
+      static constexpr ::std::array<Token, 3> Arguments {
+         Name, Inner::TypeNames[DOUT], Inner::TypeNames[DIN]
+      };
+
+   private:
+      static consteval Token GetCode() {
+         if constexpr (DIN == 1) {
+            if constexpr (DOUT == 1) {
+               return R"shader(
+                  {1} {0}({2} p) {{
+                     p = fract(p * 0.1031);
+                     p *= p + 33.33;
+                     p *= p + p;
+                     return fract(p);
+                  }}
+               )shader";
+            }
+            else if constexpr (DOUT == 2) {
+               return R"shader(
+                  {1} {0}({2} p) {{
+                     vec3 p3 = fract(p * vec3(0.1031, 0.1030, 0.0973));
+                     p3 += dot(p3, p3.yzx + 31.32);
+                     return fract((p3.xx + p3.yz) * p3.zy);
+                  }}
+               )shader";
+            }
+            else if constexpr (DOUT == 3) {
+               return R"shader(
+                  {1} {0}({2} p) {{
+                     vec3 p3 = fract(p * vec3(0.1031, 0.1030, 0.0973));
+                     p3 += dot(p3, p3.yzx + 33.33);
+                     return fract((p3.xxy + p3.yzz) * p3.zyx);
+                  }}
+               )shader";
+            }
+            else {
+               return R"shader(
+                  {1} {0}({2} p) {{
+                     vec4 p4 = fract(p * vec4(0.1031, 0.1030, 0.0973, 0.1099));
+                     p4 += dot(p4, p4.wzxy + 33.33);
+                     return fract((p4.xxyz + p4.yzzw) * p4.zywx);
+                  }}
+               )shader";
+            }
+         }
+         else if constexpr (DIN == 2) {
+            if constexpr (DOUT == 1) {
+               return R"shader(
+                  {1} {0}({2} p) {{
+                     vec3 p3 = fract(p.xyx * 0.1031);
+                     p3 += dot(p3, p3.yzx + 33.33);
+                     return fract((p3.x + p3.y) * p3.z);
+                  }}
+               )shader";
+            }
+            else if constexpr (DOUT == 2) {
+               return R"shader(
+                  {1} {0}({2} p) {{
+                     vec3 p3 = fract(p.xyx * vec3(0.1031, 0.1030, 0.0973));
+                     p3 += dot(p3, p3.yzx + 33.33);
+                     return fract((p3.xx + p3.yz) * p3.zy);
+                  }}
+               )shader";
+            }
+            else if constexpr (DOUT == 3) {
+               return R"shader(
+                  {1} {0}({2} p) {{
+                     vec3 p3 = fract(p.xyx * vec3(0.1031, 0.1030, 0.0973));
+                     p3 += dot(p3, p3.yxz + 33.33);
+                     return fract((p3.xxy + p3.yzz) * p3.zyx);
+                  }}
+               )shader";
+            }
+            else {
+               return R"shader(
+                  {1} {0}({2} p) {{
+                     vec4 p4 = fract(p.xyxy * vec4(0.1031, 0.1030, 0.0973, 0.1099));
+                     p4 += dot(p4, p4.wzxy + 33.33);
+                     return fract((p4.xxyz + p4.yzzw) * p4.zywx);
+                  }}
+               )shader";
+            }
+         }
+         else if constexpr (DIN == 3) {
+            if constexpr (DOUT == 1) {
+               return R"shader(
+                  {1} {0}({2} p) {{
+                     p = fract(p * 0.1031);
+                     p += dot(p, p.zyx + 31.32);
+                     return fract((p.x + p.y) * p.z);
+                  }}
+               )shader";
+            }
+            else if constexpr (DOUT == 2) {
+               return R"shader(
+                  {1} {0}({2} p) {{
+                     p = fract(p * vec3(0.1031, 0.1030, 0.0973));
+                     p += dot(p, p.yzx + 33.33);
+                     return fract((p.xx + p.yz) * p.zy);
+                  }}
+               )shader";
+            }
+            else if constexpr (DOUT == 3) {
+               return R"shader(
+                  {1} {0}({2} p) {{
+                     p = fract(p * vec3(0.1031, 0.1030, 0.0973));
+                     p += dot(p, p.yxz + 33.33);
+                     return fract((p.xxy + p.yxx) * p.zyx);
+                  }}
+               )shader";
+            }
+            else {
+               return R"shader(
+                  {1} {0}({2} p) {{
+                     vec4 p4 = fract(p.xyzx * vec4(0.1031, 0.1030, 0.0973, 0.1099));
+                     p4 += dot(p4, p4.wzxy + 33.33);
+                     return fract((p4.xxyz + p4.yzzw) * p4.zywx);
+                  }}
+               )shader";
+            }
+         }
+         else {
+            if constexpr (DOUT == 1) {
+               return R"shader(
+                  {1} {0}({2} p) {{
+                     p = fract(p * 0.1031);
+                     p += dot(p, p.ywxz + 32.31);
+                     return fract((p.x + p.y) * (p.z + p.w));
+                  }}
+               )shader";
+            }
+            else if constexpr (DOUT == 2) {
+               return R"shader(
+                  {1} {0}({2} p) {{
+                     p = fract(p * vec4(0.1031, 0.1030, 0.0973, 0.1099));
+                     p += dot(p, p.wzxy + 33.33);
+                     return fract((p.xw + p.yz) * p.zy);
+                  }}
+               )shader";
+            }
+            else if constexpr (DOUT == 3) {
+               return R"shader(
+                  {1} {0}({2} p) {{
+                     p = fract(p * vec4(0.1031, 0.1030, 0.0973, 0.1099));
+                     p += dot(p, p.wzxy + 33.33);
+                     return fract((p.zwx + p.yxw) * p.zwy);
+                  }}
+               )shader";
+            }
+            else {
+               return R"shader(
+                  {1} {0}({2} p) {{
+                     p = fract(p * vec4(0.1031, 0.1030, 0.0973, 0.1099));
+                     p += dot(p, p.wzxy + 33.33);
+                     return fract((p.xxyz + p.yzzw) * p.zywx);
+                  }}
+               )shader";
+            }
+         }
+      }
+
+   public:
+      static constexpr Token Code = GetCode();
+   };
+
+   ///                                                                        
+   ///   PCG hash of an unsigned integer, same as PCGHash                     
+   ///                                                                        
+   struct PCGHash {
+      using Dependencies = Depends<>;
+      static constexpr Token Name = "PCGHash";
+      static constexpr Token Code = R"shader(
+         uint PCGHash(uint v) {{
+            uint state = v * 747796405u + 2891336453u;
+            uint word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+            return (word >> 22u) ^ word;
+         }}
+      )shader";
+   };
+
+
+   ///                                                                        
+   ///   Simplex noise of a single channel, in the range [-1:1]               
+   ///                                                                        
+   ///   Named SimplexNoise1{DIN}. An approximation of TSimplex<1, DIN>,      
+   /// that uses Hoskins hashes for the gradients, so it isn't the same as    
+   /// noise generated on the CPU                                             
+   ///   @tparam DIN - number of input dimensions, 2 or 3                     
+   ///                                                                        
+   template<Count DIN>
+   struct SimplexNoise {
+      static_assert(DIN == 2 or DIN == 3,
+         "Simplex noise shaders exist only for 2 and 3 dimensions");
+
+      using Dependencies = Depends<HoskinsHash<DIN, DIN>>;
+      static constexpr Token Name = DIN == 2 ? "SimplexNoise12" : "SimplexNoise13";
+      static constexpr ::std::array<Token, 2> Arguments {
+         Name, HoskinsHash<DIN, DIN>::Name
+      };
+      static constexpr Token Code = DIN == 2 ? R"shader(
+         float {0}(vec2 p) {{
+            const float K1 = 0.366025404;
+            const float K2 = 0.211324865;
+
+            vec2 i = floor(p + (p.x + p.y) * K1);
+            vec2 a = p - i + (i.x + i.y) * K2;
+            vec2 o = (a.x > a.y) ? vec2(1.0, 0.0) : vec2(0.0, 1.0);
+            vec2 b = a - o + K2;
+            vec2 c = a - 1.0 + 2.0 * K2;
+            vec3 h = max(0.5 - vec3(dot(a, a), dot(b, b), dot(c, c)), 0.0);
+            vec3 n = h * h * h * h * vec3(
+               dot(a, {1}(i) * 2.0 - 1.0),
+               dot(b, {1}(i + o) * 2.0 - 1.0),
+               dot(c, {1}(i + 1.0) * 2.0 - 1.0)
+            );
+            return dot(n, vec3(70.0, 70.0, 70.0));
+         }}
+      )shader" : R"shader(
+         float {0}(vec3 p) {{
+            const float F3 = 0.333333333;
+            const float G3 = 0.166666667;
+
+            vec3 s = floor(p + (p.x + p.y + p.z) * F3);
+            vec3 x = p - s + (s.x + s.y + s.z) * G3;
+            vec3 e = step(vec3(0.0, 0.0, 0.0), x - x.yzx);
+            vec3 i1 = e * (1.0 - e.zxy);
+            vec3 i2 = 1.0 - e.zxy * (1.0 - e);
+            vec3 x1 = x - i1 + G3;
+            vec3 x2 = x - i2 + 2.0 * G3;
+            vec3 x3 = x - 1.0 + 3.0 * G3;
+
+            vec4 w = max(0.6 - vec4(dot(x, x), dot(x1, x1), dot(x2, x2), dot(x3, x3)), 0.0);
+            vec4 d = vec4(
+               dot({1}(s) * 2.0 - 1.0, x),
+               dot({1}(s + i1) * 2.0 - 1.0, x1),
+               dot({1}(s + i2) * 2.0 - 1.0, x2),
+               dot({1}(s + 1.0) * 2.0 - 1.0, x3)
+            );
+            w *= w;
+            w *= w;
+            return dot(d * w, vec4(52.0, 52.0, 52.0, 52.0));
+         }}
+      )shader";
+   };
+
+   ///                                                                        
+   ///   Fractional Brownian motion of simplex noise, in the range [-1:1]     
+   ///                                                                        
+   ///   Named SimplexFractal1{DIN}. Same stacking as TSimplex::Fractal<FBM>  
+   ///   @tparam DIN - number of input dimensions, 2 or 3                     
+   ///                                                                        
+   template<Count DIN>
+   struct SimplexFractal {
+      using Dependencies = Depends<SimplexNoise<DIN>>;
+      static constexpr Token Name = DIN == 2 ? "SimplexFractal12" : "SimplexFractal13";
+      static constexpr ::std::array<Token, 3> Arguments {
+         Name, Inner::TypeNames[DIN], SimplexNoise<DIN>::Name
+      };
+      static constexpr Token Code = R"shader(
+         float {0}({1} p, int octaves, float lacunarity, float gain) {{
+            float sum = 0.0;
+            float amplitude = 1.0;
+            float total = 0.0;
+            for (int i = 0; i < octaves; ++i) {{
+               sum += {2}(p) * amplitude;
+               total += amplitude;
+               p *= lacunarity;
+               amplitude *= gain;
+            }}
+            return sum / total;
+         }}
+      )shader";
+   };
+
+
+   ///                                                                        
+   ///   Signed distance to a centered 2D circle, or a 3D sphere              
+   ///                                                                        
+   ///   Named SDFSphere{C}, takes the point and the radius                   
+   ///   @tparam C - number of dimensions                                     
+   ///                                                                        
+   template<Count C>
+   struct SDFSphere {
+      static_assert(C == 2 or C == 3, "Unsupported sphere dimensions");
+
+      using Dependencies = Depends<>;
+      static constexpr Token Name = C == 2 ? "SDFSphere2" : "SDFSphere3";
+      static constexpr ::std::array<Token, 2> Arguments {
+         Name, Inner::TypeNames[C]
+      };
+      static constexpr Token Code = R"shader(
+         float {0}({1} p, float radius) {{
+            return length(p) - radius;
+         }}
+      )shader";
+   };
+
+   ///                                                                        
+   ///   Signed distance to a centered 2D/3D box                              
+   ///                                                                        
+   ///   Named SDFBox{C}, takes the point and the box half-size               
+   ///   @tparam C - number of dimensions                                     
+   ///                                                                        
+   template<Count C>
+   struct SDFBox {
+      static_assert(C == 2 or C == 3, "Unsupported box dimensions");
+
+      using Dependencies = Depends<>;
+      static constexpr Token Name = C == 2 ? "SDFBox2" : "SDFBox3";
+      static constexpr ::std::array<Token, 3> Arguments {
+         Name, Inner::TypeNames[C],
+         C == 2 ? "max(d.x, d.y)" : "max(d.x, max(d.y, d.z))"
+      };
+      static constexpr Token Code = R"shader(
+         float {0}({1} p, {1} size) {{
+            {1} d = abs(p) - size;
+            return length(max(d, 0.0)) + min({2}, 0.0);
+         }}
+      )shader";
+   };
+
+   ///                                                                        
+   ///   Signed distance to a centered 2D/3D rounded box                      
+   ///                                                                        
+   ///   Named SDFBoxRounded{C}, takes the point, the box half-size, and the  
+   /// radius of the rounding                                                 
+   ///   @tparam C - number of dimensions                                     
+   ///                                                                        
+   template<Count C>
+   struct SDFBoxRounded {
+      using Dependencies = Depends<SDFBox<C>>;
+      static constexpr Token Name = C == 2 ? "SDFBoxRounded2" : "SDFBoxRounded3";
+      static constexpr ::std::array<Token, 3> Arguments {
+         Name, Inner::TypeNames[C], SDFBox<C>::Name
+      };
+      static constexpr Token Code = R"shader(
+         float {0}({1} p, {1} size, float radius) {{
+            return {2}(p, size) - radius;
+         }}
+      )shader";
+   };
+
+   ///                                                                        
+   ///   Signed distance to a 2D/3D plane                                     
+   ///                                                                        
+   ///   Named SDFPlane{C}, takes the point, the plane normal and offset      
+   ///   @tparam C - number of dimensions                                     
+   ///                                                                        
+   template<Count C>
+   struct SDFPlane {
+      static_assert(C == 2 or C == 3, "Unsupported plane dimensions");
+
+      using Dependencies = Depends<>;
+      static constexpr Token Name = C == 2 ? "SDFPlane2" : "SDFPlane3";
+      static constexpr ::std::array<Token, 2> Arguments {
+         Name, Inner::TypeNames[C]
+      };
+      static constexpr Token Code = R"shader(
+         float {0}({1} p, {1} normal, float offset) {{
+            return dot(p, normal) + offset;
+         }}
+      )shader";
+   };
+
+   ///                                                                        
+   ///   Signed distance to a centered 3D infinite cylinder                   
+   ///                                                                        
+   ///   Named SDFCylinder{D}, for example SDFCylinderY, takes the point and  
+   /// the radius                                                             
+   ///   @tparam D - the axis the cylinder extends along                      
+   ///                                                                        
+   template<CT::Dimension D = Traits::Y>
+   struct SDFCylinder {
+      static_assert(D::Index < 3, "Can't extend cylinder in that dimension");
+
+      using Dependencies = Depends<>;
+      static constexpr Token Name = ::std::array<Token, 3> {
+         "SDFCylinderX", "SDFCylinderY", "SDFCylinderZ"}[D::Index];
+      static constexpr ::std::array<Token, 2> Arguments {
+         Name, Inner::PlaneNames[D::Index]
+      };
+      static constexpr Token Code = R"shader(
+         float {0}(vec3 p, float radius) {{
+            return length(p.{1}) - radius;
+         }}
+      )shader";
+   };
+
+   ///                                                                        
+   ///   Signed distance to a centered 3D capped cylinder                     
+   ///                                                                        
+   ///   Named SDFCylinderCapped{D}, takes the point, the radius and the      
+   /// half-height                                                            
+   ///   @tparam D - the axis the cylinder extends along                      
+   ///                                                                        
+   template<CT::Dimension D = Traits::Y>
+   struct SDFCylinderCapped {
+      static_assert(D::Index < 3, "Can't extend cylinder in that dimension");
+
+      using Dependencies = Depends<>;
+      static constexpr Token Name = ::std::array<Token, 3> {
+         "SDFCylinderCappedX", "SDFCylinderCappedY", "SDFCylinderCappedZ"}[D::Index];
+      static constexpr ::std::array<Token, 3> Arguments {
+         Name, Inner::PlaneNames[D::Index], Inner::AxisNames[D::Index]
+      };
+      static constexpr Token Code = R"shader(
+         float {0}(vec3 p, float radius, float height) {{
+            vec2 d = vec2(length(p.{1}), abs(p.{2})) - vec2(radius, height);
+            return length(max(d, 0.0)) + min(max(d.x, d.y), 0.0);
+         }}
+      )shader";
+   };
+
+   ///                                                                        
+   ///   Signed distance to a 3D cone, with its tip at the origin             
+   ///                                                                        
+   ///   Named SDFCone{D}, takes the point, the angle in radians, and the     
+   /// height                                                                 
+   ///   @tparam D - the axis the cone extends along                          
+   ///                                                                        
+   template<CT::Dimension D = Traits::Y>
+   struct SDFCone {
+      static_assert(D::Index < 3, "Can't extend cone in that dimension");
+
+      using Dependencies = Depends<>;
+      static constexpr Token Name = ::std::array<Token, 3> {
+         "SDFConeX", "SDFConeY", "SDFConeZ"}[D::Index];
+      static constexpr ::std::array<Token, 3> Arguments {
+         Name, Inner::PlaneNames[D::Index], Inner::AxisNames[D::Index]
+      };
+      static constexpr Token Code = R"shader(
+         float {0}(vec3 p, float angle, float height) {{
+            vec2 c = vec2(sin(angle), cos(angle));
+            return max(dot(c, vec2(length(p.{1}), p.{2})), -height - p.{2});
+         }}
+      )shader";
+   };
+
+   ///                                                                        
+   ///   Signed distance to a centered 3D torus                               
+   ///                                                                        
+   ///   Named SDFTorus{D}, takes the point, the outer and inner radius       
+   ///   @tparam D - the axis the torus revolves around                       
+   ///                                                                        
+   template<CT::Dimension D = Traits::Y>
+   struct SDFTorus {
+      static_assert(D::Index < 3, "Can't extend torus in that dimension");
+
+      using Dependencies = Depends<>;
+      static constexpr Token Name = ::std::array<Token, 3> {
+         "SDFTorusX", "SDFTorusY", "SDFTorusZ"}[D::Index];
+      static constexpr ::std::array<Token, 3> Arguments {
+         Name, Inner::PlaneNames[D::Index], Inner::AxisNames[D::Index]
+      };
+      static constexpr Token Code = R"shader(
+         float {0}(vec3 p, float outerRadius, float innerRadius) {{
+            vec2 q = vec2(length(p.{1}) - outerRadius, p.{2});
+            return length(q) - innerRadius;
+         }}
+      )shader";
+   };
+
+
+   ///                                                                        
+   ///   Convert a color from sRGB to linear RGB                              
+   ///                                                                        
+   struct SRGBToLinear {
+      using Dependencies = Depends<>;
+      static constexpr Token Name = "SRGBToLinear";
+      static constexpr Token Code = R"shader(
+         vec3 SRGBToLinear(vec3 c) {{
+            vec3 low = c / 12.92;
+            vec3 high = pow((c + 0.055) / 1.055, vec3(2.4, 2.4, 2.4));
+            return mix(high, low, step(c, vec3(0.04045, 0.04045, 0.04045)));
+         }}
+      )shader";
+   };
+
+   ///                                                                        
+   ///   Convert a color from linear RGB to sRGB                              
+   ///                                                                        
+   struct LinearToSRGB {
+      using Dependencies = Depends<>;
+      static constexpr Token Name = "LinearToSRGB";
+      static constexpr Token Code = R"shader(
+         vec3 LinearToSRGB(vec3 c) {{
+            vec3 low = c * 12.92;
+            vec3 high = pow(c, vec3(1.0 / 2.4, 1.0 / 2.4, 1.0 / 2.4)) * 1.055 - 0.055;
+            return mix(high, low, step(c, vec3(0.0031308, 0.0031308, 0.0031308)));
+         }}
+      )shader";
+   };
+
+   ///                                                                        
+   ///   Convert a color from RGB to hue, saturation and value, all in [0:1]  
+   ///   Credit to Sam Hocevar                                                
+   ///                                                                        
+   struct RGBToHSV {
+      using Dependencies = Depends<>;
+      static constexpr Token Name = "RGBToHSV";
+      static constexpr Token Code = R"shader(
+         vec3 RGBToHSV(vec3 c) {{
+            vec4 K = vec4(0.0, -1.0 / 3.0, 2.0 / 3.0, -1.0);
+            vec4 p = mix(vec4(c.zy, K.wz), vec4(c.yz, K.xy), step(c.z, c.y));
+            vec4 q = mix(vec4(p.xyw, c.x), vec4(c.x, p.yzx), step(p.x, c.x));
+            float d = q.x - min(q.w, q.y);
+            float e = 1.0e-10;
+            return vec3(abs(q.z + (q.w - q.y) / (6.0 * d + e)), d / (q.x + e), q.x);
+         }}
+      )shader";
+   };
+
+   ///                                                                        
+   ///   Convert a color from hue, saturation and value to RGB                
+   ///   Credit to Sam Hocevar                                                
+   ///                                                                        
+   struct HSVToRGB {
+      using Dependencies = Depends<>;
+      static constexpr Token Name = "HSVToRGB";
+      static constexpr Token Code = R"shader(
+         vec3 HSVToRGB(vec3 c) {{
+            vec4 K = vec4(1.0, 2.0 / 3.0, 1.0 / 3.0, 3.0);
+            vec3 p = abs(fract(c.xxx + K.xyz) * 6.0 - K.www);
+            return c.z * mix(K.xxx, clamp(p - K.xxx, 0.0, 1.0), c.y);
+         }}
+      )shader";
+   };
+
+} // namespace Langulus::Math::Shaders
\ No newline at end of file
@@ -0,0 +1,259 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "../Dimensions.hpp"
+#include <array>
+#include <string>
+
+
+namespace Langulus::Math
+{
+
+   /// Shading languages, that libraries can be generated for                 
+   enum class ShaderLanguage {
+      GLSL, HLSL
+   };
+
+   namespace Shaders
+   {
+
+      /// List of snippets, that a snippet calls into                         
+      template<class...T>
+      struct Depends {};
+
+      ///                                                                     
+      ///   Compatibility prelude for a shading language                      
+      ///                                                                     
+      ///   All snippets are written in GLSL, using only the subset of it,    
+      /// that translates to HLSL with a few macros - no single-scalar vector 
+      /// constructors, no mod(), no atan(y, x), no matrices                  
+      ///                                                                     
+      template<ShaderLanguage LANG>
+      struct Prelude {
+         using Dependencies = Depends<>;
+         static constexpr Token Name = "Prelude";
+         static constexpr Token Code = LANG == ShaderLanguage::HLSL
+            ? R"shader(
+               #define vec2 float2
+               #define vec3 float3
+               #define vec4 float4
+               #define fract frac
+               #define mix lerp
+            )shader" : "";
+      };
+
+   } // namespace Langulus::Math::Shaders
+
+} // namespace Langulus::Math
+
+namespace Langulus::CT
+{
+
+   /// A piece of shader code, generating a single function                   
+   ///   @attention Code is in the same format as TemplateFill, i.e. {N} is   
+   ///      replaced with the Nth of the snippet's Arguments, if any, and     
+   ///      braces are escaped by doubling them                               
+   template<class...T>
+   concept ShaderSnippet = ((requires {
+         Token {T::Name};
+         Token {T::Code};
+         typename T::Dependencies;
+      }) and ...);
+
+} // namespace Langulus::CT
+
+namespace Langulus::Math
+{
+   namespace Inner
+   {
+
+      /// Check if a snippet list contains a snippet                          
+      template<class LIST, class T>
+      constexpr bool ShaderListContains = false;
+
+      template<class...L, class T>
+      constexpr bool ShaderListContains<Shaders::Depends<L...>, T> = (CT::Same<L, T> or ...);
+
+      /// Append snippets to a list, each after its dependencies, skipping    
+      /// the ones already in the list                                        
+      ///   @attention circular dependencies never resolve                    
+      template<class LIST, class...T>
+      struct ShaderResolve {
+         using Type = LIST;
+      };
+
+      template<class LIST, class DEPENDENCIES>
+      struct ShaderResolveDependencies;
+
+      template<class LIST, class...D>
+      struct ShaderResolveDependencies<LIST, Shaders::Depends<D...>> {
+         using Type = typename ShaderResolve<LIST, D...>::Type;
+      };
+
+      template<class LIST, class T>
+      struct ShaderAppend;
+
+      template<class...L, class T>
+      struct ShaderAppend<Shaders::Depends<L...>, T> {
+         using Type = Shaders::Depends<L..., T>;
+      };
+
+      template<class LIST, class T, class...MORE>
+      struct ShaderResolve<LIST, T, MORE...> {
+         // If T is already in the list, so are all of its dependencies 
+         using WithDependencies = typename ShaderResolveDependencies<
+            LIST, typename T::Dependencies>::Type;
+         using WithT = Conditional<ShaderListContains<LIST, T>, LIST,
+            typename ShaderAppend<WithDependencies, T>::Type>;
+
+         using Type = typename ShaderResolve<WithT, MORE...>::Type;
+      };
+
+      /// Fill a snippet's code, and append it to a library                   
+      /// The indentation common to all lines is removed, as well as any      
+      /// blank lines around the code                                         
+      ///   @param out - [out] the library to append to                       
+      ///   @param code - the code to fill in                                 
+      ///   @param args - the arguments to fill in, indexing past them        
+      ///      fails compilation, since this runs at compile-time             
+      constexpr void FillShaderCode(::std::string& out, Token code, const Token* args) {
+         Count indent = code.size();
+         for (Offset i = 0; i <= code.size();) {
+            auto end = code.find('\n', i);
+            if (end == Token::npos)
+               end = code.size();
+
+            const auto first = code.substr(i, end - i).find_first_not_of(" \t");
+            if (first != Token::npos and first < indent)
+               indent = first;
+            i = end + 1;
+         }
+
+         Count blanks = 0;
+         bool started = false;
+         for (Offset i = 0; i <= code.size();) {
+            auto end = code.find('\n', i);
+            if (end == Token::npos)
+               end = code.size();
+
+            const auto line = code.substr(i, end - i);
+            i = end + 1;
+            if (line.find_first_not_of(" \t") == Token::npos) {
+               // Blank lines are deferred, so trailing ones are dropped
+               if (started)
+                  ++blanks;
+               continue;
+            }
+
+            for (; blanks; --blanks)
+               out += '\n';
+            started = true;
+
+            for (Offset c = indent; c < line.size(); ++c) {
+               if ((line[c] == '{' or line[c] == '}') and c + 1 < line.size() and line[c + 1] == line[c]) {
+                  out += line[c++];
+               }
+               else if (line[c] == '{') {
+                  Offset index = 0;
+                  while (line[++c] != '}')
+                     index = index * 10 + (line[c] - '0');
+                  out += args[index];
+               }
+               else out += line[c];
+            }
+            out += '\n';
+         }
+      }
+
+      /// Generate the code of all snippets in a list, in order               
+      ///   @return the library code                                          
+      template<class...T>
+      constexpr ::std::string GenerateShaderLibrary(Shaders::Depends<T...>) {
+         ::std::string out;
+         const auto append = [&out]<class S>() {
+            if (S::Code.empty())
+               return;
+            if (not out.empty())
+               out += '\n';
+
+            if constexpr (requires { S::Arguments; })
+               FillShaderCode(out, S::Code, S::Arguments.data());
+            else
+               FillShaderCode(out, S::Code, nullptr);
+         };
+
+         (append.template operator()<T>(), ...);
+         return out;
+      }
+
+      ///                                                                     
+      ///   Compile-time cache of a generated library                         
+      ///                                                                     
+      ///   Keyed by the resolved snippet list, so libraries that resolve to  
+      /// the same snippets share the same string - for example one that      
+      /// requests a noise along with the hash it uses, and one that only     
+      /// requests the noise                                                  
+      ///                                                                     
+      template<class LIST>
+      struct ShaderStorage {
+         static constexpr Count Size = GenerateShaderLibrary(LIST {}).size();
+         static constexpr auto Data = [] {
+            ::std::array<char, Size + 1> data {};
+            const auto code = GenerateShaderLibrary(LIST {});
+            for (Offset i = 0; i < Size; ++i)
+               data[i] = code[i];
+            return data;
+         }();
+      };
+
+      /// Get the names of all snippets in a list, in order                   
+      template<class...T>
+      consteval auto GetShaderNames(Shaders::Depends<T...>) {
+         return ::std::array<Token, sizeof...(T)> {T::Name...};
+      }
+
+   } // namespace Langulus::Math::Inner
+
+
+   ///                                                                        
+   ///   Shader library                                                       
+   ///                                                                        
+   ///   Gathers the requested snippets and everything they call into a       
+   /// single piece of shader code, where every function is defined exactly   
+   /// once, and before any function that calls it. The code is generated     
+   /// at compile-time, so getting it for a shader permutation costs nothing  
+   ///                                                                        
+   ///   @tparam LANG - the shading language to generate code for             
+   ///   @tparam T... - the requested snippets, see Shaders namespace         
+   ///                                                                        
+   template<ShaderLanguage LANG, CT::ShaderSnippet...T>
+   struct TShaderLibrary {
+      // All snippets, in the order they are defined in Code            
+      using Snippets = typename Inner::ShaderResolve<
+         Shaders::Depends<>, Shaders::Prelude<LANG>, T...>::Type;
+
+   private:
+      using Storage = Inner::ShaderStorage<Snippets>;
+
+   public:
+      static constexpr ShaderLanguage Language = LANG;
+
+      // The names of the snippets, in the order they are defined       
+      static constexpr auto Names = Inner::GetShaderNames(Snippets {});
+
+      // The generated code                                             
+      static constexpr Token Code {Storage::Data.data(), Storage::Size};
+
+      /// Check if a snippet is defined in the library                        
+      template<CT::ShaderSnippet S>
+      NOD() static consteval bool Contains() noexcept {
+         return Inner::ShaderListContains<Snippets, S>;
+      }
+   };
+
+} // namespace Langulus::Math
\ No newline at end of file
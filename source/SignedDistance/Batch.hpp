@@ -0,0 +1,69 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "../Primitives/TBox.hpp"
+#include "../Primitives/TCone.hpp"
+#include "../Primitives/TCylinder.hpp"
+#include "../Primitives/TPlane.hpp"
+#include "../Primitives/TSphere.hpp"
+#include "../Primitives/TTorus.hpp"
+#include "../Primitives/TTriangle.hpp"
+#include "../Vectors/TVectorStream.hpp"
+
+
+namespace Langulus::Math
+{
+
+   namespace Inner
+   {
+
+      /// Distance callables, that evaluate a whole stream of points at once  
+      template<class F, class T, Count C>
+      concept BatchedSDF = requires (F& f, const TVectorStream<T, C>& points, T* out) {
+         f(points, out);
+      };
+
+   } // namespace Langulus::Math::Inner
+
+   ///                                                                        
+   ///   Batched signed distance functions                                    
+   ///                                                                        
+   ///   Evaluate a signed distance function for a whole stream of points,    
+   /// writing one distance per point. Points are read a block (one 512-bit   
+   /// register worth) at a time, from each lane of the stream, and all       
+   /// lanes of the block are evaluated with the same instructions - any      
+   /// per-point decisions are selects, never branches, so compilers can      
+   /// vectorize them at full width. Results match the scalar functions.      
+   ///   The output array must have room for points.GetCount() distances.     
+   ///                                                                        
+   template<CT::Real T, Count C>
+   void SignedDistance(const TVectorStream<T, C>&, const TBox<TVector<T, C>>&, T*) noexcept;
+   template<CT::Real T, Count C>
+   void SignedDistance(const TVectorStream<T, C>&, const TBoxRounded<TVector<T, C>>&, T*) noexcept;
+   template<CT::Real T, CT::Dimension D>
+   void SignedDistance(const TVectorStream<T, 3>&, const TCone<TVector<T, 3>, D>&, T*) noexcept;
+   template<CT::Real T, CT::Dimension D>
+   void SignedDistance(const TVectorStream<T, 3>&, const TCylinder<TVector<T, 3>, D>&, T*) noexcept;
+   template<CT::Real T, CT::Dimension D>
+   void SignedDistance(const TVectorStream<T, 3>&, const TCylinderCapped<TVector<T, 3>, D>&, T*) noexcept;
+   template<CT::Real T, Count C>
+   void SignedDistance(const TVectorStream<T, C>&, const TPlane<TVector<T, C>>&, T*) noexcept;
+   template<CT::Real T, Count C>
+   void SignedDistance(const TVectorStream<T, C>&, const TSphere<TVector<T, C>>&, T*) noexcept;
+   template<CT::Real T, Count C>
+   void SignedDistance(const TVectorStream<T, C>&, const TEllipsoid<TVector<T, C>>&, T*) noexcept;
+   template<CT::Real T, CT::Dimension D>
+   void SignedDistance(const TVectorStream<T, 3>&, const TTorus<TVector<T, 3>, D>&, T*) noexcept;
+   template<CT::Real T, Count C>
+   void SignedDistance(const TVectorStream<T, C>&, const TTriangle<TVector<T, C>>&, T*) noexcept;
+
+   /// Same as above, but return the distances in a new container             
+   template<CT::Real T, Count C, class P> NOD()
+   auto SignedDistance(const TVectorStream<T, C>&, const P&) -> TMany<T>;
+
+} // namespace Langulus::Math
\ No newline at end of file
@@ -0,0 +1,392 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Batch.hpp"
+#include "../Vectors/TVectorStream.inl"
+#include <cmath>
+#include <cstring>
+
+
+namespace Langulus::Math
+{
+   namespace Inner
+   {
+
+      /// Run a distance kernel over all blocks of a point stream             
+      /// Full blocks are written directly to the output, while the last      
+      /// partial block goes through a local buffer, because the stream's     
+      /// padding is readable, but the output has no padding                  
+      ///   @param points - the points                                        
+      ///   @param out - [out] the distances                                  
+      ///   @param kernel - evaluates a block of distances, given pointers    
+      ///      to the first point of the block in each lane                   
+      template<CT::Real T, Count C, class F>
+      void EvaluateBlocks(const TVectorStream<T, C>& points, T* out, F&& kernel) noexcept {
+         constexpr Count Block = TVectorStream<T, C>::Block;
+         const Count count = points.GetCount();
+
+         for (Offset start = 0; start < count; start += Block) {
+            const T* p[C];
+            for (Offset c = 0; c < C; ++c)
+               p[c] = points.GetLane(c) + start;
+
+            if (count - start >= Block)
+               kernel(p, out + start);
+            else {
+               T tail[Block];
+               kernel(p, tail);
+               ::std::memcpy(out + start, tail, (count - start) * sizeof(T));
+            }
+         }
+      }
+
+      /// Branchless sign, zero for zero, same as Sign()                      
+      template<CT::Real T> LANGULUS(INLINED)
+      constexpr T SignOf(T x) noexcept {
+         return T(x > 0) - T(x < 0);
+      }
+
+      /// Branchless saturation, same as Saturate()                           
+      template<CT::Real T> LANGULUS(INLINED)
+      constexpr T Clamp01(T x) noexcept {
+         return ::std::min(::std::max(x, T {0}), T {1});
+      }
+
+      /// Block kernel shared between boxes and rounded boxes                 
+      template<CT::Real T, Count C>
+      void BoxBlock(const T* const* p, T* d, const TVector<T, C>& offsets, T shrink) noexcept {
+         constexpr Count Block = TVectorStream<T, C>::Block;
+         for (Offset j = 0; j < Block; ++j) {
+            T outside = 0;
+            T inside = -::std::numeric_limits<T>::infinity();
+            for (Offset c = 0; c < C; ++c) {
+               const T q = ::std::abs(p[c][j]) - offsets[c];
+               const T positive = ::std::max(q, T {0});
+               outside += positive * positive;
+               inside = ::std::max(inside, q);
+            }
+            d[j] = ::std::sqrt(outside) + ::std::min(inside, T {0}) - shrink;
+         }
+      }
+
+      ///                                                                     
+      ///   Block kernels                                                     
+      ///                                                                     
+      /// Each evaluates the distances of one block of points, given as a     
+      /// pointer per lane, and writes one block of distances. They are also  
+      /// used by the SDF tape interpreter, on its point registers            
+      ///                                                                     
+      template<CT::Real T, Count C> LANGULUS(INLINED)
+      void SignedDistanceBlock(const T* const* p, T* d, const TBox<TVector<T, C>>& box) noexcept {
+         BoxBlock<T, C>(p, d, box.mOffsets, T {0});
+      }
+
+      template<CT::Real T, Count C> LANGULUS(INLINED)
+      void SignedDistanceBlock(const T* const* p, T* d, const TBoxRounded<TVector<T, C>>& box) noexcept {
+         BoxBlock<T, C>(p, d, box.mOffsets, box.mRadius);
+      }
+
+      template<CT::Real T, CT::Dimension D>
+      void SignedDistanceBlock(const T* const* p, T* d, const TCone<TVector<T, 3>, D>& cone) noexcept {
+         constexpr Count Block = TVectorStream<T, 3>::Block;
+         constexpr Offset A = D::Index;
+         constexpr Offset U = (A + 1) % 3;
+         constexpr Offset V = (A + 2) % 3;
+         const T sn = static_cast<T>(Sin(cone.mAngle));
+         const T cs = static_cast<T>(Cos(cone.mAngle));
+         const T height = cone.mHeight;
+
+         for (Offset j = 0; j < Block; ++j) {
+            const T q = ::std::sqrt(p[U][j] * p[U][j] + p[V][j] * p[V][j]);
+            d[j] = ::std::max(sn * q + cs * p[A][j], -height - p[A][j]);
+         }
+      }
+
+      template<CT::Real T, CT::Dimension D>
+      void SignedDistanceBlock(const T* const* p, T* d, const TCylinder<TVector<T, 3>, D>& cylinder) noexcept {
+         constexpr Count Block = TVectorStream<T, 3>::Block;
+         constexpr Offset U = (D::Index + 1) % 3;
+         constexpr Offset V = (D::Index + 2) % 3;
+         const T radius = cylinder.mRadius;
+
+         for (Offset j = 0; j < Block; ++j)
+            d[j] = ::std::sqrt(p[U][j] * p[U][j] + p[V][j] * p[V][j]) - radius;
+      }
+
+      template<CT::Real T, CT::Dimension D>
+      void SignedDistanceBlock(const T* const* p, T* d, const TCylinderCapped<TVector<T, 3>, D>& cylinder) noexcept {
+         constexpr Count Block = TVectorStream<T, 3>::Block;
+         constexpr Offset A = D::Index;
+         constexpr Offset U = (A + 1) % 3;
+         constexpr Offset V = (A + 2) % 3;
+         const T radius = cylinder.mRadius;
+         const T height = cylinder.mHeight;
+
+         for (Offset j = 0; j < Block; ++j) {
+            const T dr = ::std::sqrt(p[U][j] * p[U][j] + p[V][j] * p[V][j]) - radius;
+            const T dh = ::std::abs(p[A][j]) - height;
+            const T pr = ::std::max(dr, T {0});
+            const T ph = ::std::max(dh, T {0});
+            d[j] = ::std::sqrt(pr * pr + ph * ph) + ::std::min(::std::max(dr, dh), T {0});
+         }
+      }
+
+      template<CT::Real T, Count C>
+      void SignedDistanceBlock(const T* const* p, T* d, const TPlane<TVector<T, C>>& plane) noexcept {
+         constexpr Count Block = TVectorStream<T, C>::Block;
+         for (Offset j = 0; j < Block; ++j)
+            d[j] = plane.mOffset;
+         for (Offset c = 0; c < C; ++c) {
+            const T n = plane.mNormal[c];
+            for (Offset j = 0; j < Block; ++j)
+               d[j] += p[c][j] * n;
+         }
+      }
+
+      template<CT::Real T, Count C>
+      void SignedDistanceBlock(const T* const* p, T* d, const TSphere<TVector<T, C>>& sphere) noexcept {
+         constexpr Count Block = TVectorStream<T, C>::Block;
+         const T radius = sphere.mRadius;
+         for (Offset j = 0; j < Block; ++j) {
+            T length2 = 0;
+            for (Offset c = 0; c < C; ++c)
+               length2 += p[c][j] * p[c][j];
+            d[j] = ::std::sqrt(length2) - radius;
+         }
+      }
+
+      template<CT::Real T, Count C>
+      void SignedDistanceBlock(const T* const* p, T* d, const TEllipsoid<TVector<T, C>>& ellipsoid) noexcept {
+         constexpr Count Block = TVectorStream<T, C>::Block;
+         T inverse[C], inverse2[C];
+         for (Offset c = 0; c < C; ++c) {
+            inverse[c] = T {1} / ellipsoid.mRadii[c];
+            inverse2[c] = inverse[c] * inverse[c];
+         }
+
+         for (Offset j = 0; j < Block; ++j) {
+            T k0 = 0, k1 = 0;
+            for (Offset c = 0; c < C; ++c) {
+               const T a = p[c][j] * inverse[c];
+               const T b = p[c][j] * inverse2[c];
+               k0 += a * a;
+               k1 += b * b;
+            }
+            k0 = ::std::sqrt(k0);
+            d[j] = k0 * (k0 - T {1}) / ::std::sqrt(k1);
+         }
+      }
+
+      template<CT::Real T, CT::Dimension D>
+      void SignedDistanceBlock(const T* const* p, T* d, const TTorus<TVector<T, 3>, D>& torus) noexcept {
+         constexpr Count Block = TVectorStream<T, 3>::Block;
+         constexpr Offset A = D::Index;
+         constexpr Offset U = (A + 1) % 3;
+         constexpr Offset V = (A + 2) % 3;
+         const T outer = torus.mOuterRadius;
+         const T inner = torus.mInnerRadius;
+
+         for (Offset j = 0; j < Block; ++j) {
+            const T q = ::std::sqrt(p[U][j] * p[U][j] + p[V][j] * p[V][j]) - outer;
+            d[j] = ::std::sqrt(q * q + p[A][j] * p[A][j]) - inner;
+         }
+      }
+
+      template<CT::Real T, Count C>
+      void SignedDistanceBlock(const T* const* p, T* d, const TTriangle<TVector<T, C>>& triangle) noexcept {
+         static_assert(C == 2 or C == 3, "Unsupported triangle dimensions");
+         constexpr Count Block = TVectorStream<T, C>::Block;
+         using V = TVector<T, C>;
+         const V* abc = triangle.mABC;
+         const V e[3] {abc[1] - abc[0], abc[2] - abc[1], abc[0] - abc[2]};
+         T inverseLength2[3];
+         for (Offset i = 0; i < 3; ++i)
+            inverseLength2[i] = T {1} / e[i].Dot(e[i]);
+
+         if constexpr (C == 2) {
+            const T s = SignOf(e[0][0] * e[2][1] - e[0][1] * e[2][0]);
+
+            for (Offset j = 0; j < Block; ++j) {
+               T dist2 = ::std::numeric_limits<T>::infinity();
+               T side  = ::std::numeric_limits<T>::infinity();
+               for (Offset i = 0; i < 3; ++i) {
+                  const T vx = p[0][j] - abc[i][0];
+                  const T vy = p[1][j] - abc[i][1];
+                  const T h = Clamp01((vx * e[i][0] + vy * e[i][1]) * inverseLength2[i]);
+                  const T qx = vx - e[i][0] * h;
+                  const T qy = vy - e[i][1] * h;
+                  dist2 = ::std::min(dist2, qx * qx + qy * qy);
+                  side  = ::std::min(side, s * (vx * e[i][1] - vy * e[i][0]));
+               }
+               d[j] = -::std::sqrt(dist2) * SignOf(side);
+            }
+         }
+         else {
+            const V normal = e[0].Cross(e[2]);
+            const T inverseNormal2 = T {1} / normal.Dot(normal);
+            const V side[3] {e[0].Cross(normal), e[1].Cross(normal), e[2].Cross(normal)};
+
+            for (Offset j = 0; j < Block; ++j) {
+               // Both the edge and face distances are computed, and    
+               // selected depending on whether the point projects      
+               // inside the triangle                                   
+               T signs = 0;
+               T edge2 = ::std::numeric_limits<T>::infinity();
+               for (Offset i = 0; i < 3; ++i) {
+                  const T v[3] {
+                     p[0][j] - abc[i][0],
+                     p[1][j] - abc[i][1],
+                     p[2][j] - abc[i][2]
+                  };
+                  signs += SignOf(side[i][0] * v[0] + side[i][1] * v[1] + side[i][2] * v[2]);
+
+                  const T h = Clamp01(
+                     (e[i][0] * v[0] + e[i][1] * v[1] + e[i][2] * v[2]) * inverseLength2[i]);
+                  const T qx = e[i][0] * h - v[0];
+                  const T qy = e[i][1] * h - v[1];
+                  const T qz = e[i][2] * h - v[2];
+                  edge2 = ::std::min(edge2, qx * qx + qy * qy + qz * qz);
+               }
+
+               const T plane = normal[0] * (p[0][j] - abc[0][0])
+                             + normal[1] * (p[1][j] - abc[0][1])
+                             + normal[2] * (p[2][j] - abc[0][2]);
+               d[j] = ::std::sqrt(signs < T {2} ? edge2 : plane * plane * inverseNormal2);
+            }
+         }
+      }
+
+   } // namespace Langulus::Math::Inner
+
+
+   /// Signed distances from a centered 2D/3D box                             
+   ///   @param points - the points                                           
+   ///   @param box - the box                                                 
+   ///   @param out - [out] the distances                                     
+   template<CT::Real T, Count C> LANGULUS(INLINED)
+   void SignedDistance(const TVectorStream<T, C>& points, const TBox<TVector<T, C>>& box, T* out) noexcept {
+      Inner::EvaluateBlocks(points, out, [&](const T* const* p, T* d) {
+         Inner::SignedDistanceBlock(p, d, box);
+      });
+   }
+
+   /// Signed distances from a centered 2D/3D rounded box                     
+   ///   @param points - the points                                           
+   ///   @param box - the box                                                 
+   ///   @param out - [out] the distances                                     
+   template<CT::Real T, Count C> LANGULUS(INLINED)
+   void SignedDistance(const TVectorStream<T, C>& points, const TBoxRounded<TVector<T, C>>& box, T* out) noexcept {
+      Inner::EvaluateBlocks(points, out, [&](const T* const* p, T* d) {
+         Inner::SignedDistanceBlock(p, d, box);
+      });
+   }
+
+   /// Signed distances from a centered 3D cone                               
+   ///   @param points - the points                                           
+   ///   @param cone - the cone                                               
+   ///   @param out - [out] the distances                                     
+   template<CT::Real T, CT::Dimension D> LANGULUS(INLINED)
+   void SignedDistance(const TVectorStream<T, 3>& points, const TCone<TVector<T, 3>, D>& cone, T* out) noexcept {
+      Inner::EvaluateBlocks(points, out, [&](const T* const* p, T* d) {
+         Inner::SignedDistanceBlock(p, d, cone);
+      });
+   }
+
+   /// Signed distances from a centered infinite 3D cylinder                  
+   ///   @param points - the points                                           
+   ///   @param cylinder - the cylinder                                       
+   ///   @param out - [out] the distances                                     
+   template<CT::Real T, CT::Dimension D> LANGULUS(INLINED)
+   void SignedDistance(const TVectorStream<T, 3>& points, const TCylinder<TVector<T, 3>, D>& cylinder, T* out) noexcept {
+      Inner::EvaluateBlocks(points, out, [&](const T* const* p, T* d) {
+         Inner::SignedDistanceBlock(p, d, cylinder);
+      });
+   }
+
+   /// Signed distances from a centered capped 3D cylinder                    
+   ///   @param points - the points                                           
+   ///   @param cylinder - the cylinder                                       
+   ///   @param out - [out] the distances                                     
+   template<CT::Real T, CT::Dimension D> LANGULUS(INLINED)
+   void SignedDistance(const TVectorStream<T, 3>& points, const TCylinderCapped<TVector<T, 3>, D>& cylinder, T* out) noexcept {
+      Inner::EvaluateBlocks(points, out, [&](const T* const* p, T* d) {
+         Inner::SignedDistanceBlock(p, d, cylinder);
+      });
+   }
+
+   /// Signed distances from a 2D/3D plane                                    
+   ///   @param points - the points                                           
+   ///   @param plane - the plane                                             
+   ///   @param out - [out] the distances                                     
+   template<CT::Real T, Count C> LANGULUS(INLINED)
+   void SignedDistance(const TVectorStream<T, C>& points, const TPlane<TVector<T, C>>& plane, T* out) noexcept {
+      Inner::EvaluateBlocks(points, out, [&](const T* const* p, T* d) {
+         Inner::SignedDistanceBlock(p, d, plane);
+      });
+   }
+
+   /// Signed distances from a centered 2D/3D sphere                          
+   ///   @param points - the points                                           
+   ///   @param sphere - the sphere                                           
+   ///   @param out - [out] the distances                                     
+   template<CT::Real T, Count C> LANGULUS(INLINED)
+   void SignedDistance(const TVectorStream<T, C>& points, const TSphere<TVector<T, C>>& sphere, T* out) noexcept {
+      Inner::EvaluateBlocks(points, out, [&](const T* const* p, T* d) {
+         Inner::SignedDistanceBlock(p, d, sphere);
+      });
+   }
+
+   /// Approximate signed distances from a centered 2D/3D ellipsoid           
+   ///   @param points - the points                                           
+   ///   @param ellipsoid - the ellipsoid                                     
+   ///   @param out - [out] the distances                                     
+   template<CT::Real T, Count C> LANGULUS(INLINED)
+   void SignedDistance(const TVectorStream<T, C>& points, const TEllipsoid<TVector<T, C>>& ellipsoid, T* out) noexcept {
+      Inner::EvaluateBlocks(points, out, [&](const T* const* p, T* d) {
+         Inner::SignedDistanceBlock(p, d, ellipsoid);
+      });
+   }
+
+   /// Signed distances from a centered 3D torus                              
+   ///   @param points - the points                                           
+   ///   @param torus - the torus                                             
+   ///   @param out - [out] the distances                                     
+   template<CT::Real T, CT::Dimension D> LANGULUS(INLINED)
+   void SignedDistance(const TVectorStream<T, 3>& points, const TTorus<TVector<T, 3>, D>& torus, T* out) noexcept {
+      Inner::EvaluateBlocks(points, out, [&](const T* const* p, T* d) {
+         Inner::SignedDistanceBlock(p, d, torus);
+      });
+   }
+
+   /// Distances from a 2D/3D triangle - signed in 2D, unsigned in 3D         
+   ///   @param points - the points                                           
+   ///   @param triangle - the triangle                                       
+   ///   @param out - [out] the distances                                     
+   template<CT::Real T, Count C> LANGULUS(INLINED)
+   void SignedDistance(const TVectorStream<T, C>& points, const TTriangle<TVector<T, C>>& triangle, T* out) noexcept {
+      Inner::EvaluateBlocks(points, out, [&](const T* const* p, T* d) {
+         Inner::SignedDistanceBlock(p, d, triangle);
+      });
+   }
+
+   /// Evaluate signed distances from any primitive, that has a batched       
+   /// signed distance function                                               
+   ///   @param points - the points                                           
+   ///   @param primitive - the primitive                                     
+   ///   @return the distances, one per point                                 
+   template<CT::Real T, Count C, class P>
+   auto SignedDistance(const TVectorStream<T, C>& points, const P& primitive) -> TMany<T> {
+      TMany<T> result;
+      if (points.GetCount()) {
+         result.template Reserve<true>(points.GetCount());
+         SignedDistance(points, primitive, result.GetRaw());
+      }
+      return result;
+   }
+
+} // namespace Langulus::Math
@@ -0,0 +1,86 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Batch.hpp"
+#include "../Ranges/TRange.hpp"
+
+
+namespace Langulus::Math
+{
+   namespace Inner
+   {
+
+      ///                                                                     
+      ///   Closed interval of reals, with conservative arithmetic            
+      ///                                                                     
+      /// Every operation returns an interval that contains all results of    
+      /// the operation, applied to all values in the operand intervals       
+      ///                                                                     
+      template<CT::Real T>
+      struct Interval {
+         T mMin {};
+         T mMax {};
+
+         constexpr Interval() noexcept = default;
+         constexpr Interval(T value) noexcept
+            : mMin {value}, mMax {value} {}
+         constexpr Interval(T min, T max) noexcept
+            : mMin {min}, mMax {max} {}
+
+         NOD() constexpr Interval operator - () const noexcept;
+         NOD() constexpr Interval operator + (const Interval&) const noexcept;
+         NOD() constexpr Interval operator - (const Interval&) const noexcept;
+         NOD() constexpr Interval operator * (const Interval&) const noexcept;
+         NOD() constexpr Interval operator * (T) const noexcept;
+         NOD() constexpr Interval operator / (const Interval&) const noexcept;
+
+         NOD() constexpr Interval Abs() const noexcept;
+         NOD() constexpr Interval Sq() const noexcept;
+         NOD() Interval Sqrt() const noexcept;
+         NOD() constexpr Interval Min(const Interval&) const noexcept;
+         NOD() constexpr Interval Max(const Interval&) const noexcept;
+      };
+
+   } // namespace Langulus::Math::Inner
+
+   /// Scalar distance bounds                                                 
+   template<CT::Real T>
+   using TDistanceBounds = TRange<TVector<T, 1>>;
+
+
+   ///                                                                        
+   ///   Signed distance bounds over boxes                                    
+   ///                                                                        
+   ///   Evaluate a signed distance function with interval arithmetic, over   
+   /// all points of an axis-aligned box at once. The result contains the     
+   /// distance of every point in the box, so if it doesn't contain zero,     
+   /// the box doesn't contain any part of the surface. Bounds are            
+   /// conservative, not tight - they grow with the box size.                 
+   ///                                                                        
+   template<CT::Real T, Count C> NOD()
+   auto SignedDistance(const TRange<TVector<T, C>>&, const TBox<TVector<T, C>>&) noexcept -> TDistanceBounds<T>;
+   template<CT::Real T, Count C> NOD()
+   auto SignedDistance(const TRange<TVector<T, C>>&, const TBoxRounded<TVector<T, C>>&) noexcept -> TDistanceBounds<T>;
+   template<CT::Real T, CT::Dimension D> NOD()
+   auto SignedDistance(const TRange<TVector<T, 3>>&, const TCone<TVector<T, 3>, D>&) noexcept -> TDistanceBounds<T>;
+   template<CT::Real T, CT::Dimension D> NOD()
+   auto SignedDistance(const TRange<TVector<T, 3>>&, const TCylinder<TVector<T, 3>, D>&) noexcept -> TDistanceBounds<T>;
+   template<CT::Real T, CT::Dimension D> NOD()
+   auto SignedDistance(const TRange<TVector<T, 3>>&, const TCylinderCapped<TVector<T, 3>, D>&) noexcept -> TDistanceBounds<T>;
+   template<CT::Real T, Count C> NOD()
+   auto SignedDistance(const TRange<TVector<T, C>>&, const TPlane<TVector<T, C>>&) noexcept -> TDistanceBounds<T>;
+   template<CT::Real T, Count C> NOD()
+   auto SignedDistance(const TRange<TVector<T, C>>&, const TSphere<TVector<T, C>>&) noexcept -> TDistanceBounds<T>;
+   template<CT::Real T, Count C> NOD()
+   auto SignedDistance(const TRange<TVector<T, C>>&, const TEllipsoid<TVector<T, C>>&) noexcept -> TDistanceBounds<T>;
+   template<CT::Real T, CT::Dimension D> NOD()
+   auto SignedDistance(const TRange<TVector<T, 3>>&, const TTorus<TVector<T, 3>, D>&) noexcept -> TDistanceBounds<T>;
+   template<CT::Real T, Count C> NOD()
+   auto SignedDistance(const TRange<TVector<T, C>>&, const TTriangle<TVector<T, C>>&) noexcept -> TDistanceBounds<T>;
+
+} // namespace Langulus::Math
\ No newline at end of file
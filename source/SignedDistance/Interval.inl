@@ -0,0 +1,324 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Interval.hpp"
+#include "Batch.inl"
+#include "../Ranges/TRange.inl"
+#include <cmath>
+
+#define TEMPLATE() template<CT::Real T>
+#define TME()      Interval<T>
+
+
+namespace Langulus::Math::Inner
+{
+
+   TEMPLATE() LANGULUS(INLINED)
+   constexpr TME() TME()::operator - () const noexcept {
+      return {-mMax, -mMin};
+   }
+
+   TEMPLATE() LANGULUS(INLINED)
+   constexpr TME() TME()::operator + (const Interval& rhs) const noexcept {
+      return {mMin + rhs.mMin, mMax + rhs.mMax};
+   }
+
+   TEMPLATE() LANGULUS(INLINED)
+   constexpr TME() TME()::operator - (const Interval& rhs) const noexcept {
+      return {mMin - rhs.mMax, mMax - rhs.mMin};
+   }
+
+   /// The product is bounded by the products of the interval ends            
+   TEMPLATE() LANGULUS(INLINED)
+   constexpr TME() TME()::operator * (const Interval& rhs) const noexcept {
+      const T a = mMin * rhs.mMin;
+      const T b = mMin * rhs.mMax;
+      const T c = mMax * rhs.mMin;
+      const T d = mMax * rhs.mMax;
+      return {
+         ::std::min(::std::min(a, b), ::std::min(c, d)),
+         ::std::max(::std::max(a, b), ::std::max(c, d))
+      };
+   }
+
+   TEMPLATE() LANGULUS(INLINED)
+   constexpr TME() TME()::operator * (T rhs) const noexcept {
+      return rhs >= 0
+         ? Interval {mMin * rhs, mMax * rhs}
+         : Interval {mMax * rhs, mMin * rhs};
+   }
+
+   /// Division by an interval that contains zero is unbounded                
+   TEMPLATE() LANGULUS(INLINED)
+   constexpr TME() TME()::operator / (const Interval& rhs) const noexcept {
+      if (rhs.mMin <= 0 and rhs.mMax >= 0) {
+         return {
+            -::std::numeric_limits<T>::infinity(),
+             ::std::numeric_limits<T>::infinity()
+         };
+      }
+      return *this * Interval {T {1} / rhs.mMax, T {1} / rhs.mMin};
+   }
+
+   TEMPLATE() LANGULUS(INLINED)
+   constexpr TME() TME()::Abs() const noexcept {
+      if (mMin >= 0)
+         return *this;
+      if (mMax <= 0)
+         return -*this;
+      return {T {0}, ::std::max(-mMin, mMax)};
+   }
+
+   TEMPLATE() LANGULUS(INLINED)
+   constexpr TME() TME()::Sq() const noexcept {
+      const auto a = Abs();
+      return {a.mMin * a.mMin, a.mMax * a.mMax};
+   }
+
+   /// Negative parts of the interval are clamped to zero                     
+   TEMPLATE() LANGULUS(INLINED)
+   TME() TME()::Sqrt() const noexcept {
+      return {
+         ::std::sqrt(::std::max(mMin, T {0})),
+         ::std::sqrt(::std::max(mMax, T {0}))
+      };
+   }
+
+   TEMPLATE() LANGULUS(INLINED)
+   constexpr TME() TME()::Min(const Interval& rhs) const noexcept {
+      return {::std::min(mMin, rhs.mMin), ::std::min(mMax, rhs.mMax)};
+   }
+
+   TEMPLATE() LANGULUS(INLINED)
+   constexpr TME() TME()::Max(const Interval& rhs) const noexcept {
+      return {::std::max(mMin, rhs.mMin), ::std::max(mMax, rhs.mMax)};
+   }
+
+
+   ///                                                                        
+   ///   Interval kernels                                                     
+   ///                                                                        
+   /// Each bounds the distances of all points, whose components are in the   
+   /// given intervals. They are also used by the SDF tape interpreter        
+   ///                                                                        
+   template<CT::Real T, Count C>
+   Interval<T> BoxBounds(const Interval<T>* p, const TVector<T, C>& offsets, T shrink) noexcept {
+      Interval<T> outside {0};
+      Interval<T> inside {-::std::numeric_limits<T>::infinity()};
+      for (Offset c = 0; c < C; ++c) {
+         const auto q = p[c].Abs() - Interval<T> {offsets[c]};
+         outside = outside + q.Max(T {0}).Sq();
+         inside = inside.Max(q);
+      }
+      return outside.Sqrt() + inside.Min(T {0}) - Interval<T> {shrink};
+   }
+
+   template<CT::Real T, Count C> LANGULUS(INLINED)
+   Interval<T> SignedDistanceBounds(const Interval<T>* p, const TBox<TVector<T, C>>& box) noexcept {
+      return BoxBounds<T, C>(p, box.mOffsets, T {0});
+   }
+
+   template<CT::Real T, Count C> LANGULUS(INLINED)
+   Interval<T> SignedDistanceBounds(const Interval<T>* p, const TBoxRounded<TVector<T, C>>& box) noexcept {
+      return BoxBounds<T, C>(p, box.mOffsets, box.mRadius);
+   }
+
+   template<CT::Real T, CT::Dimension D>
+   Interval<T> SignedDistanceBounds(const Interval<T>* p, const TCone<TVector<T, 3>, D>& cone) noexcept {
+      constexpr Offset A = D::Index;
+      constexpr Offset U = (A + 1) % 3;
+      constexpr Offset V = (A + 2) % 3;
+      const T sn = static_cast<T>(Sin(cone.mAngle));
+      const T cs = static_cast<T>(Cos(cone.mAngle));
+      const auto q = (p[U].Sq() + p[V].Sq()).Sqrt();
+      return (q * sn + p[A] * cs).Max(Interval<T> {-cone.mHeight} - p[A]);
+   }
+
+   template<CT::Real T, CT::Dimension D>
+   Interval<T> SignedDistanceBounds(const Interval<T>* p, const TCylinder<TVector<T, 3>, D>& cylinder) noexcept {
+      constexpr Offset U = (D::Index + 1) % 3;
+      constexpr Offset V = (D::Index + 2) % 3;
+      return (p[U].Sq() + p[V].Sq()).Sqrt() - Interval<T> {cylinder.mRadius};
+   }
+
+   template<CT::Real T, CT::Dimension D>
+   Interval<T> SignedDistanceBounds(const Interval<T>* p, const TCylinderCapped<TVector<T, 3>, D>& cylinder) noexcept {
+      constexpr Offset A = D::Index;
+      constexpr Offset U = (A + 1) % 3;
+      constexpr Offset V = (A + 2) % 3;
+      const auto dr = (p[U].Sq() + p[V].Sq()).Sqrt() - Interval<T> {cylinder.mRadius};
+      const auto dh = p[A].Abs() - Interval<T> {cylinder.mHeight};
+      return (dr.Max(T {0}).Sq() + dh.Max(T {0}).Sq()).Sqrt() + dr.Max(dh).Min(T {0});
+   }
+
+   template<CT::Real T, Count C>
+   Interval<T> SignedDistanceBounds(const Interval<T>* p, const TPlane<TVector<T, C>>& plane) noexcept {
+      Interval<T> result {plane.mOffset};
+      for (Offset c = 0; c < C; ++c)
+         result = result + p[c] * plane.mNormal[c];
+      return result;
+   }
+
+   template<CT::Real T, Count C>
+   Interval<T> SignedDistanceBounds(const Interval<T>* p, const TSphere<TVector<T, C>>& sphere) noexcept {
+      Interval<T> length2 {0};
+      for (Offset c = 0; c < C; ++c)
+         length2 = length2 + p[c].Sq();
+      return length2.Sqrt() - Interval<T> {sphere.mRadius};
+   }
+
+   template<CT::Real T, Count C>
+   Interval<T> SignedDistanceBounds(const Interval<T>* p, const TEllipsoid<TVector<T, C>>& ellipsoid) noexcept {
+      Interval<T> k0 {0}, k1 {0};
+      for (Offset c = 0; c < C; ++c) {
+         const T inverse = T {1} / ellipsoid.mRadii[c];
+         k0 = k0 + (p[c] * inverse).Sq();
+         k1 = k1 + (p[c] * (inverse * inverse)).Sq();
+      }
+      k0 = k0.Sqrt();
+      return k0 * (k0 - Interval<T> {1}) / k1.Sqrt();
+   }
+
+   template<CT::Real T, CT::Dimension D>
+   Interval<T> SignedDistanceBounds(const Interval<T>* p, const TTorus<TVector<T, 3>, D>& torus) noexcept {
+      constexpr Offset A = D::Index;
+      constexpr Offset U = (A + 1) % 3;
+      constexpr Offset V = (A + 2) % 3;
+      const auto q = (p[U].Sq() + p[V].Sq()).Sqrt() - Interval<T> {torus.mOuterRadius};
+      return (q.Sq() + p[A].Sq()).Sqrt() - Interval<T> {torus.mInnerRadius};
+   }
+
+   /// Triangle distances are exact, so they change no faster than the        
+   /// points move - the distance at the box center, plus or minus the        
+   /// distance to the furthest corner, bounds the whole box                  
+   template<CT::Real T, Count C>
+   Interval<T> SignedDistanceBounds(const Interval<T>* p, const TTriangle<TVector<T, C>>& triangle) noexcept {
+      TVector<T, C> center;
+      T radius2 = 0;
+      for (Offset c = 0; c < C; ++c) {
+         center[c] = (p[c].mMin + p[c].mMax) / T {2};
+         const T half = (p[c].mMax - p[c].mMin) / T {2};
+         radius2 += half * half;
+      }
+
+      const T distance = static_cast<T>(triangle.SignedDistance(center));
+      const T radius = ::std::sqrt(radius2);
+      return {distance - radius, distance + radius};
+   }
+
+   /// Evaluate an interval kernel over a box                                 
+   template<CT::Real T, Count C, class P> LANGULUS(INLINED)
+   auto SignedDistanceBounds(const TRange<TVector<T, C>>& box, const P& primitive) noexcept -> TDistanceBounds<T> {
+      Interval<T> p[C];
+      for (Offset c = 0; c < C; ++c)
+         p[c] = {box.mMin[c], box.mMax[c]};
+      const auto result = SignedDistanceBounds(p, primitive);
+      return {TVector<T, 1> {result.mMin}, TVector<T, 1> {result.mMax}};
+   }
+
+} // namespace Langulus::Math::Inner
+
+#undef TME
+#undef TEMPLATE
+
+
+namespace Langulus::Math
+{
+
+   /// Bound the signed distances from a centered 2D/3D box                   
+   ///   @param box - the points to bound                                     
+   ///   @param primitive - the box                                           
+   ///   @return the range of distances                                       
+   template<CT::Real T, Count C> LANGULUS(INLINED)
+   auto SignedDistance(const TRange<TVector<T, C>>& box, const TBox<TVector<T, C>>& primitive) noexcept -> TDistanceBounds<T> {
+      return Inner::SignedDistanceBounds(box, primitive);
+   }
+
+   /// Bound the signed distances from a centered 2D/3D rounded box           
+   ///   @param box - the points to bound                                     
+   ///   @param primitive - the rounded box                                   
+   ///   @return the range of distances                                       
+   template<CT::Real T, Count C> LANGULUS(INLINED)
+   auto SignedDistance(const TRange<TVector<T, C>>& box, const TBoxRounded<TVector<T, C>>& primitive) noexcept -> TDistanceBounds<T> {
+      return Inner::SignedDistanceBounds(box, primitive);
+   }
+
+   /// Bound the signed distances from a centered 3D cone                     
+   ///   @param box - the points to bound                                     
+   ///   @param primitive - the cone                                          
+   ///   @return the range of distances                                       
+   template<CT::Real T, CT::Dimension D> LANGULUS(INLINED)
+   auto SignedDistance(const TRange<TVector<T, 3>>& box, const TCone<TVector<T, 3>, D>& primitive) noexcept -> TDistanceBounds<T> {
+      return Inner::SignedDistanceBounds(box, primitive);
+   }
+
+   /// Bound the signed distances from a centered infinite 3D cylinder        
+   ///   @param box - the points to bound                                     
+   ///   @param primitive - the cylinder                                      
+   ///   @return the range of distances                                       
+   template<CT::Real T, CT::Dimension D> LANGULUS(INLINED)
+   auto SignedDistance(const TRange<TVector<T, 3>>& box, const TCylinder<TVector<T, 3>, D>& primitive) noexcept -> TDistanceBounds<T> {
+      return Inner::SignedDistanceBounds(box, primitive);
+   }
+
+   /// Bound the signed distances from a centered capped 3D cylinder          
+   ///   @param box - the points to bound                                     
+   ///   @param primitive - the cylinder                                      
+   ///   @return the range of distances                                       
+   template<CT::Real T, CT::Dimension D> LANGULUS(INLINED)
+   auto SignedDistance(const TRange<TVector<T, 3>>& box, const TCylinderCapped<TVector<T, 3>, D>& primitive) noexcept -> TDistanceBounds<T> {
+      return Inner::SignedDistanceBounds(box, primitive);
+   }
+
+   /// Bound the signed distances from a 2D/3D plane                          
+   ///   @param box - the points to bound                                     
+   ///   @param primitive - the plane                                         
+   ///   @return the range of distances                                       
+   template<CT::Real T, Count C> LANGULUS(INLINED)
+   auto SignedDistance(const TRange<TVector<T, C>>& box, const TPlane<TVector<T, C>>& primitive) noexcept -> TDistanceBounds<T> {
+      return Inner::SignedDistanceBounds(box, primitive);
+   }
+
+   /// Bound the signed distances from a centered 2D/3D sphere                
+   ///   @param box - the points to bound                                     
+   ///   @param primitive - the sphere                                        
+   ///   @return the range of distances                                       
+   template<CT::Real T, Count C> LANGULUS(INLINED)
+   auto SignedDistance(const TRange<TVector<T, C>>& box, const TSphere<TVector<T, C>>& primitive) noexcept -> TDistanceBounds<T> {
+      return Inner::SignedDistanceBounds(box, primitive);
+   }
+
+   /// Bound the approximate signed distances from a centered ellipsoid       
+   ///   @param box - the points to bound                                     
+   ///   @param primitive - the ellipsoid                                     
+   ///   @return the range of distances, unbounded if the box contains the    
+   ///      ellipsoid center                                                  
+   template<CT::Real T, Count C> LANGULUS(INLINED)
+   auto SignedDistance(const TRange<TVector<T, C>>& box, const TEllipsoid<TVector<T, C>>& primitive) noexcept -> TDistanceBounds<T> {
+      return Inner::SignedDistanceBounds(box, primitive);
+   }
+
+   /// Bound the signed distances from a centered 3D torus                    
+   ///   @param box - the points to bound                                     
+   ///   @param primitive - the torus                                         
+   ///   @return the range of distances                                       
+   template<CT::Real T, CT::Dimension D> LANGULUS(INLINED)
+   auto SignedDistance(const TRange<TVector<T, 3>>& box, const TTorus<TVector<T, 3>, D>& primitive) noexcept -> TDistanceBounds<T> {
+      return Inner::SignedDistanceBounds(box, primitive);
+   }
+
+   /// Bound the distances from a 2D/3D triangle                              
+   ///   @param box - the points to bound                                     
+   ///   @param primitive - the triangle                                      
+   ///   @return the range of distances                                       
+   template<CT::Real T, Count C> LANGULUS(INLINED)
+   auto SignedDistance(const TRange<TVector<T, C>>& box, const TTriangle<TVector<T, C>>& primitive) noexcept -> TDistanceBounds<T> {
+      return Inner::SignedDistanceBounds(box, primitive);
+   }
+
+} // namespace Langulus::Math
\ No newline at end of file
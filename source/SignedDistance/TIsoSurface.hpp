@@ -0,0 +1,107 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Batch.hpp"
+#include "../Ranges/TRange.hpp"
+
+
+namespace Langulus::Math
+{
+
+   template<CT::Vector T>
+   struct TIsoMesh;
+
+   template<CT::Vector T>
+   struct TIsoSurface;
+
+   using IsoMesh = TIsoMesh<Vec3>;
+   using IsoSurface = TIsoSurface<Vec3>;
+
+
+   ///                                                                        
+   ///   Indexed triangle mesh                                                
+   ///                                                                        
+   /// Output of isosurface extraction - every vertex is stored once, and     
+   /// triangles refer to vertices by index, three indices per triangle,      
+   /// wound counter-clockwise when looking against the surface normal        
+   ///                                                                        
+   template<CT::Vector T>
+   struct TIsoMesh {
+      using PointType = T;
+      using IndexType = ::std::uint32_t;
+
+      TMany<T> mPoints;
+      TMany<T> mNormals;
+      TMany<IndexType> mIndices;
+
+   public:
+      NOD() Count GetTriangleCount() const noexcept;
+      NOD() auto GetTriangle(Offset) const -> TTriangle<T>;
+      NOD() auto GetTriangles() const -> TMany<TTriangle<T>>;
+      NOD() auto GetStripIndices() const -> TMany<IndexType>;
+      NOD() auto GetStrip() const -> TTriangleStrip<T>;
+   };
+
+
+   ///                                                                        
+   ///   Isosurface extraction                                                
+   ///                                                                        
+   ///   Samples any signed distance callable on a regular grid over mBounds, 
+   /// with mResolution cells along each axis, and extracts the zero level    
+   /// set as an indexed mesh, either with marching cubes, or with dual       
+   /// contouring. Scalar callables take a point and return its distance;     
+   /// batched callables take a TVectorStream and a pointer to write the      
+   /// distances to, and are then fed a whole grid layer per call.            
+   ///   The grid is split into chunks of mChunk layers, that are processed   
+   /// in parallel, so callables must be safe to call concurrently. Each      
+   /// chunk caches the vertices of the two grid layers it currently works    
+   /// on, so vertices shared between cells are never duplicated - not even   
+   /// between chunks, because a chunk's top layer is the next chunk's        
+   /// bottom one, and is always visited in the same order.                   
+   ///                                                                        
+   template<CT::Vector T>
+   struct TIsoSurface {
+      using PointType  = T;
+      using ScalarType = TypeOf<T>;
+      using RangeType  = TRange<T>;
+      using MeshType   = TIsoMesh<T>;
+      using IndexType  = typename MeshType::IndexType;
+      using StreamType = TVectorStream<ScalarType, 3>;
+      static_assert(T::MemberCount == 3, "Isosurfaces are extracted only in 3D");
+
+      // The sampled volume                                             
+      RangeType mBounds {T {-1}, T {1}};
+      // Number of cells along each axis                                
+      Count mResolution = 64;
+      // Number of cell layers per parallel chunk                       
+      Count mChunk = 8;
+      // How strongly dual contouring vertices are pulled towards the   
+      // average of their edge intersections; keeps them stable on flat 
+      // and near-flat surfaces, where the fit is underdetermined       
+      ScalarType mRegularization = ScalarType(0.05);
+
+   public:
+      template<class F>
+      NOD() auto MarchingCubes(F&&, Count threads = 0) const -> MeshType;
+      template<class F>
+      NOD() auto DualContouring(F&&, Count threads = 0) const -> MeshType;
+
+   protected:
+      struct Chunk;
+
+      NOD() T GetStep() const noexcept;
+      NOD() T GetCorner(Offset, Offset, Offset) const noexcept;
+      template<class F>
+      void SampleLayer(F&, Offset, StreamType&, ScalarType*) const;
+      template<class F>
+      void SampleNormals(F&, const T*, Count, StreamType&, T*) const;
+      template<class F, class CHUNK_WORK>
+      auto Run(F&, Count, CHUNK_WORK&&) const -> MeshType;
+   };
+
+} // namespace Langulus::Math
\ No newline at end of file
@@ -0,0 +1,770 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "TIsoSurface.hpp"
+#include "../Vectors/TVectorStream.inl"
+#include <algorithm>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#define TEMPLATE() template<CT::Vector T>
+
+
+namespace Langulus::Math
+{
+   namespace Inner
+   {
+
+      /// Cube corners are numbered x | y << 1 | z << 2, and cube edges are   
+      /// numbered axis * 4 + k, where the two bits of k are the offsets      
+      /// along the other two axes, in increasing axis order                  
+      ///   @param edge - the edge index                                      
+      ///   @return the corner at the lower end of the edge                   
+      constexpr int CubeEdgeCorner(int edge) noexcept {
+         const int axis = edge / 4;
+         const int k = edge % 4;
+         const int first = axis == 0 ? 1 : 0;
+         const int second = axis == 2 ? 1 : 2;
+         return ((k & 1) << first) | ((k >> 1) << second);
+      }
+
+      /// Get the edge between two neighboring cube corners                   
+      constexpr int CubeEdge(int a, int b) noexcept {
+         const int axis = (a ^ b) == 1 ? 0 : (a ^ b) == 2 ? 1 : 2;
+         const int corner = a & b;
+         const int first = axis == 0 ? 1 : 0;
+         const int second = axis == 2 ? 1 : 2;
+         return axis * 4 + (((corner >> first) & 1) | (((corner >> second) & 1) << 1));
+      }
+
+      ///                                                                     
+      ///   Marching cubes triangle table                                     
+      ///                                                                     
+      /// Instead of transcribing the classic 256-case table, it is derived   
+      /// at compile time: on every cube face, crossed edges are connected    
+      /// so that each run of inside corners is cut off on its own, which     
+      /// also resolves the ambiguous faces the same way from both cubes      
+      /// that share them. Connections are directed from the edge where the   
+      /// counter-clockwise walk around the face enters the inside region,    
+      /// to the edge where it leaves it, which chains them into closed,      
+      /// consistently wound polygons, that are then triangulated as fans.    
+      /// Corners are inside, if their distance is negative.                  
+      ///                                                                     
+      struct MarchingCubesTable {
+         ::std::uint8_t mCount[256] {};
+         ::std::int8_t mEdges[256][15] {};
+      };
+
+      constexpr MarchingCubesTable GenerateMarchingCubesTable() noexcept {
+         MarchingCubesTable table;
+         for (int config = 0; config < 256; ++config) {
+            int next[12] {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1};
+
+            for (int axis = 0; axis < 3; ++axis) {
+               for (int side = 0; side < 2; ++side) {
+                  // Face corners, counter-clockwise from outside       
+                  const int u = (axis + 1) % 3;
+                  const int v = (axis + 2) % 3;
+                  const int square[4][2] {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+                  int corners[4] {};
+                  for (int c = 0; c < 4; ++c)
+                     corners[c] = (side << axis) | (square[c][0] << u) | (square[c][1] << v);
+                  if (not side) {
+                     const int swap = corners[1];
+                     corners[1] = corners[3];
+                     corners[3] = swap;
+                  }
+
+                  bool inside[4] {};
+                  for (int c = 0; c < 4; ++c)
+                     inside[c] = (config >> corners[c]) & 1;
+
+                  for (int c = 0; c < 4; ++c) {
+                     if (inside[c] or not inside[(c + 1) % 4])
+                        continue;
+
+                     // Entering at edge c, find where the run ends     
+                     for (int step = 1; step <= 4; ++step) {
+                        const int e = (c + step) % 4;
+                        if (inside[e] and not inside[(e + 1) % 4]) {
+                           next[CubeEdge(corners[c], corners[(c + 1) % 4])]
+                              = CubeEdge(corners[e], corners[(e + 1) % 4]);
+                           break;
+                        }
+                     }
+                  }
+               }
+            }
+
+            bool visited[12] {};
+            int triangles = 0;
+            for (int edge = 0; edge < 12; ++edge) {
+               if (next[edge] < 0 or visited[edge])
+                  continue;
+
+               int polygon[12] {};
+               int size = 0;
+               for (int e = edge; not visited[e]; e = next[e]) {
+                  visited[e] = true;
+                  polygon[size++] = e;
+               }
+
+               for (int i = 1; i + 1 < size; ++i) {
+                  table.mEdges[config][triangles * 3 + 0] = static_cast<::std::int8_t>(polygon[0]);
+                  table.mEdges[config][triangles * 3 + 1] = static_cast<::std::int8_t>(polygon[i]);
+                  table.mEdges[config][triangles * 3 + 2] = static_cast<::std::int8_t>(polygon[i + 1]);
+                  ++triangles;
+               }
+            }
+            table.mCount[config] = static_cast<::std::uint8_t>(triangles);
+         }
+         return table;
+      }
+
+      inline constexpr MarchingCubesTable MarchingCubes = GenerateMarchingCubesTable();
+
+      /// Find the edge crossings of a grid plane, in a fixed order - edges   
+      /// along X row by row, then edges along Y row by row                   
+      ///   @param cells - number of cells along each axis                    
+      ///   @param values - the sampled plane, (cells + 1)^2 values           
+      ///   @param out - [out] index per edge, X edges first, then Y edges    
+      ///   @param cross - called with (x, y, axis, t) for each crossing, and 
+      ///      returns the index to store                                     
+      template<class T, class I, class F>
+      void CrossPlane(Count cells, const T* values, I* out, F&& cross) {
+         const Count side = cells + 1;
+         for (Offset j = 0; j < side; ++j) {
+            for (Offset i = 0; i < cells; ++i) {
+               const T a = values[j * side + i];
+               const T b = values[j * side + i + 1];
+               if ((a < 0) != (b < 0))
+                  out[j * side + i] = cross(i, j, 0, a / (a - b));
+            }
+         }
+
+         for (Offset j = 0; j < cells; ++j) {
+            for (Offset i = 0; i < side; ++i) {
+               const T a = values[j * side + i];
+               const T b = values[(j + 1) * side + i];
+               if ((a < 0) != (b < 0))
+                  out[side * side + j * side + i] = cross(i, j, 1, a / (a - b));
+            }
+         }
+      }
+
+      /// Find the crossings of the edges between two grid planes             
+      ///   @param cells - number of cells along each axis                    
+      ///   @param lower, upper - the sampled planes                          
+      ///   @param out - [out] index per edge                                 
+      ///   @param cross - called with (x, y, axis, t) for each crossing, and 
+      ///      returns the index to store                                     
+      template<class T, class I, class F>
+      void CrossLayer(Count cells, const T* lower, const T* upper, I* out, F&& cross) {
+         const Count side = cells + 1;
+         for (Offset j = 0; j < side; ++j) {
+            for (Offset i = 0; i < side; ++i) {
+               const T a = lower[j * side + i];
+               const T b = upper[j * side + i];
+               if ((a < 0) != (b < 0))
+                  out[j * side + i] = cross(i, j, 2, a / (a - b));
+            }
+         }
+      }
+
+      /// Get the index of a crossing on a cube edge, from the per-plane and  
+      /// per-layer crossing indices, as laid out by CrossPlane/CrossLayer    
+      ///   @param edge - the cube edge                                       
+      ///   @param i, j - the cell                                            
+      ///   @param side - number of grid points along each axis               
+      ///   @param lower, upper - crossings on the planes below and above     
+      ///   @param layer - crossings between the planes                       
+      template<class I> LANGULUS(INLINED)
+      I CubeEdgeIndex(int edge, Offset i, Offset j, Count side, const I* lower, const I* upper, const I* layer) noexcept {
+         const Offset k = edge % 4;
+         switch (edge / 4) {
+         case 0:
+            return (k >> 1 ? upper : lower)[(j + (k & 1)) * side + i];
+         case 1:
+            return (k >> 1 ? upper : lower)[side * side + j * side + i + (k & 1)];
+         default:
+            return layer[(j + (k >> 1)) * side + i + (k & 1)];
+         }
+      }
+
+   } // namespace Langulus::Math::Inner
+
+
+   ///                                                                        
+   ///   Mesh                                                                 
+   ///                                                                        
+   /// Get the number of triangles                                            
+   TEMPLATE() LANGULUS(INLINED)
+   Count TIsoMesh<T>::GetTriangleCount() const noexcept {
+      return mIndices.GetCount() / 3;
+   }
+
+   /// Get a triangle                                                         
+   ///   @param index - the triangle index                                    
+   ///   @return the triangle                                                 
+   TEMPLATE() LANGULUS(INLINED)
+   auto TIsoMesh<T>::GetTriangle(Offset index) const -> TTriangle<T> {
+      LANGULUS_ASSUME(UserAssumes, index < GetTriangleCount(), "Index out of range");
+      const IndexType indices[3] {
+         mIndices[index * 3], mIndices[index * 3 + 1], mIndices[index * 3 + 2]
+      };
+      return {mPoints.GetRaw(), indices};
+   }
+
+   /// Expand the mesh into separate triangles                                
+   ///   @return the triangles                                                
+   TEMPLATE()
+   auto TIsoMesh<T>::GetTriangles() const -> TMany<TTriangle<T>> {
+      TMany<TTriangle<T>> result;
+      if (GetTriangleCount()) {
+         result.template Reserve<true>(GetTriangleCount());
+         for (Offset t = 0; t < GetTriangleCount(); ++t)
+            result.GetRaw()[t] = GetTriangle(t);
+      }
+      return result;
+   }
+
+   /// Convert the triangles to a single indexed triangle strip               
+   /// Strips are grown greedily across shared edges, and joined into one     
+   /// by degenerate triangles. The winding of all triangles is preserved,    
+   /// with the conventions of TTriangleStrip                                 
+   ///   @return the strip indices                                            
+   TEMPLATE()
+   auto TIsoMesh<T>::GetStripIndices() const -> TMany<IndexType> {
+      const Count count = GetTriangleCount();
+      const IndexType* indices = mIndices.GetRaw();
+      const auto key = [](IndexType from, IndexType to) {
+         return (static_cast<::std::uint64_t>(from) << 32) | to;
+      };
+
+      // Map each directed edge to the triangle it belongs to           
+      ::std::unordered_map<::std::uint64_t, IndexType> edges;
+      edges.reserve(count * 3);
+      for (Offset t = 0; t < count; ++t) {
+         for (Offset e = 0; e < 3; ++e) {
+            edges.emplace(key(indices[t * 3 + e], indices[t * 3 + (e + 1) % 3]),
+               static_cast<IndexType>(t));
+         }
+      }
+
+      TMany<bool> used;
+      if (count) {
+         used.template Reserve<true>(count);
+         ::std::fill_n(used.GetRaw(), count, false);
+      }
+
+      TMany<IndexType> strip;
+      TMany<IndexType> run;
+      for (Offset t = 0; t < count; ++t) {
+         if (used[t])
+            continue;
+         used[t] = true;
+         run.Clear();
+         for (Offset e = 0; e < 3; ++e)
+            run << indices[t * 3 + e];
+
+         // Triangle k of a strip is (k, k + 1, k + 2) for even k, and  
+         // (k + 1, k, k + 2) for odd k, so the next triangle must      
+         // contain the last edge in the matching direction             
+         while (true) {
+            const Offset k = run.GetCount() - 2;
+            const IndexType from = run[k % 2 ? k + 1 : k];
+            const IndexType to = run[k % 2 ? k : k + 1];
+            const auto found = edges.find(key(from, to));
+            if (found == edges.end() or used[found->second])
+               break;
+
+            const IndexType* next = indices + found->second * 3;
+            Offset p = 0;
+            while (next[p] != from or next[(p + 1) % 3] != to)
+               ++p;
+            used[found->second] = true;
+            run << next[(p + 2) % 3];
+         }
+
+         // Join with degenerate triangles, keeping the run at an even  
+         // position, so that its winding is preserved                  
+         if (not strip.IsEmpty()) {
+            const bool odd = strip.GetCount() % 2;
+            const IndexType last = strip[strip.GetCount() - 1];
+            strip << last;
+            strip << run[0];
+            if (odd)
+               strip << run[0];
+         }
+         for (auto index : run)
+            strip << index;
+      }
+      return strip;
+   }
+
+   /// Convert the triangles to a single triangle strip                       
+   ///   @return the strip                                                    
+   TEMPLATE()
+   auto TIsoMesh<T>::GetStrip() const -> TTriangleStrip<T> {
+      const auto indices = GetStripIndices();
+      TTriangleStrip<T> result;
+      if (indices.GetCount()) {
+         result.mPoints.template Reserve<true>(indices.GetCount());
+         for (Offset i = 0; i < indices.GetCount(); ++i)
+            result.mPoints.GetRaw()[i] = mPoints[indices[i]];
+      }
+      return result;
+   }
+
+
+   ///                                                                        
+   ///   Extraction                                                           
+   ///                                                                        
+   /// The output of a single chunk of cell layers                            
+   /// It grows on the worker thread, that fills the chunk, so it is kept in  
+   /// std::vector, and only the final mesh is in TMany                       
+   TEMPLATE()
+   struct TIsoSurface<T>::Chunk {
+      // Indices with this bit set refer to vertices of the next chunk, 
+      // by their order in its bottom layer                             
+      static constexpr IndexType Foreign = IndexType {1} << 31;
+
+      Offset mBegin {};
+      Offset mEnd {};
+      ::std::vector<T> mPoints;
+      ::std::vector<T> mNormals;
+      ::std::vector<IndexType> mIndices;
+   };
+
+   /// Extract the surface with marching cubes                                
+   /// Vertices lie on grid edges, linearly interpolated between samples      
+   ///   @param sdf - the distance function, scalar or batched                
+   ///   @param threads - number of threads to use, zero to use all cores     
+   ///   @return the mesh                                                     
+   TEMPLATE() template<class F>
+   auto TIsoSurface<T>::MarchingCubes(F&& sdf, Count threads) const -> MeshType {
+      const Count cells = mResolution;
+      const Count side = cells + 1;
+      const T step = GetStep();
+
+      return Run(sdf, threads, [&](Chunk& chunk, StreamType& stream) {
+         ::std::vector<ScalarType> values[2] {
+            ::std::vector<ScalarType>(side * side),
+            ::std::vector<ScalarType>(side * side)
+         };
+         // Vertex indices on the edges of the planes below and above   
+         // the current cell layer, and on the edges between them       
+         ::std::vector<IndexType> planes[2] {
+            ::std::vector<IndexType>(side * side * 2),
+            ::std::vector<IndexType>(side * side * 2)
+         };
+         ::std::vector<IndexType> layer(side * side);
+
+         const auto vertex = [&](Offset z) {
+            return [&, z](Offset i, Offset j, int axis, ScalarType t) {
+               T point = GetCorner(i, j, z);
+               point[axis] += step[axis] * t;
+               chunk.mPoints.push_back(point);
+               return static_cast<IndexType>(chunk.mPoints.size() - 1);
+            };
+         };
+
+         SampleLayer(sdf, chunk.mBegin, stream, values[0].data());
+         Inner::CrossPlane(cells, values[0].data(), planes[0].data(), vertex(chunk.mBegin));
+
+         for (Offset z = chunk.mBegin; z < chunk.mEnd; ++z) {
+            SampleLayer(sdf, z + 1, stream, values[1].data());
+            Inner::CrossLayer(cells, values[0].data(), values[1].data(), layer.data(), vertex(z));
+
+            if (z + 1 < chunk.mEnd or z + 1 == cells)
+               Inner::CrossPlane(cells, values[1].data(), planes[1].data(), vertex(z + 1));
+            else {
+               // The top plane belongs to the next chunk, which visits 
+               // it first, in the same order                           
+               IndexType ordinal = 0;
+               Inner::CrossPlane(cells, values[1].data(), planes[1].data(), [&](Offset, Offset, int, ScalarType) {
+                  return Chunk::Foreign | ordinal++;
+               });
+            }
+
+            for (Offset j = 0; j < cells; ++j) {
+               for (Offset i = 0; i < cells; ++i) {
+                  int config = 0;
+                  for (int c = 0; c < 8; ++c) {
+                     const Offset at = (j + ((c >> 1) & 1)) * side + i + (c & 1);
+                     config |= int(values[c >> 2][at] < 0) << c;
+                  }
+
+                  const auto& table = Inner::MarchingCubes;
+                  for (int e = 0; e < table.mCount[config] * 3; ++e) {
+                     chunk.mIndices.push_back(Inner::CubeEdgeIndex(
+                        table.mEdges[config][e], i, j, side,
+                        planes[0].data(), planes[1].data(), layer.data()));
+                  }
+               }
+            }
+
+            ::std::swap(values[0], values[1]);
+            ::std::swap(planes[0], planes[1]);
+         }
+      });
+   }
+
+   /// Extract the surface with dual contouring                               
+   /// Each cell the surface passes through gets a single vertex, placed      
+   /// where the tangent planes at the edge crossings meet, which keeps       
+   /// sharp edges and corners sharp; each crossed edge becomes a quad        
+   ///   @param sdf - the distance function, scalar or batched                
+   ///   @param threads - number of threads to use, zero to use all cores     
+   ///   @return the mesh                                                     
+   TEMPLATE() template<class F>
+   auto TIsoSurface<T>::DualContouring(F&& sdf, Count threads) const -> MeshType {
+      const Count cells = mResolution;
+      const Count side = cells + 1;
+      const T step = GetStep();
+
+      return Run(sdf, threads, [&](Chunk& chunk, StreamType& stream) {
+         ::std::vector<ScalarType> values[2] {
+            ::std::vector<ScalarType>(side * side),
+            ::std::vector<ScalarType>(side * side)
+         };
+         ::std::vector<IndexType> planes[2] {
+            ::std::vector<IndexType>(side * side * 2),
+            ::std::vector<IndexType>(side * side * 2)
+         };
+         ::std::vector<IndexType> layer(side * side);
+         // Vertex indices of the cells below and in the current layer  
+         ::std::vector<IndexType> vertices[2] {
+            ::std::vector<IndexType>(cells * cells),
+            ::std::vector<IndexType>(cells * cells)
+         };
+
+         // Edge crossings, and the surface normals at them             
+         ::std::vector<T> crossings;
+         ::std::vector<T> normals;
+         const auto crossing = [&](Offset z) {
+            return [&, z](Offset i, Offset j, int axis, ScalarType t) {
+               T point = GetCorner(i, j, z);
+               point[axis] += step[axis] * t;
+               crossings.push_back(point);
+               return static_cast<IndexType>(crossings.size() - 1);
+            };
+         };
+         const auto sampleNormals = [&] {
+            const Count known = normals.size();
+            normals.resize(crossings.size());
+            SampleNormals(sdf, crossings.data() + known, crossings.size() - known,
+               stream, normals.data() + known);
+         };
+
+         const auto configOf = [&](Offset i, Offset j) {
+            int config = 0;
+            for (int c = 0; c < 8; ++c) {
+               const Offset at = (j + ((c >> 1) & 1)) * side + i + (c & 1);
+               config |= int(values[c >> 2][at] < 0) << c;
+            }
+            return config;
+         };
+
+         // Emit two triangles for a crossed edge, from the vertices of 
+         // the four cells around it, listed counter-clockwise around   
+         // the edge axis; flipped if the edge exits the surface        
+         const auto quad = [&](ScalarType lower, IndexType a, IndexType b, IndexType c, IndexType d) {
+            if (lower >= 0)
+               ::std::swap(b, d);
+            chunk.mIndices.insert(chunk.mIndices.end(), {a, b, c, a, c, d});
+         };
+
+         // Quads of the edges in the plane between two cell layers     
+         const auto planeQuads = [&] {
+            const auto& below = vertices[0];
+            const auto& above = vertices[1];
+            for (Offset j = 1; j < cells; ++j) {
+               for (Offset i = 0; i < cells; ++i) {
+                  const ScalarType a = values[0][j * side + i];
+                  if ((a < 0) != (values[0][j * side + i + 1] < 0)) {
+                     quad(a, below[(j - 1) * cells + i], below[j * cells + i],
+                        above[j * cells + i], above[(j - 1) * cells + i]);
+                  }
+               }
+            }
+            for (Offset j = 0; j < cells; ++j) {
+               for (Offset i = 1; i < cells; ++i) {
+                  const ScalarType a = values[0][j * side + i];
+                  if ((a < 0) != (values[0][(j + 1) * side + i] < 0)) {
+                     quad(a, below[j * cells + i - 1], above[j * cells + i - 1],
+                        above[j * cells + i], below[j * cells + i]);
+                  }
+               }
+            }
+         };
+
+         SampleLayer(sdf, chunk.mBegin, stream, values[0].data());
+         Inner::CrossPlane(cells, values[0].data(), planes[0].data(), crossing(chunk.mBegin));
+
+         for (Offset z = chunk.mBegin; z < chunk.mEnd; ++z) {
+            SampleLayer(sdf, z + 1, stream, values[1].data());
+            Inner::CrossLayer(cells, values[0].data(), values[1].data(), layer.data(), crossing(z));
+            Inner::CrossPlane(cells, values[1].data(), planes[1].data(), crossing(z + 1));
+            sampleNormals();
+
+            // Place a vertex in each cell with crossings, minimizing   
+            // the squared distances to the tangent planes, biased      
+            // towards the average crossing                             
+            for (Offset j = 0; j < cells; ++j) {
+               for (Offset i = 0; i < cells; ++i) {
+                  const int config = configOf(i, j);
+                  if (config == 0 or config == 255)
+                     continue;
+
+                  IndexType edges[12];
+                  Count count = 0;
+                  T mass {};
+                  for (int e = 0; e < 12; ++e) {
+                     const int lo = Inner::CubeEdgeCorner(e);
+                     const int hi = lo | (1 << (e / 4));
+                     if (((config >> lo) & 1) == ((config >> hi) & 1))
+                        continue;
+                     edges[count] = Inner::CubeEdgeIndex(e, i, j, side,
+                        planes[0].data(), planes[1].data(), layer.data());
+                     mass += crossings[edges[count++]];
+                  }
+                  mass /= static_cast<ScalarType>(count);
+
+                  ScalarType ata[3][3] {};
+                  ScalarType atb[3] {};
+                  for (Offset k = 0; k < count; ++k) {
+                     const T& n = normals[edges[k]];
+                     const ScalarType d = n.Dot(crossings[edges[k]] - mass);
+                     for (Offset r = 0; r < 3; ++r) {
+                        for (Offset c = 0; c < 3; ++c)
+                           ata[r][c] += n[r] * n[c];
+                        atb[r] += n[r] * d;
+                     }
+                  }
+                  for (Offset r = 0; r < 3; ++r)
+                     ata[r][r] += mRegularization;
+
+                  // Solve the regularized system with Cramer's rule    
+                  const auto det = [](const ScalarType (&m)[3][3]) {
+                     return m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1])
+                          - m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0])
+                          + m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+                  };
+                  const ScalarType inverse = ScalarType(1) / det(ata);
+                  const T lower = GetCorner(i, j, z);
+                  T point;
+                  for (Offset c = 0; c < 3; ++c) {
+                     ScalarType m[3][3];
+                     for (Offset r = 0; r < 3; ++r) {
+                        for (Offset k = 0; k < 3; ++k)
+                           m[r][k] = k == c ? atb[r] : ata[r][k];
+                     }
+                     point[c] = ::std::clamp(mass[c] + det(m) * inverse,
+                        lower[c], lower[c] + step[c]);
+                  }
+
+                  vertices[1][j * cells + i] = static_cast<IndexType>(chunk.mPoints.size());
+                  chunk.mPoints.push_back(point);
+               }
+            }
+
+            // Quads of the edges between the planes                    
+            for (Offset j = 1; j < cells; ++j) {
+               for (Offset i = 1; i < cells; ++i) {
+                  const ScalarType a = values[0][j * side + i];
+                  if ((a < 0) != (values[1][j * side + i] < 0)) {
+                     const auto& v = vertices[1];
+                     quad(a, v[(j - 1) * cells + i - 1], v[(j - 1) * cells + i],
+                        v[j * cells + i], v[j * cells + i - 1]);
+                  }
+               }
+            }
+
+            // Quads of the edges in the bottom plane, which is shared  
+            // with the chunk below, are emitted here, and not there    
+            if (z > chunk.mBegin)
+               planeQuads();
+
+            ::std::swap(values[0], values[1]);
+            ::std::swap(planes[0], planes[1]);
+            ::std::swap(vertices[0], vertices[1]);
+         }
+
+         // Quads of the edges in the top plane refer to the vertices   
+         // of the next chunk, which creates them first, in this order  
+         if (chunk.mEnd < cells) {
+            SampleLayer(sdf, chunk.mEnd + 1, stream, values[1].data());
+            IndexType ordinal = 0;
+            for (Offset j = 0; j < cells; ++j) {
+               for (Offset i = 0; i < cells; ++i) {
+                  const int config = configOf(i, j);
+                  if (config != 0 and config != 255)
+                     vertices[1][j * cells + i] = Chunk::Foreign | ordinal++;
+               }
+            }
+            planeQuads();
+         }
+      });
+   }
+
+   /// Get the size of a grid cell                                            
+   TEMPLATE() LANGULUS(INLINED)
+   T TIsoSurface<T>::GetStep() const noexcept {
+      return (mBounds.mMax - mBounds.mMin) / static_cast<ScalarType>(mResolution);
+   }
+
+   /// Get the position of a grid point                                       
+   TEMPLATE() LANGULUS(INLINED)
+   T TIsoSurface<T>::GetCorner(Offset i, Offset j, Offset k) const noexcept {
+      const T step = GetStep();
+      return T {
+         mBounds.mMin[0] + step[0] * static_cast<ScalarType>(i),
+         mBounds.mMin[1] + step[1] * static_cast<ScalarType>(j),
+         mBounds.mMin[2] + step[2] * static_cast<ScalarType>(k)
+      };
+   }
+
+   /// Sample all grid points of a plane                                      
+   ///   @param sdf - the distance function, scalar or batched                
+   ///   @param z - the plane                                                 
+   ///   @param stream - scratch stream for batched functions                 
+   ///   @param out - [out] the distances, (mResolution + 1)^2 of them        
+   TEMPLATE() template<class F>
+   void TIsoSurface<T>::SampleLayer(F& sdf, Offset z, StreamType& stream, ScalarType* out) const {
+      const Count side = mResolution + 1;
+      if constexpr (Inner::BatchedSDF<Decay<F>, ScalarType, 3>) {
+         stream.Resize(side * side);
+         for (Offset j = 0; j < side; ++j) {
+            for (Offset i = 0; i < side; ++i)
+               stream.Set(j * side + i, GetCorner(i, j, z));
+         }
+         sdf(stream, out);
+      }
+      else for (Offset j = 0; j < side; ++j) {
+         for (Offset i = 0; i < side; ++i)
+            out[j * side + i] = static_cast<ScalarType>(sdf(GetCorner(i, j, z)));
+      }
+   }
+
+   /// Get surface normals from the tetrahedral gradient                      
+   ///   @param sdf - the distance function, scalar or batched                
+   ///   @param points - the points                                           
+   ///   @param count - number of points                                      
+   ///   @param stream - scratch stream for batched functions                 
+   ///   @param out - [out] the normals                                       
+   TEMPLATE() template<class F>
+   void TIsoSurface<T>::SampleNormals(F& sdf, const T* points, Count count, StreamType& stream, T* out) const {
+      if (not count)
+         return;
+
+      const T step = GetStep();
+      const ScalarType h = ::std::min({step[0], step[1], step[2]}) * ScalarType(0.01);
+      const T offsets[4] {T {h, -h, -h}, T {-h, -h, h}, T {-h, h, -h}, T {h, h, h}};
+
+      ::std::vector<ScalarType> distances(count * 4);
+      if constexpr (Inner::BatchedSDF<Decay<F>, ScalarType, 3>) {
+         stream.Resize(count * 4);
+         for (Offset i = 0; i < count; ++i) {
+            for (Offset k = 0; k < 4; ++k)
+               stream.Set(i * 4 + k, points[i] + offsets[k]);
+         }
+         sdf(stream, distances.data());
+      }
+      else for (Offset i = 0; i < count; ++i) {
+         for (Offset k = 0; k < 4; ++k)
+            distances[i * 4 + k] = static_cast<ScalarType>(sdf(points[i] + offsets[k]));
+      }
+
+      for (Offset i = 0; i < count; ++i) {
+         T gradient {};
+         for (Offset k = 0; k < 4; ++k)
+            gradient += offsets[k] * distances[i * 4 + k];
+         out[i] = gradient.Normalize();
+      }
+   }
+
+   /// Split the grid into chunks, run them in parallel, and stitch the       
+   /// results into a single mesh                                             
+   ///   @param sdf - the distance function                                   
+   ///   @param threads - number of threads to use, zero to use all cores     
+   ///   @param work - fills a chunk                                          
+   ///   @return the mesh                                                     
+   TEMPLATE() template<class F, class CHUNK_WORK>
+   auto TIsoSurface<T>::Run(F& sdf, Count threads, CHUNK_WORK&& work) const -> MeshType {
+      LANGULUS_ASSUME(UserAssumes, mResolution > 0 and mChunk > 0,
+         "Bad isosurface resolution");
+
+      const Count chunkCount = (mResolution + mChunk - 1) / mChunk;
+      TMany<Chunk> chunks;
+      chunks.Reserve(chunkCount);
+      for (Offset c = 0; c < chunkCount; ++c)
+         chunks << Chunk {c * mChunk, ::std::min(mResolution, (c + 1) * mChunk)};
+
+      if (not threads)
+         threads = ::std::max(Count {1}, static_cast<Count>(::std::thread::hardware_concurrency()));
+      threads = ::std::min(threads, chunkCount);
+
+      const auto worker = [&](Offset thread) {
+         StreamType stream;
+         for (Offset c = thread; c < chunkCount; c += threads) {
+            auto& chunk = chunks[c];
+            work(chunk, stream);
+            chunk.mNormals.resize(chunk.mPoints.size());
+            SampleNormals(sdf, chunk.mPoints.data(), chunk.mPoints.size(),
+               stream, chunk.mNormals.data());
+         }
+      };
+
+      ::std::vector<::std::thread> workers;
+      workers.reserve(threads - 1);
+      for (Offset t = 1; t < threads; ++t)
+         workers.emplace_back(worker, t);
+      worker(0);
+      for (auto& w : workers)
+         w.join();
+
+      // Chunk vertices are concatenated, and indices are offset by the 
+      // vertex count of all preceding chunks                           
+      TMany<Count> offsets;
+      offsets.template Reserve<true>(chunkCount + 1);
+      offsets[0] = 0;
+      Count indexCount = 0;
+      for (Offset c = 0; c < chunkCount; ++c) {
+         offsets[c + 1] = offsets[c] + chunks[c].mPoints.size();
+         indexCount += chunks[c].mIndices.size();
+      }
+      const Count vertexCount = offsets[chunkCount];
+      LANGULUS_ASSUME(UserAssumes, vertexCount < Chunk::Foreign,
+         "Too many isosurface vertices");
+
+      MeshType mesh;
+      if (vertexCount) {
+         mesh.mPoints.template Reserve<true>(vertexCount);
+         mesh.mNormals.template Reserve<true>(vertexCount);
+         mesh.mIndices.template Reserve<true>(indexCount);
+      }
+
+      IndexType* indices = mesh.mIndices.GetRaw();
+      for (Offset c = 0; c < chunkCount; ++c) {
+         const auto& chunk = chunks[c];
+         ::std::copy(chunk.mPoints.begin(), chunk.mPoints.end(), mesh.mPoints.GetRaw() + offsets[c]);
+         ::std::copy(chunk.mNormals.begin(), chunk.mNormals.end(), mesh.mNormals.GetRaw() + offsets[c]);
+         for (auto index : chunk.mIndices) {
+            *indices++ = static_cast<IndexType>((index & Chunk::Foreign)
+               ? offsets[c + 1] + (index & ~Chunk::Foreign)
+               : offsets[c] + index);
+         }
+      }
+      return mesh;
+   }
+
+} // namespace Langulus::Math
+
+#undef TEMPLATE
\ No newline at end of file
@@ -0,0 +1,200 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Interval.hpp"
+#include "../Quaternions/TQuaternion.hpp"
+
+
+namespace Langulus::Math
+{
+
+   template<CT::Real>
+   struct TSDFTree;
+   template<CT::Real>
+   struct TSDFTape;
+
+   using SDFTree = TSDFTree<Real>;
+   using SDFTape = TSDFTape<Real>;
+
+
+   /// Operations in an SDF expression tree, and in its compiled tape         
+   enum class SDFOp : ::std::uint8_t {
+      // Primitives - a distance register from a point register         
+      Sphere, Ellipsoid, Box, BoxRounded, Cylinder, CylinderCapped,
+      Cone, Plane, Torus,
+
+      // Point transforms - a point register from a point register,     
+      // into the space of the transformed child                        
+      Translate, Rotate, Scale,
+
+      // Unary distance operations - a distance register in place       
+      Rescale, Round, Onion,
+
+      // Binary distance operations - two distance registers into the   
+      // first one                                                      
+      Union, Intersection, Subtraction,
+      SmoothUnion, SmoothIntersection, SmoothSubtraction
+   };
+
+
+   ///                                                                        
+   ///   Operands, shared between an SDF tree and its tapes                   
+   ///                                                                        
+   /// Instructions refer to these by index, instead of embedding them, so    
+   /// that instructions remain small and of the same size                    
+   ///                                                                        
+   template<CT::Real T>
+   struct TSDFOperands {
+      using PointType = TVector<T, 3>;
+
+      TMany<TSphere<PointType>>         mSpheres;
+      TMany<TEllipsoid<PointType>>      mEllipsoids;
+      TMany<TBox<PointType>>            mBoxes;
+      TMany<TBoxRounded<PointType>>     mBoxesRounded;
+      TMany<TCylinder<PointType>>       mCylinders;
+      TMany<TCylinderCapped<PointType>> mCylindersCapped;
+      TMany<TCone<PointType>>           mCones;
+      TMany<TPlane<PointType>>          mPlanes;
+      TMany<TTorus<PointType>>          mTori;
+
+      // Translations, and three columns per inverse rotation           
+      TMany<PointType> mVectors;
+      // Scales, blend factors, rounding radii, etc.                    
+      TMany<T> mScalars;
+   };
+
+
+   ///                                                                        
+   ///   Signed distance expression tree                                      
+   ///                                                                        
+   /// Composes primitives, transforms and CSG operations into a single       
+   /// distance field. Nodes are referenced by handles, returned when they    
+   /// are added, and a node can be used as a child any number of times.      
+   /// Primitives are centered at origin, with their default orientation -    
+   /// use Translate, Rotate and Scale to place them. Trees aren't evaluated  
+   /// directly - they are compiled to a TSDFTape first.                      
+   ///                                                                        
+   template<CT::Real T>
+   struct TSDFTree {
+      using ScalarType = T;
+      using PointType  = TVector<T, 3>;
+      using QuatType   = TQuaternion<T>;
+      using Node       = ::std::uint32_t;
+
+      struct Entry {
+         SDFOp mOp;
+         // Child nodes, for transforms and distance operations         
+         Node mChildren[2] {};
+         // Index in the operand pool, that corresponds to mOp          
+         ::std::uint32_t mData {};
+      };
+
+   protected:
+      TMany<Entry> mNodes;
+      TSDFOperands<T> mOperands;
+
+      Node Push(SDFOp, ::std::uint32_t, Node = 0, Node = 0);
+      Node PushScalar(SDFOp, T, Node, Node = 0);
+      void Check(Node) const;
+
+   public:
+      Node Add(const TSphere<PointType>&);
+      Node Add(const TEllipsoid<PointType>&);
+      Node Add(const TBox<PointType>&);
+      Node Add(const TBoxRounded<PointType>&);
+      Node Add(const TCylinder<PointType>&);
+      Node Add(const TCylinderCapped<PointType>&);
+      Node Add(const TCone<PointType>&);
+      Node Add(const TPlane<PointType>&);
+      Node Add(const TTorus<PointType>&);
+
+      Node Translate(Node, const PointType&);
+      Node Rotate(Node, const QuatType&);
+      Node Scale(Node, T);
+
+      Node Round(Node, T);
+      Node Onion(Node, T);
+
+      Node Union(Node, Node);
+      Node Intersection(Node, Node);
+      Node Subtraction(Node, Node);
+      Node SmoothUnion(Node, Node, T);
+      Node SmoothIntersection(Node, Node, T);
+      Node SmoothSubtraction(Node, Node, T);
+
+      NOD() Count GetCount() const noexcept;
+      NOD() auto GetNode(Node) const -> const Entry&;
+      NOD() auto Compile(Node) const -> TSDFTape<T>;
+      void Clear();
+
+   protected:
+      NOD() Count GetRegisterNeed(Node) const;
+      void Emit(TSDFTape<T>&, Node, Count, Count) const;
+   };
+
+
+   ///                                                                        
+   ///   Compiled signed distance expression                                  
+   ///                                                                        
+   ///   A flat list of instructions, evaluated by a register interpreter,    
+   /// a block of points (one 512-bit register worth) at a time. Point        
+   /// registers hold a block of points, one lane per component, and          
+   /// distance registers hold a block of distances. Point register zero is   
+   /// the input, and the result ends up in distance register zero.           
+   ///   Instructions are dispatched once per block instead of once per       
+   /// point, and each runs a branchless loop over the whole block, that      
+   /// compilers vectorize - no virtual calls or per-point branches.          
+   ///   Registers live in a scratch buffer, that callers can keep between    
+   /// evaluations - one per thread, since a tape can be evaluated from many  
+   /// threads at once. Prepare the buffers on the thread that owns them, so  
+   /// that worker threads never allocate.                                    
+   ///                                                                        
+   template<CT::Real T>
+   struct TSDFTape {
+      using ScalarType = T;
+      using PointType  = TVector<T, 3>;
+      using StreamType = TVectorStream<T, 3>;
+      static constexpr Count Block = StreamType::Block;
+
+      struct Instruction {
+         SDFOp mOp;
+         // The register written to, and the registers read from        
+         ::std::uint16_t mTarget {};
+         ::std::uint16_t mA {};
+         ::std::uint16_t mB {};
+         // Index in the operand pool, that corresponds to mOp          
+         ::std::uint32_t mData {};
+      };
+
+   protected:
+      friend struct TSDFTree<T>;
+      TMany<Instruction> mCode;
+      TSDFOperands<T> mOperands;
+      Count mPointRegisters = 1;
+      Count mDistanceRegisters = 1;
+
+      void EvaluateBlock(const T* const*, T*, T*) const noexcept;
+
+   public:
+      NOD() auto GetCode() const noexcept -> const TMany<Instruction>&;
+      NOD() Count GetPointRegisters() const noexcept;
+      NOD() Count GetDistanceRegisters() const noexcept;
+
+      T* PrepareScratch(TMany<T>&) const;
+      auto PrepareScratch(TMany<Inner::Interval<T>>&) const -> Inner::Interval<T>*;
+
+      void Evaluate(const StreamType&, T*) const;
+      void Evaluate(const StreamType&, T*, TMany<T>&) const;
+      NOD() auto Evaluate(const StreamType&) const -> TMany<T>;
+      NOD() T Evaluate(const PointType&) const;
+      NOD() T Evaluate(const PointType&, TMany<T>&) const;
+      NOD() auto Evaluate(const TRange<PointType>&) const -> TDistanceBounds<T>;
+      NOD() auto Evaluate(const TRange<PointType>&, TMany<Inner::Interval<T>>&) const -> TDistanceBounds<T>;
+   };
+
+} // namespace Langulus::Math
\ No newline at end of file
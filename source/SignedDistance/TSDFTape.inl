@@ -0,0 +1,771 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "TSDFTape.hpp"
+#include "Interval.inl"
+#include "../Quaternions/TQuaternion.inl"
+
+#define TEMPLATE() template<CT::Real T>
+
+
+namespace Langulus::Math
+{
+
+   ///                                                                        
+   ///   Expression tree                                                      
+   ///                                                                        
+   /// Add a node                                                             
+   ///   @param op - the operation                                            
+   ///   @param data - index in the operand pool for the operation            
+   ///   @param a - first child, if any                                       
+   ///   @param b - second child, if any                                      
+   ///   @return the new node                                                 
+   TEMPLATE()
+   auto TSDFTree<T>::Push(SDFOp op, ::std::uint32_t data, Node a, Node b) -> Node {
+      mNodes << Entry {op, {a, b}, data};
+      return static_cast<Node>(mNodes.GetCount() - 1);
+   }
+
+   /// Add a node with a single scalar operand                                
+   ///   @param op - the operation                                            
+   ///   @param scalar - the operand                                          
+   ///   @param a - first child                                               
+   ///   @param b - second child, if any                                      
+   ///   @return the new node                                                 
+   TEMPLATE()
+   auto TSDFTree<T>::PushScalar(SDFOp op, T scalar, Node a, Node b) -> Node {
+      mOperands.mScalars << scalar;
+      return Push(op, static_cast<::std::uint32_t>(mOperands.mScalars.GetCount() - 1), a, b);
+   }
+
+   /// Make sure a node handle belongs to this tree                           
+   TEMPLATE() LANGULUS(INLINED)
+   void TSDFTree<T>::Check(Node node) const {
+      LANGULUS_ASSUME(UserAssumes, node < mNodes.GetCount(), "Invalid SDF node");
+   }
+
+   /// Add a primitive                                                        
+   ///   @param primitive - the primitive, centered at origin                 
+   ///   @return the new node                                                 
+   TEMPLATE()
+   auto TSDFTree<T>::Add(const TSphere<PointType>& primitive) -> Node {
+      mOperands.mSpheres << primitive;
+      return Push(SDFOp::Sphere, static_cast<::std::uint32_t>(mOperands.mSpheres.GetCount() - 1));
+   }
+
+   TEMPLATE()
+   auto TSDFTree<T>::Add(const TEllipsoid<PointType>& primitive) -> Node {
+      mOperands.mEllipsoids << primitive;
+      return Push(SDFOp::Ellipsoid, static_cast<::std::uint32_t>(mOperands.mEllipsoids.GetCount() - 1));
+   }
+
+   TEMPLATE()
+   auto TSDFTree<T>::Add(const TBox<PointType>& primitive) -> Node {
+      mOperands.mBoxes << primitive;
+      return Push(SDFOp::Box, static_cast<::std::uint32_t>(mOperands.mBoxes.GetCount() - 1));
+   }
+
+   TEMPLATE()
+   auto TSDFTree<T>::Add(const TBoxRounded<PointType>& primitive) -> Node {
+      mOperands.mBoxesRounded << primitive;
+      return Push(SDFOp::BoxRounded, static_cast<::std::uint32_t>(mOperands.mBoxesRounded.GetCount() - 1));
+   }
+
+   TEMPLATE()
+   auto TSDFTree<T>::Add(const TCylinder<PointType>& primitive) -> Node {
+      mOperands.mCylinders << primitive;
+      return Push(SDFOp::Cylinder, static_cast<::std::uint32_t>(mOperands.mCylinders.GetCount() - 1));
+   }
+
+   TEMPLATE()
+   auto TSDFTree<T>::Add(const TCylinderCapped<PointType>& primitive) -> Node {
+      mOperands.mCylindersCapped << primitive;
+      return Push(SDFOp::CylinderCapped, static_cast<::std::uint32_t>(mOperands.mCylindersCapped.GetCount() - 1));
+   }
+
+   TEMPLATE()
+   auto TSDFTree<T>::Add(const TCone<PointType>& primitive) -> Node {
+      mOperands.mCones << primitive;
+      return Push(SDFOp::Cone, static_cast<::std::uint32_t>(mOperands.mCones.GetCount() - 1));
+   }
+
+   TEMPLATE()
+   auto TSDFTree<T>::Add(const TPlane<PointType>& primitive) -> Node {
+      mOperands.mPlanes << primitive;
+      return Push(SDFOp::Plane, static_cast<::std::uint32_t>(mOperands.mPlanes.GetCount() - 1));
+   }
+
+   TEMPLATE()
+   auto TSDFTree<T>::Add(const TTorus<PointType>& primitive) -> Node {
+      mOperands.mTori << primitive;
+      return Push(SDFOp::Torus, static_cast<::std::uint32_t>(mOperands.mTori.GetCount() - 1));
+   }
+
+   /// Move a node                                                            
+   ///   @param node - the node to move                                       
+   ///   @param offset - the translation                                      
+   ///   @return the new node                                                 
+   TEMPLATE()
+   auto TSDFTree<T>::Translate(Node node, const PointType& offset) -> Node {
+      Check(node);
+      mOperands.mVectors << offset;
+      return Push(SDFOp::Translate, static_cast<::std::uint32_t>(mOperands.mVectors.GetCount() - 1), node);
+   }
+
+   /// Rotate a node around the origin                                        
+   ///   @param node - the node to rotate                                     
+   ///   @param rotation - the rotation                                       
+   ///   @return the new node                                                 
+   TEMPLATE()
+   auto TSDFTree<T>::Rotate(Node node, const QuatType& rotation) -> Node {
+      Check(node);
+
+      // Points are moved into the node's space, so the inverse         
+      // rotation is stored, as three matrix columns                    
+      const auto data = static_cast<::std::uint32_t>(mOperands.mVectors.GetCount());
+      mOperands.mVectors << PointType {PointType {1, 0, 0} * rotation};
+      mOperands.mVectors << PointType {PointType {0, 1, 0} * rotation};
+      mOperands.mVectors << PointType {PointType {0, 0, 1} * rotation};
+      return Push(SDFOp::Rotate, data, node);
+   }
+
+   /// Uniformly scale a node around the origin                               
+   ///   @param node - the node to scale                                      
+   ///   @param scale - the scale, must not be zero                           
+   ///   @return the new node                                                 
+   TEMPLATE()
+   auto TSDFTree<T>::Scale(Node node, T scale) -> Node {
+      Check(node);
+      LANGULUS_ASSUME(UserAssumes, scale != 0, "Zero SDF scale");
+
+      // Both the scale and its inverse are stored                      
+      const auto data = static_cast<::std::uint32_t>(mOperands.mScalars.GetCount());
+      mOperands.mScalars << scale;
+      mOperands.mScalars << T {1} / scale;
+      return Push(SDFOp::Scale, data, node);
+   }
+
+   /// Round the edges of a node, by inflating it                             
+   ///   @param node - the node to round                                      
+   ///   @param radius - the rounding radius                                  
+   ///   @return the new node                                                 
+   TEMPLATE()
+   auto TSDFTree<T>::Round(Node node, T radius) -> Node {
+      Check(node);
+      return PushScalar(SDFOp::Round, radius, node);
+   }
+
+   /// Turn a node into a shell                                               
+   ///   @param node - the node to hollow                                     
+   ///   @param thickness - half the thickness of the shell                   
+   ///   @return the new node                                                 
+   TEMPLATE()
+   auto TSDFTree<T>::Onion(Node node, T thickness) -> Node {
+      Check(node);
+      return PushScalar(SDFOp::Onion, thickness, node);
+   }
+
+   /// Combine two nodes                                                      
+   ///   @param a - the first node                                            
+   ///   @param b - the second node                                           
+   ///   @return the new node                                                 
+   TEMPLATE()
+   auto TSDFTree<T>::Union(Node a, Node b) -> Node {
+      Check(a);
+      Check(b);
+      return Push(SDFOp::Union, 0, a, b);
+   }
+
+   /// Intersect two nodes                                                    
+   ///   @param a - the first node                                            
+   ///   @param b - the second node                                           
+   ///   @return the new node                                                 
+   TEMPLATE()
+   auto TSDFTree<T>::Intersection(Node a, Node b) -> Node {
+      Check(a);
+      Check(b);
+      return Push(SDFOp::Intersection, 0, a, b);
+   }
+
+   /// Carve a node out of another                                            
+   ///   @param a - the node to carve from                                    
+   ///   @param b - the node to carve out                                     
+   ///   @return the new node                                                 
+   TEMPLATE()
+   auto TSDFTree<T>::Subtraction(Node a, Node b) -> Node {
+      Check(a);
+      Check(b);
+      return Push(SDFOp::Subtraction, 0, a, b);
+   }
+
+   /// Combine two nodes, blending them where they meet                       
+   ///   @param a - the first node                                            
+   ///   @param b - the second node                                           
+   ///   @param k - the blend distance, must be positive                      
+   ///   @return the new node                                                 
+   TEMPLATE()
+   auto TSDFTree<T>::SmoothUnion(Node a, Node b, T k) -> Node {
+      Check(a);
+      Check(b);
+      LANGULUS_ASSUME(UserAssumes, k > 0, "SDF blend distance must be positive");
+      return PushScalar(SDFOp::SmoothUnion, k, a, b);
+   }
+
+   /// Intersect two nodes, blending them where they meet                     
+   ///   @param a - the first node                                            
+   ///   @param b - the second node                                           
+   ///   @param k - the blend distance, must be positive                      
+   ///   @return the new node                                                 
+   TEMPLATE()
+   auto TSDFTree<T>::SmoothIntersection(Node a, Node b, T k) -> Node {
+      Check(a);
+      Check(b);
+      LANGULUS_ASSUME(UserAssumes, k > 0, "SDF blend distance must be positive");
+      return PushScalar(SDFOp::SmoothIntersection, k, a, b);
+   }
+
+   /// Carve a node out of another, blending them where they meet             
+   ///   @param a - the node to carve from                                    
+   ///   @param b - the node to carve out                                     
+   ///   @param k - the blend distance, must be positive                      
+   ///   @return the new node                                                 
+   TEMPLATE()
+   auto TSDFTree<T>::SmoothSubtraction(Node a, Node b, T k) -> Node {
+      Check(a);
+      Check(b);
+      LANGULUS_ASSUME(UserAssumes, k > 0, "SDF blend distance must be positive");
+      return PushScalar(SDFOp::SmoothSubtraction, k, a, b);
+   }
+
+   /// Get the number of nodes in the tree                                    
+   TEMPLATE() LANGULUS(INLINED)
+   Count TSDFTree<T>::GetCount() const noexcept {
+      return mNodes.GetCount();
+   }
+
+   /// Get a node                                                             
+   ///   @param node - the node handle                                        
+   ///   @return the node                                                     
+   TEMPLATE() LANGULUS(INLINED)
+   auto TSDFTree<T>::GetNode(Node node) const -> const Entry& {
+      Check(node);
+      return mNodes[node];
+   }
+
+   /// Remove all nodes and operands                                          
+   TEMPLATE()
+   void TSDFTree<T>::Clear() {
+      mNodes.Clear();
+      mOperands = {};
+   }
+
+   /// Get the number of distance registers a node needs to be evaluated      
+   /// Binary operations evaluate their more demanding child first, so that   
+   /// its registers are free when the other child is evaluated               
+   ///   @param node - the node                                               
+   ///   @return the number of distance registers                             
+   TEMPLATE()
+   Count TSDFTree<T>::GetRegisterNeed(Node node) const {
+      const auto& entry = mNodes[node];
+      if (entry.mOp < SDFOp::Translate)
+         return 1;
+      if (entry.mOp < SDFOp::Union)
+         return GetRegisterNeed(entry.mChildren[0]);
+
+      const Count a = GetRegisterNeed(entry.mChildren[0]);
+      const Count b = GetRegisterNeed(entry.mChildren[1]);
+      return a == b ? a + 1 : ::std::max(a, b);
+   }
+
+   /// Compile the tree into a tape                                           
+   ///   @param root - the node that produces the final distance              
+   ///   @return the tape                                                     
+   TEMPLATE()
+   auto TSDFTree<T>::Compile(Node root) const -> TSDFTape<T> {
+      Check(root);
+      TSDFTape<T> tape;
+      tape.mOperands = mOperands;
+      tape.mDistanceRegisters = GetRegisterNeed(root);
+      Emit(tape, root, 0, 0);
+      LANGULUS_ASSUME(UserAssumes,
+         tape.mPointRegisters <= 0xFFFF and tape.mDistanceRegisters <= 0xFFFF,
+         "SDF tree is too deep");
+      return tape;
+   }
+
+   /// Emit instructions for a node, depth first                              
+   ///   @param tape - [out] the tape to emit to                              
+   ///   @param node - the node                                               
+   ///   @param point - the point register the node is evaluated in           
+   ///   @param distance - the distance register, that receives the result,   
+   ///      all registers above it are free to use                            
+   TEMPLATE()
+   void TSDFTree<T>::Emit(TSDFTape<T>& tape, Node node, Count point, Count distance) const {
+      using Instruction = typename TSDFTape<T>::Instruction;
+      using Index = ::std::uint16_t;
+      const auto& entry = mNodes[node];
+      const auto op = entry.mOp;
+
+      if (op < SDFOp::Translate) {
+         // Primitive                                                   
+         tape.mCode << Instruction {op,
+            Index(distance), Index(point), 0, entry.mData};
+      }
+      else if (op < SDFOp::Rescale) {
+         // Transform the point into a new point register, and          
+         // evaluate the child in it                                    
+         tape.mCode << Instruction {op,
+            Index(point + 1), Index(point), 0, entry.mData};
+         tape.mPointRegisters = ::std::max(tape.mPointRegisters, point + 2);
+         Emit(tape, entry.mChildren[0], point + 1, distance);
+
+         // Distances shrink along with the points                      
+         if (op == SDFOp::Scale) {
+            tape.mCode << Instruction {SDFOp::Rescale,
+               Index(distance), Index(distance), 0, entry.mData};
+         }
+      }
+      else if (op < SDFOp::Union) {
+         Emit(tape, entry.mChildren[0], point, distance);
+         tape.mCode << Instruction {op,
+            Index(distance), Index(distance), 0, entry.mData};
+      }
+      else {
+         // The more demanding child goes first, and the operation      
+         // reads its operands from wherever they ended up              
+         const Node a = entry.mChildren[0];
+         const Node b = entry.mChildren[1];
+         const bool swapped = GetRegisterNeed(b) > GetRegisterNeed(a);
+         Emit(tape, swapped ? b : a, point, distance);
+         Emit(tape, swapped ? a : b, point, distance + 1);
+         tape.mCode << Instruction {op, Index(distance),
+            Index(swapped ? distance + 1 : distance),
+            Index(swapped ? distance : distance + 1),
+            entry.mData};
+      }
+   }
+
+   ///                                                                        
+   ///   Tape                                                                 
+   ///                                                                        
+   /// Get the compiled instructions                                          
+   TEMPLATE() LANGULUS(INLINED)
+   auto TSDFTape<T>::GetCode() const noexcept -> const TMany<Instruction>& {
+      return mCode;
+   }
+
+   /// Get the number of point registers, including the input one             
+   TEMPLATE() LANGULUS(INLINED)
+   Count TSDFTape<T>::GetPointRegisters() const noexcept {
+      return mPointRegisters;
+   }
+
+   /// Get the number of distance registers, including the output one         
+   TEMPLATE() LANGULUS(INLINED)
+   Count TSDFTape<T>::GetDistanceRegisters() const noexcept {
+      return mDistanceRegisters;
+   }
+
+   /// Make sure a scratch buffer has room for all registers of the tape      
+   /// It is only allocated when too small, so it can be kept between calls   
+   ///   @param scratch - [in/out] the buffer                                 
+   ///   @return memory for the registers                                     
+   TEMPLATE()
+   T* TSDFTape<T>::PrepareScratch(TMany<T>& scratch) const {
+      const Count size = ((mPointRegisters - 1) * 3 + (mDistanceRegisters - 1)) * Block;
+      if (scratch.GetCount() < size)
+         scratch.template Reserve<true>(size);
+      return scratch.GetRaw();
+   }
+
+   /// Make sure a scratch buffer has room for all interval registers         
+   /// Point registers come first, followed by the distance registers         
+   ///   @param scratch - [in/out] the buffer                                 
+   ///   @return memory for the registers                                     
+   TEMPLATE()
+   auto TSDFTape<T>::PrepareScratch(TMany<Inner::Interval<T>>& scratch) const -> Inner::Interval<T>* {
+      const Count size = mPointRegisters * 3 + mDistanceRegisters;
+      if (scratch.GetCount() < size)
+         scratch.template Reserve<true>(size);
+      return scratch.GetRaw();
+   }
+
+   /// Run the tape for a single block of points                              
+   ///   @param input - the points, one pointer per component lane            
+   ///   @param out - [out] the distances, used as distance register zero     
+   ///   @param scratch - memory for the rest of the registers                
+   TEMPLATE()
+   void TSDFTape<T>::EvaluateBlock(const T* const* input, T* out, T* scratch) const noexcept {
+      T* const distances = scratch + (mPointRegisters - 1) * 3 * Block;
+      const auto points = [&](Count r, const T** p) {
+         for (Offset c = 0; c < 3; ++c)
+            p[c] = r ? scratch + ((r - 1) * 3 + c) * Block : input[c];
+      };
+      const auto pointsOut = [&](Count r) {
+         return scratch + (r - 1) * 3 * Block;
+      };
+      const auto dist = [&](Count r) {
+         return r ? distances + (r - 1) * Block : out;
+      };
+
+      for (const auto& ins : mCode) {
+         // Primitives and transforms read a point register             
+         const T* p[3] {};
+         if (ins.mOp < SDFOp::Rescale)
+            points(ins.mA, p);
+
+         switch (ins.mOp) {
+         case SDFOp::Sphere:
+            Inner::SignedDistanceBlock(p, dist(ins.mTarget), mOperands.mSpheres[ins.mData]);
+            break;
+         case SDFOp::Ellipsoid:
+            Inner::SignedDistanceBlock(p, dist(ins.mTarget), mOperands.mEllipsoids[ins.mData]);
+            break;
+         case SDFOp::Box:
+            Inner::SignedDistanceBlock(p, dist(ins.mTarget), mOperands.mBoxes[ins.mData]);
+            break;
+         case SDFOp::BoxRounded:
+            Inner::SignedDistanceBlock(p, dist(ins.mTarget), mOperands.mBoxesRounded[ins.mData]);
+            break;
+         case SDFOp::Cylinder:
+            Inner::SignedDistanceBlock(p, dist(ins.mTarget), mOperands.mCylinders[ins.mData]);
+            break;
+         case SDFOp::CylinderCapped:
+            Inner::SignedDistanceBlock(p, dist(ins.mTarget), mOperands.mCylindersCapped[ins.mData]);
+            break;
+         case SDFOp::Cone:
+            Inner::SignedDistanceBlock(p, dist(ins.mTarget), mOperands.mCones[ins.mData]);
+            break;
+         case SDFOp::Plane:
+            Inner::SignedDistanceBlock(p, dist(ins.mTarget), mOperands.mPlanes[ins.mData]);
+            break;
+         case SDFOp::Torus:
+            Inner::SignedDistanceBlock(p, dist(ins.mTarget), mOperands.mTori[ins.mData]);
+            break;
+
+         case SDFOp::Translate: {
+            T* q = pointsOut(ins.mTarget);
+            const auto& offset = mOperands.mVectors[ins.mData];
+            for (Offset c = 0; c < 3; ++c) {
+               const T o = offset[c];
+               for (Offset j = 0; j < Block; ++j)
+                  q[c * Block + j] = p[c][j] - o;
+            }
+            break;
+         }
+         case SDFOp::Rotate: {
+            // Broadcast each input component against a matrix column   
+            T* q = pointsOut(ins.mTarget);
+            const auto* columns = &mOperands.mVectors[ins.mData];
+            for (Offset k = 0; k < 3; ++k) {
+               const T c0 = columns[0][k];
+               const T c1 = columns[1][k];
+               const T c2 = columns[2][k];
+               for (Offset j = 0; j < Block; ++j)
+                  q[k * Block + j] = p[0][j] * c0 + p[1][j] * c1 + p[2][j] * c2;
+            }
+            break;
+         }
+         case SDFOp::Scale: {
+            T* q = pointsOut(ins.mTarget);
+            const T inverse = mOperands.mScalars[ins.mData + 1];
+            for (Offset c = 0; c < 3; ++c) {
+               for (Offset j = 0; j < Block; ++j)
+                  q[c * Block + j] = p[c][j] * inverse;
+            }
+            break;
+         }
+
+         case SDFOp::Rescale: {
+            T* d = dist(ins.mTarget);
+            const T scale = mOperands.mScalars[ins.mData];
+            for (Offset j = 0; j < Block; ++j)
+               d[j] *= scale;
+            break;
+         }
+         case SDFOp::Round: {
+            T* d = dist(ins.mTarget);
+            const T radius = mOperands.mScalars[ins.mData];
+            for (Offset j = 0; j < Block; ++j)
+               d[j] -= radius;
+            break;
+         }
+         case SDFOp::Onion: {
+            T* d = dist(ins.mTarget);
+            const T thickness = mOperands.mScalars[ins.mData];
+            for (Offset j = 0; j < Block; ++j)
+               d[j] = ::std::abs(d[j]) - thickness;
+            break;
+         }
+
+         case SDFOp::Union: {
+            T* d = dist(ins.mTarget);
+            const T* a = dist(ins.mA);
+            const T* b = dist(ins.mB);
+            for (Offset j = 0; j < Block; ++j)
+               d[j] = ::std::min(a[j], b[j]);
+            break;
+         }
+         case SDFOp::Intersection: {
+            T* d = dist(ins.mTarget);
+            const T* a = dist(ins.mA);
+            const T* b = dist(ins.mB);
+            for (Offset j = 0; j < Block; ++j)
+               d[j] = ::std::max(a[j], b[j]);
+            break;
+         }
+         case SDFOp::Subtraction: {
+            T* d = dist(ins.mTarget);
+            const T* a = dist(ins.mA);
+            const T* b = dist(ins.mB);
+            for (Offset j = 0; j < Block; ++j)
+               d[j] = ::std::max(a[j], -b[j]);
+            break;
+         }
+
+         // Polynomial smooth minimum and maximum, by Inigo Quilez      
+         case SDFOp::SmoothUnion: {
+            T* d = dist(ins.mTarget);
+            const T* a = dist(ins.mA);
+            const T* b = dist(ins.mB);
+            const T k = mOperands.mScalars[ins.mData];
+            const T half = T {0.5} / k;
+            for (Offset j = 0; j < Block; ++j) {
+               const T h = Inner::Clamp01(T {0.5} + (b[j] - a[j]) * half);
+               d[j] = b[j] + (a[j] - b[j]) * h - k * h * (T {1} - h);
+            }
+            break;
+         }
+         case SDFOp::SmoothIntersection: {
+            T* d = dist(ins.mTarget);
+            const T* a = dist(ins.mA);
+            const T* b = dist(ins.mB);
+            const T k = mOperands.mScalars[ins.mData];
+            const T half = T {0.5} / k;
+            for (Offset j = 0; j < Block; ++j) {
+               const T h = Inner::Clamp01(T {0.5} - (b[j] - a[j]) * half);
+               d[j] = b[j] + (a[j] - b[j]) * h + k * h * (T {1} - h);
+            }
+            break;
+         }
+         case SDFOp::SmoothSubtraction: {
+            T* d = dist(ins.mTarget);
+            const T* a = dist(ins.mA);
+            const T* b = dist(ins.mB);
+            const T k = mOperands.mScalars[ins.mData];
+            const T half = T {0.5} / k;
+            for (Offset j = 0; j < Block; ++j) {
+               const T h = Inner::Clamp01(T {0.5} - (a[j] + b[j]) * half);
+               d[j] = a[j] - (a[j] + b[j]) * h + k * h * (T {1} - h);
+            }
+            break;
+         }
+         }
+      }
+   }
+
+   /// Evaluate the distances of a stream of points                           
+   ///   @param points - the points                                           
+   ///   @param out - [out] the distances, must have room for                 
+   ///      points.GetCount() elements                                        
+   TEMPLATE()
+   void TSDFTape<T>::Evaluate(const StreamType& points, T* out) const {
+      TMany<T> scratch;
+      Evaluate(points, out, scratch);
+   }
+
+   /// Evaluate the distances of a stream of points, reusing registers        
+   ///   @param points - the points                                           
+   ///   @param out - [out] the distances, must have room for                 
+   ///      points.GetCount() elements                                        
+   ///   @param scratch - [in/out] memory for the registers, grown only if    
+   ///      too small - keep it between calls to avoid allocating             
+   TEMPLATE()
+   void TSDFTape<T>::Evaluate(const StreamType& points, T* out, TMany<T>& scratch) const {
+      LANGULUS_ASSUME(UserAssumes, not mCode.IsEmpty(), "Evaluating an empty SDF tape");
+      T* const registers = PrepareScratch(scratch);
+      Inner::EvaluateBlocks(points, out, [&](const T* const* p, T* d) {
+         EvaluateBlock(p, d, registers);
+      });
+   }
+
+   /// Evaluate the distances of a stream of points                           
+   ///   @param points - the points                                           
+   ///   @return the distances, one per point                                 
+   TEMPLATE()
+   auto TSDFTape<T>::Evaluate(const StreamType& points) const -> TMany<T> {
+      TMany<T> result;
+      if (points.GetCount()) {
+         result.template Reserve<true>(points.GetCount());
+         Evaluate(points, result.GetRaw());
+      }
+      return result;
+   }
+
+   /// Evaluate the distance of a single point                                
+   /// Prefer streams, this still runs a whole block                          
+   ///   @param point - the point                                             
+   ///   @return the distance                                                 
+   TEMPLATE()
+   T TSDFTape<T>::Evaluate(const PointType& point) const {
+      TMany<T> scratch;
+      return Evaluate(point, scratch);
+   }
+
+   /// Evaluate the distance of a single point, reusing registers             
+   ///   @param point - the point                                             
+   ///   @param scratch - [in/out] memory for the registers, grown only if    
+   ///      too small - keep it between calls to avoid allocating             
+   ///   @return the distance                                                 
+   TEMPLATE()
+   T TSDFTape<T>::Evaluate(const PointType& point, TMany<T>& scratch) const {
+      LANGULUS_ASSUME(UserAssumes, not mCode.IsEmpty(), "Evaluating an empty SDF tape");
+      T lanes[3][Block] {};
+      const T* p[3];
+      for (Offset c = 0; c < 3; ++c) {
+         lanes[c][0] = point[c];
+         p[c] = lanes[c];
+      }
+
+      T result[Block];
+      EvaluateBlock(p, result, PrepareScratch(scratch));
+      return result[0];
+   }
+
+   /// Bound the distances of all points inside a box, by running the tape    
+   /// with interval registers instead of blocks of points                    
+   ///   @param box - the points                                              
+   ///   @return conservative bounds of the distances                         
+   TEMPLATE()
+   auto TSDFTape<T>::Evaluate(const TRange<PointType>& box) const -> TDistanceBounds<T> {
+      TMany<Inner::Interval<T>> scratch;
+      return Evaluate(box, scratch);
+   }
+
+   /// Bound the distances of all points inside a box, reusing registers      
+   ///   @param box - the points                                              
+   ///   @param scratch - [in/out] memory for the interval registers, grown   
+   ///      only if too small - keep it between calls to avoid allocating     
+   ///   @return conservative bounds of the distances                         
+   TEMPLATE()
+   auto TSDFTape<T>::Evaluate(const TRange<PointType>& box, TMany<Inner::Interval<T>>& scratch) const -> TDistanceBounds<T> {
+      LANGULUS_ASSUME(UserAssumes, not mCode.IsEmpty(), "Evaluating an empty SDF tape");
+      using I = Inner::Interval<T>;
+      I* const points = PrepareScratch(scratch);
+      I* const dist = points + mPointRegisters * 3;
+      for (Offset c = 0; c < 3; ++c)
+         points[c] = {box.mMin[c], box.mMax[c]};
+
+      for (const auto& ins : mCode) {
+         // Registers are picked per operation, because the same        
+         // index refers to different register files                    
+         const auto p = [&] { return &points[ins.mA * 3]; };
+         const auto q = [&] { return &points[ins.mTarget * 3]; };
+         const auto d = [&]() -> I& { return dist[ins.mTarget]; };
+
+         switch (ins.mOp) {
+         case SDFOp::Sphere:
+            d() = Inner::SignedDistanceBounds(p(), mOperands.mSpheres[ins.mData]);
+            break;
+         case SDFOp::Ellipsoid:
+            d() = Inner::SignedDistanceBounds(p(), mOperands.mEllipsoids[ins.mData]);
+            break;
+         case SDFOp::Box:
+            d() = Inner::SignedDistanceBounds(p(), mOperands.mBoxes[ins.mData]);
+            break;
+         case SDFOp::BoxRounded:
+            d() = Inner::SignedDistanceBounds(p(), mOperands.mBoxesRounded[ins.mData]);
+            break;
+         case SDFOp::Cylinder:
+            d() = Inner::SignedDistanceBounds(p(), mOperands.mCylinders[ins.mData]);
+            break;
+         case SDFOp::CylinderCapped:
+            d() = Inner::SignedDistanceBounds(p(), mOperands.mCylindersCapped[ins.mData]);
+            break;
+         case SDFOp::Cone:
+            d() = Inner::SignedDistanceBounds(p(), mOperands.mCones[ins.mData]);
+            break;
+         case SDFOp::Plane:
+            d() = Inner::SignedDistanceBounds(p(), mOperands.mPlanes[ins.mData]);
+            break;
+         case SDFOp::Torus:
+            d() = Inner::SignedDistanceBounds(p(), mOperands.mTori[ins.mData]);
+            break;
+
+         case SDFOp::Translate: {
+            const auto& offset = mOperands.mVectors[ins.mData];
+            for (Offset c = 0; c < 3; ++c)
+               q()[c] = p()[c] - I {offset[c]};
+            break;
+         }
+         case SDFOp::Rotate: {
+            const I* source = p();
+            const auto* columns = &mOperands.mVectors[ins.mData];
+            for (Offset k = 0; k < 3; ++k) {
+               q()[k] = source[0] * columns[0][k]
+                      + source[1] * columns[1][k]
+                      + source[2] * columns[2][k];
+            }
+            break;
+         }
+         case SDFOp::Scale: {
+            const T inverse = mOperands.mScalars[ins.mData + 1];
+            for (Offset c = 0; c < 3; ++c)
+               q()[c] = p()[c] * inverse;
+            break;
+         }
+
+         case SDFOp::Rescale:
+            d() = d() * mOperands.mScalars[ins.mData];
+            break;
+         case SDFOp::Round:
+            d() = d() - I {mOperands.mScalars[ins.mData]};
+            break;
+         case SDFOp::Onion:
+            d() = d().Abs() - I {mOperands.mScalars[ins.mData]};
+            break;
+
+         case SDFOp::Union:
+            d() = dist[ins.mA].Min(dist[ins.mB]);
+            break;
+         case SDFOp::Intersection:
+            d() = dist[ins.mA].Max(dist[ins.mB]);
+            break;
+         case SDFOp::Subtraction:
+            d() = dist[ins.mA].Max(-dist[ins.mB]);
+            break;
+
+         // Polynomial smooth minimum undershoots the minimum by at     
+         // most k/4, and the smooth maximum overshoots by as much      
+         case SDFOp::SmoothUnion: {
+            const T k = mOperands.mScalars[ins.mData];
+            const I m = dist[ins.mA].Min(dist[ins.mB]);
+            d() = {m.mMin - k / 4, m.mMax};
+            break;
+         }
+         case SDFOp::SmoothIntersection: {
+            const T k = mOperands.mScalars[ins.mData];
+            const I m = dist[ins.mA].Max(dist[ins.mB]);
+            d() = {m.mMin, m.mMax + k / 4};
+            break;
+         }
+         case SDFOp::SmoothSubtraction: {
+            const T k = mOperands.mScalars[ins.mData];
+            const I m = dist[ins.mA].Max(-dist[ins.mB]);
+            d() = {m.mMin, m.mMax + k / 4};
+            break;
+         }
+         }
+      }
+
+      return {TVector<T, 1> {dist[0].mMin}, TVector<T, 1> {dist[0].mMax}};
+   }
+
+} // namespace Langulus::Math
+
+#undef TEMPLATE
\ No newline at end of file
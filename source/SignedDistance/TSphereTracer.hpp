@@ -0,0 +1,121 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "../Primitives/TRay.hpp"
+#include "Batch.hpp"
+#include <array>
+#include <limits>
+
+
+namespace Langulus::Math
+{
+
+   template<CT::Vector T>
+   struct TSphereTracer;
+
+   using SphereTracer2 = TSphereTracer<Vec2>;
+   using SphereTracer3 = TSphereTracer<Vec3>;
+
+   using SphereTracer = SphereTracer3;
+
+
+   ///                                                                        
+   ///   Result of sphere tracing a single ray                                
+   ///                                                                        
+   template<CT::Vector T>
+   struct TSphereTraceHit : TRayHit<T> {
+      // The hit point, or the point where marching stopped on a miss   
+      T mPoint {};
+      // Number of distance evaluations along the ray, not counting     
+      // the ones for the normal                                        
+      Count mIterations {};
+   };
+
+   namespace Inner
+   {
+
+      /// Marching state of a single ray                                      
+      template<CT::Real T>
+      struct TraceState {
+         T mDistance {};
+         T mPreviousDistance {};
+         T mPreviousRadius {};
+         T mRelaxation {1};
+         T mSign {1};
+         Count mIterations {};
+         bool mHit {};
+      };
+
+   } // namespace Langulus::Math::Inner
+
+
+   ///                                                                        
+   ///   Sphere tracer                                                        
+   ///                                                                        
+   ///   Marches rays through any signed distance function, given as a        
+   /// callable. Scalar callables take a point and return its distance;       
+   /// batched callables take a TVectorStream and a pointer to write the      
+   /// distances to, and are then fed a whole packet of rays per call, so     
+   /// that i.e. a TSDFTape or the batched SignedDistance functions can be    
+   /// used at full width.                                                    
+   ///   Steps are over-relaxed by mRelaxation, with a fallback to a safe     
+   /// step whenever two consecutive unbounding spheres don't overlap         
+   /// (Keinert et al., "Enhanced Sphere Tracing"). Distances are divided     
+   /// by mLipschitz, so functions that overestimate distances (i.e. after    
+   /// non-uniform scaling or displacement) can still be traced safely.       
+   /// Normals are the tetrahedral gradient - four evaluations in 3D.         
+   ///   Packets are spread between threads, so callables must be safe to     
+   /// call concurrently.                                                     
+   ///                                                                        
+   template<CT::Vector T>
+   struct TSphereTracer {
+      using PointType  = T;
+      using ScalarType = TypeOf<T>;
+      using RayType    = TRay<T>;
+      using HitType    = TSphereTraceHit<T>;
+      using StreamType = TVectorStream<ScalarType, T::MemberCount>;
+      using StateType  = Inner::TraceState<ScalarType>;
+
+      static constexpr Count MemberCount = T::MemberCount;
+      // Rays in a packet, when tracing with batched callables          
+      static constexpr Count Packet = StreamType::Block;
+
+      // Rays stop marching this far from their origin                  
+      ScalarType mMaxDistance = 100;
+      // Rays give up after this many distance evaluations              
+      Count mMaxSteps = 256;
+      // A ray hits, once it is closer than this to the surface         
+      ScalarType mEpsilon = ScalarType(0.0001);
+      // Step multiplier in [1, 2); one disables over-relaxation        
+      ScalarType mRelaxation = ScalarType(1.2);
+      // Upper bound of the gradient length of the distance function    
+      ScalarType mLipschitz = 1;
+      // Steps are never longer than this                               
+      ScalarType mMaxStep = ::std::numeric_limits<ScalarType>::infinity();
+      // Offset of the samples for the normal                           
+      ScalarType mNormalOffset = ScalarType(0.0005);
+
+   public:
+      template<class F>
+      NOD() auto Trace(const RayType&, F&&) const -> HitType;
+      template<class F>
+      void Trace(const RayType*, Count, F&&, HitType*, Count threads = 0) const;
+      template<class F>
+      NOD() auto Trace(const TMany<RayType>&, F&&, Count threads = 0) const -> TMany<HitType>;
+
+      template<class F>
+      NOD() T Normal(const T&, F&&) const;
+
+   protected:
+      bool Advance(StateType&, ScalarType) const noexcept;
+      template<class F>
+      void TracePacket(const RayType*, Count, F&, HitType*) const;
+      NOD() static auto GetOffsets(ScalarType) noexcept -> ::std::array<T, 4>;
+   };
+
+} // namespace Langulus::Math
\ No newline at end of file
@@ -0,0 +1,240 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "TSphereTracer.hpp"
+#include "../Vectors/TVectorStream.inl"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#define TEMPLATE() template<CT::Vector T>
+
+
+namespace Langulus::Math
+{
+
+   /// Trace a single ray                                                     
+   ///   @param ray - the ray                                                 
+   ///   @param sdf - the distance function, scalar or batched                
+   ///   @return the hit, if any, along with the number of iterations         
+   TEMPLATE() template<class F>
+   auto TSphereTracer<T>::Trace(const RayType& ray, F&& sdf) const -> HitType {
+      HitType hit;
+      if constexpr (Inner::BatchedSDF<Decay<F>, ScalarType, MemberCount>)
+         TracePacket(&ray, 1, sdf, &hit);
+      else {
+         StateType state;
+         state.mRelaxation = mRelaxation;
+         while (not Advance(state, static_cast<ScalarType>(sdf(ray.Point(state.mDistance)))));
+
+         hit.mIterations = state.mIterations;
+         hit.mPoint = ray.Point(state.mDistance);
+         if (state.mHit) {
+            hit.mDistance = state.mDistance;
+            hit.mNormal = Normal(hit.mPoint, sdf);
+         }
+      }
+      return hit;
+   }
+
+   /// Trace an array of rays, in packets spread between threads              
+   ///   @param rays - the rays                                               
+   ///   @param count - the number of rays                                    
+   ///   @param sdf - the distance function, scalar or batched                
+   ///   @param hits - [out] the results, one per ray                         
+   ///   @param threads - number of threads to use, zero to use all cores     
+   TEMPLATE() template<class F>
+   void TSphereTracer<T>::Trace(const RayType* rays, Count count, F&& sdf, HitType* hits, Count threads) const {
+      const Count packets = (count + Packet - 1) / Packet;
+      if (not packets)
+         return;
+      if (not threads)
+         threads = ::std::max(Count {1}, static_cast<Count>(::std::thread::hardware_concurrency()));
+      threads = ::std::min(threads, packets);
+
+      const auto work = [&](Offset thread) {
+         for (Offset p = thread; p < packets; p += threads) {
+            const Offset start = p * Packet;
+            const Count size = ::std::min(Packet, count - start);
+            if constexpr (Inner::BatchedSDF<Decay<F>, ScalarType, MemberCount>)
+               TracePacket(rays + start, size, sdf, hits + start);
+            else for (Offset i = start; i < start + size; ++i)
+               hits[i] = Trace(rays[i], sdf);
+         }
+      };
+
+      ::std::vector<::std::thread> workers;
+      workers.reserve(threads - 1);
+      for (Offset t = 1; t < threads; ++t)
+         workers.emplace_back(work, t);
+      work(0);
+      for (auto& worker : workers)
+         worker.join();
+   }
+
+   /// Trace a container of rays                                              
+   ///   @param rays - the rays                                               
+   ///   @param sdf - the distance function, scalar or batched                
+   ///   @param threads - number of threads to use, zero to use all cores     
+   ///   @return the results, one per ray                                     
+   TEMPLATE() template<class F>
+   auto TSphereTracer<T>::Trace(const TMany<RayType>& rays, F&& sdf, Count threads) const -> TMany<HitType> {
+      TMany<HitType> result;
+      if (rays.GetCount()) {
+         result.template Reserve<true>(rays.GetCount());
+         Trace(rays.GetRaw(), rays.GetCount(), sdf, result.GetRaw(), threads);
+      }
+      return result;
+   }
+
+   /// Get the surface normal at a point, from the tetrahedral gradient       
+   ///   @param point - the point, usually a hit point                        
+   ///   @param sdf - the distance function, scalar or batched                
+   ///   @return the normalized gradient of the distance function             
+   TEMPLATE() template<class F>
+   T TSphereTracer<T>::Normal(const T& point, F&& sdf) const {
+      const auto offsets = GetOffsets(mNormalOffset);
+      ScalarType distances[Packet] {};
+      if constexpr (Inner::BatchedSDF<Decay<F>, ScalarType, MemberCount>) {
+         StreamType points {offsets.size()};
+         for (Offset i = 0; i < offsets.size(); ++i)
+            points.Set(i, point + offsets[i]);
+         sdf(points, distances);
+      }
+      else for (Offset i = 0; i < offsets.size(); ++i)
+         distances[i] = static_cast<ScalarType>(sdf(point + offsets[i]));
+
+      T gradient {};
+      for (Offset i = 0; i < offsets.size(); ++i)
+         gradient += offsets[i] * distances[i];
+      return gradient.Normalize();
+   }
+
+   /// Take a single step along a ray                                         
+   ///   @param state - the state of the ray                                  
+   ///   @param distance - the signed distance at the current point           
+   ///   @return true if the ray is done marching                             
+   TEMPLATE()
+   bool TSphereTracer<T>::Advance(StateType& state, ScalarType distance) const noexcept {
+      // Rays that begin inside a volume march towards its boundary     
+      const bool first = state.mIterations++ == 0;
+      if (first)
+         state.mSign = distance < 0 ? -1 : 1;
+      const ScalarType radius = state.mSign * distance / mLipschitz;
+
+      // An over-relaxed step is only safe, if the unbounding spheres   
+      // before and after it overlap - otherwise the surface might have 
+      // been stepped over, so take the safe step instead, and stop     
+      // relaxing                                                       
+      if (state.mRelaxation > 1 and not first
+      and radius + state.mPreviousRadius < state.mDistance - state.mPreviousDistance) {
+         state.mDistance = state.mPreviousDistance
+            + ::std::min(state.mPreviousRadius, mMaxStep);
+         state.mRelaxation = 1;
+         return state.mIterations >= mMaxSteps;
+      }
+
+      if (radius < mEpsilon) {
+         state.mHit = true;
+         return true;
+      }
+
+      state.mPreviousDistance = state.mDistance;
+      state.mPreviousRadius = radius;
+      state.mDistance += ::std::min(radius * state.mRelaxation, mMaxStep);
+      return state.mDistance > mMaxDistance or state.mIterations >= mMaxSteps;
+   }
+
+   /// Trace a packet of rays with a batched distance function, evaluating    
+   /// only the rays that are still marching on each iteration                
+   ///   @param rays - the rays                                               
+   ///   @param count - number of rays, at most Packet                        
+   ///   @param sdf - the batched distance function                           
+   ///   @param hits - [out] the results, one per ray                         
+   TEMPLATE() template<class F>
+   void TSphereTracer<T>::TracePacket(const RayType* rays, Count count, F& sdf, HitType* hits) const {
+      LANGULUS_ASSUME(DevAssumes, count <= Packet, "Packet too large");
+      StateType states[Packet];
+      Offset active[Packet];
+      for (Offset i = 0; i < count; ++i) {
+         states[i].mRelaxation = mRelaxation;
+         active[i] = i;
+      }
+
+      StreamType points;
+      points.Reserve(Packet * 4);
+      ScalarType distances[Packet * 4];
+
+      // March, compacting the finished rays away                       
+      Count marching = count;
+      while (marching) {
+         points.Resize(marching);
+         for (Offset a = 0; a < marching; ++a) {
+            const Offset i = active[a];
+            points.Set(a, rays[i].Point(states[i].mDistance));
+         }
+         sdf(points, distances);
+
+         Count remaining = 0;
+         for (Offset a = 0; a < marching; ++a) {
+            if (not Advance(states[active[a]], distances[a]))
+               active[remaining++] = active[a];
+         }
+         marching = remaining;
+      }
+
+      // Sample all normals at once                                     
+      const auto offsets = GetOffsets(mNormalOffset);
+      Count hitCount = 0;
+      for (Offset i = 0; i < count; ++i) {
+         hits[i] = {};
+         hits[i].mIterations = states[i].mIterations;
+         hits[i].mPoint = rays[i].Point(states[i].mDistance);
+         if (states[i].mHit)
+            active[hitCount++] = i;
+      }
+      if (not hitCount)
+         return;
+
+      points.Resize(hitCount * offsets.size());
+      for (Offset a = 0; a < hitCount; ++a) {
+         for (Offset k = 0; k < offsets.size(); ++k)
+            points.Set(a * offsets.size() + k, hits[active[a]].mPoint + offsets[k]);
+      }
+      sdf(points, distances);
+
+      for (Offset a = 0; a < hitCount; ++a) {
+         auto& hit = hits[active[a]];
+         T gradient {};
+         for (Offset k = 0; k < offsets.size(); ++k)
+            gradient += offsets[k] * distances[a * offsets.size() + k];
+         hit.mDistance = states[active[a]].mDistance;
+         hit.mNormal = gradient.Normalize();
+      }
+   }
+
+   /// Get the sample offsets for the gradient - the vertices of a            
+   /// tetrahedron in 3D, or the corners of a square in 2D; in both cases     
+   /// they sum to zero, and their weighted sum is proportional to the        
+   /// gradient                                                               
+   ///   @param offset - the distance along each axis                         
+   ///   @return the offsets                                                  
+   TEMPLATE() LANGULUS(INLINED)
+   auto TSphereTracer<T>::GetOffsets(ScalarType offset) noexcept -> ::std::array<T, 4> {
+      static_assert(MemberCount == 2 or MemberCount == 3,
+         "Sphere tracing is only supported in 2D and 3D");
+      const ScalarType h = offset;
+      if constexpr (MemberCount == 3)
+         return {T {h, -h, -h}, T {-h, -h, h}, T {-h, h, -h}, T {h, h, h}};
+      else
+         return {T {h, -h}, T {-h, -h}, T {-h, h}, T {h, h}};
+   }
+
+} // namespace Langulus::Math
+
+#undef TEMPLATE
\ No newline at end of file
@@ -0,0 +1,32 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "TSDFTape.hpp"
+
+
+namespace Langulus::Math
+{
+
+   ///                                                                        
+   ///   Narrow-band voxelization                                             
+   ///                                                                        
+   ///   Samples a compiled SDF on a regular grid of voxel centers, with      
+   /// distances clamped to [-band, band]. The grid is walked as an octree -  
+   /// each cell is first bounded with interval arithmetic, and if all of it  
+   /// is further than the band from the surface, it is filled without        
+   /// evaluating a single point. Only leaf cells near the surface are        
+   /// evaluated densely, so the cost grows with the surface area instead of  
+   /// the volume. Top level chunks are distributed between threads.          
+   ///   The output is laid out as out[x + y * N + z * N * N]                 
+   ///                                                                        
+   template<CT::Real T>
+   Count Voxelize(const TSDFTape<T>&, const TRange<TVector<T, 3>>&, Count, T, T*, Count threads = 0);
+   template<CT::Real T> NOD()
+   auto Voxelize(const TSDFTape<T>&, const TRange<TVector<T, 3>>&, Count, T, Count threads = 0) -> TMany<T>;
+
+} // namespace Langulus::Math
\ No newline at end of file
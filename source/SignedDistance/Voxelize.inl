@@ -0,0 +1,232 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Voxelize.hpp"
+#include "TSDFTape.inl"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+
+namespace Langulus::Math
+{
+   namespace Inner
+   {
+
+      /// A block of voxels in index space                                    
+      struct VoxelCell {
+         Offset mMin[3];
+         Count mSize[3];
+      };
+
+      /// Per-thread voxelization state                                       
+      /// Prepared on the calling thread, so that workers never allocate      
+      template<CT::Real T>
+      struct Voxelizer {
+         // Cells with at most this many voxels per side are evaluated  
+         // densely instead of being subdivided further                 
+         static constexpr Count Leaf = 8;
+
+         const TSDFTape<T>& mTape;
+         TVector<T, 3> mOrigin;
+         TVector<T, 3> mStep;
+         Count mResolution;
+         T mBand;
+         T* mOut;
+
+         TVectorStream<T, 3> mPoints;
+         TMany<T> mDistances;
+         TMany<T> mScratch;
+         TMany<Interval<T>> mIntervals;
+         Count mEvaluated = 0;
+
+         /// Reserve everything a leaf cell needs                             
+         void Prepare() {
+            mPoints.Reserve(Leaf * Leaf * Leaf);
+            mDistances.template Reserve<true>(Leaf * Leaf * Leaf);
+            mTape.PrepareScratch(mScratch);
+            mTape.PrepareScratch(mIntervals);
+         }
+
+         /// Get the center of a voxel along an axis                          
+         T Center(Offset axis, Offset index) const noexcept {
+            return mOrigin[axis] + (static_cast<T>(index) + T {0.5}) * mStep[axis];
+         }
+
+         /// Write the same distance to all voxels of a cell                  
+         void Fill(const VoxelCell& cell, T value) const noexcept {
+            for (Offset z = cell.mMin[2]; z < cell.mMin[2] + cell.mSize[2]; ++z)
+            for (Offset y = cell.mMin[1]; y < cell.mMin[1] + cell.mSize[1]; ++y) {
+               T* row = mOut + (z * mResolution + y) * mResolution + cell.mMin[0];
+               for (Offset x = 0; x < cell.mSize[0]; ++x)
+                  row[x] = value;
+            }
+         }
+
+         /// Evaluate all voxels of a cell                                    
+         void Evaluate(const VoxelCell& cell) {
+            const Count count = cell.mSize[0] * cell.mSize[1] * cell.mSize[2];
+            mPoints.Resize(count);
+            Offset i = 0;
+            for (Offset z = 0; z < cell.mSize[2]; ++z)
+            for (Offset y = 0; y < cell.mSize[1]; ++y)
+            for (Offset x = 0; x < cell.mSize[0]; ++x) {
+               mPoints.Set(i++, TVector<T, 3> {
+                  Center(0, cell.mMin[0] + x),
+                  Center(1, cell.mMin[1] + y),
+                  Center(2, cell.mMin[2] + z)
+               });
+            }
+
+            mTape.Evaluate(mPoints, mDistances.GetRaw(), mScratch);
+            mEvaluated += count;
+
+            i = 0;
+            for (Offset z = cell.mMin[2]; z < cell.mMin[2] + cell.mSize[2]; ++z)
+            for (Offset y = cell.mMin[1]; y < cell.mMin[1] + cell.mSize[1]; ++y) {
+               T* row = mOut + (z * mResolution + y) * mResolution + cell.mMin[0];
+               for (Offset x = 0; x < cell.mSize[0]; ++x)
+                  row[x] = ::std::clamp(mDistances[i++], -mBand, mBand);
+            }
+         }
+
+         /// Prune, subdivide, or evaluate a cell                             
+         void Visit(const VoxelCell& cell) {
+            // Bound only the voxel centers, not the whole cell volume  
+            TRange<TVector<T, 3>> box;
+            for (Offset c = 0; c < 3; ++c) {
+               box.mMin[c] = Center(c, cell.mMin[c]);
+               box.mMax[c] = Center(c, cell.mMin[c] + cell.mSize[c] - 1);
+            }
+
+            const auto bounds = mTape.Evaluate(box, mIntervals);
+            if (bounds.mMin[0] >= mBand)
+               return Fill(cell, mBand);
+            if (bounds.mMax[0] <= -mBand)
+               return Fill(cell, -mBand);
+
+            if (cell.mSize[0] <= Leaf and cell.mSize[1] <= Leaf and cell.mSize[2] <= Leaf)
+               return Evaluate(cell);
+
+            // Split every axis that is larger than a leaf in half      
+            Count halves[3][2];
+            Count parts[3];
+            for (Offset c = 0; c < 3; ++c) {
+               if (cell.mSize[c] > Leaf) {
+                  halves[c][0] = cell.mSize[c] / 2;
+                  halves[c][1] = cell.mSize[c] - halves[c][0];
+                  parts[c] = 2;
+               }
+               else {
+                  halves[c][0] = cell.mSize[c];
+                  parts[c] = 1;
+               }
+            }
+
+            for (Offset z = 0; z < parts[2]; ++z)
+            for (Offset y = 0; y < parts[1]; ++y)
+            for (Offset x = 0; x < parts[0]; ++x) {
+               const Offset part[3] {x, y, z};
+               VoxelCell child;
+               for (Offset c = 0; c < 3; ++c) {
+                  child.mMin[c] = cell.mMin[c] + (part[c] ? halves[c][0] : 0);
+                  child.mSize[c] = halves[c][part[c]];
+               }
+               Visit(child);
+            }
+         }
+      };
+
+   } // namespace Langulus::Math::Inner
+
+   /// Sample an SDF on a grid, skipping regions far from the surface         
+   ///   @param tape - the compiled SDF                                       
+   ///   @param bounds - the volume covered by the grid                       
+   ///   @param resolution - number of voxels along each axis                 
+   ///   @param band - distances are clamped to [-band, band]; the narrower   
+   ///      the band, the more of the grid gets pruned                        
+   ///   @param out - [out] the distances, must have room for                 
+   ///      resolution^3 elements                                             
+   ///   @param threads - number of threads to use, zero to use all cores     
+   ///   @return the number of voxels that were actually evaluated            
+   template<CT::Real T>
+   Count Voxelize(const TSDFTape<T>& tape, const TRange<TVector<T, 3>>& bounds, Count resolution, T band, T* out, Count threads) {
+      LANGULUS_ASSUME(UserAssumes, band > 0, "Voxelization band must be positive");
+      if (not resolution)
+         return 0;
+
+      // Chunks are big enough to be pruned as a whole, and small       
+      // enough to balance the work between threads                     
+      constexpr Count Chunk = Inner::Voxelizer<T>::Leaf * 8;
+      const Count chunksPerAxis = (resolution + Chunk - 1) / Chunk;
+      const Count chunks = chunksPerAxis * chunksPerAxis * chunksPerAxis;
+      if (not threads)
+         threads = ::std::max(Count {1}, static_cast<Count>(::std::thread::hardware_concurrency()));
+      threads = ::std::min(threads, chunks);
+
+      TVector<T, 3> step;
+      for (Offset c = 0; c < 3; ++c)
+         step[c] = (bounds.mMax[c] - bounds.mMin[c]) / static_cast<T>(resolution);
+
+      ::std::vector<Inner::Voxelizer<T>> voxelizers;
+      voxelizers.reserve(threads);
+      for (Offset t = 0; t < threads; ++t) {
+         voxelizers.push_back({tape, bounds.mMin, step, resolution, band, out});
+         voxelizers.back().Prepare();
+      }
+
+      const auto work = [&](Offset thread) {
+         auto& voxelizer = voxelizers[thread];
+         for (Offset chunk = thread; chunk < chunks; chunk += threads) {
+            const Offset index[3] {
+               chunk % chunksPerAxis,
+               chunk / chunksPerAxis % chunksPerAxis,
+               chunk / (chunksPerAxis * chunksPerAxis)
+            };
+
+            Inner::VoxelCell cell;
+            for (Offset c = 0; c < 3; ++c) {
+               cell.mMin[c] = index[c] * Chunk;
+               cell.mSize[c] = ::std::min(Chunk, resolution - cell.mMin[c]);
+            }
+            voxelizer.Visit(cell);
+         }
+      };
+
+      ::std::vector<::std::thread> workers;
+      workers.reserve(threads - 1);
+      for (Offset t = 1; t < threads; ++t)
+         workers.emplace_back(work, t);
+      work(0);
+      for (auto& worker : workers)
+         worker.join();
+
+      Count total = 0;
+      for (const auto& voxelizer : voxelizers)
+         total += voxelizer.mEvaluated;
+      return total;
+   }
+
+   /// Sample an SDF on a grid, skipping regions far from the surface         
+   ///   @param tape - the compiled SDF                                       
+   ///   @param bounds - the volume covered by the grid                       
+   ///   @param resolution - number of voxels along each axis                 
+   ///   @param band - distances are clamped to [-band, band]                 
+   ///   @param threads - number of threads to use, zero to use all cores     
+   ///   @return the distances, laid out as [x + y * N + z * N * N]           
+   template<CT::Real T>
+   auto Voxelize(const TSDFTape<T>& tape, const TRange<TVector<T, 3>>& bounds, Count resolution, T band, Count threads) -> TMany<T> {
+      TMany<T> result;
+      if (resolution) {
+         result.template Reserve<true>(resolution * resolution * resolution);
+         Voxelize(tape, bounds, resolution, band, result.GetRaw(), threads);
+      }
+      return result;
+   }
+
+} // namespace Langulus::Math
\ No newline at end of file
@@ -0,0 +1,137 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "../Ranges/TRange.hpp"
+#include "../Primitives/TRay.hpp"
+#include "../Primitives/TFrustum.hpp"
+#include <limits>
+
+
+namespace Langulus::Math
+{
+
+   template<CT::Vector T>
+   struct TBVH;
+
+   using BVH2 = TBVH<Vec2>;
+   using BVH3 = TBVH<Vec3>;
+
+   using BVH = BVH3;
+
+
+   ///                                                                        
+   ///   Bounding volume hierarchy                                            
+   ///                                                                        
+   /// A binary tree of axis-aligned boxes over an arbitrary set of           
+   /// primitives, which are known to the hierarchy only by their indices     
+   /// and TRange bounds. Built top-down, by binning primitive centroids and  
+   /// picking splits with the surface area heuristic (SAH).                  
+   /// Nodes live in a single flat array in depth-first order - the left      
+   /// child of an inner node always directly follows it, so traversal        
+   /// mostly walks forward in memory. Primitive bounds are kept in leaf      
+   /// order right next to the nodes for the same reason.                     
+   /// Queries only test bounds - the exact primitive tests are left to       
+   /// callbacks, so the same hierarchy works for triangles, spheres,         
+   /// instances, etc.                                                        
+   ///                                                                        
+   template<CT::Vector T>
+   struct TBVH {
+      using PointType   = T;
+      using ScalarType  = TypeOf<T>;
+      using RangeType   = TRange<T>;
+      using RayType     = TRay<T>;
+      using FrustumType = TFrustum<T>;
+      using IndexType   = ::std::uint32_t;
+
+      static constexpr Count MemberCount = T::MemberCount;
+      // Number of bins per axis, when searching for the best split     
+      static constexpr Count BinCount = 16;
+      // Ranges with this many primitives, or fewer, can become leaves  
+      static constexpr Count MaxLeafSize = 4;
+      // Past this depth, ranges are split in half, regardless of SAH,  
+      // which keeps the tree shallow enough for fixed-size stacks      
+      static constexpr Count MaxSAHDepth = 32;
+      static constexpr Count MaxDepth = MaxSAHDepth + 32;
+      // Smaller ranges/trees are never built/refit in parallel         
+      static constexpr Count ParallelThreshold = 4096;
+      // Marks an invalid primitive index in a Hit                      
+      static constexpr Offset NoIndex = ::std::numeric_limits<Offset>::max();
+
+      ///                                                                     
+      ///   A flattened node                                                  
+      ///                                                                     
+      struct Node {
+         RangeType mBounds;
+         // Inner nodes: index of the right child (left one is next)    
+         // Leaves: index of the first primitive in leaf order          
+         IndexType mOffset;
+         // Number of primitives in a leaf, zero for inner nodes        
+         IndexType mCount;
+
+         NOD() constexpr bool IsLeaf() const noexcept { return mCount != 0; }
+      };
+
+      ///                                                                     
+      ///   Result of ray and nearest-point queries                           
+      ///                                                                     
+      struct Hit {
+         Offset mIndex = NoIndex;
+         ScalarType mDistance = ::std::numeric_limits<ScalarType>::infinity();
+
+         NOD() constexpr explicit operator bool() const noexcept { return mIndex != NoIndex; }
+      };
+
+   protected:
+      TMany<Node> mNodes;
+      // Primitive indices, grouped by leaf                             
+      TMany<IndexType> mIndices;
+      // Primitive bounds, in the same order as mIndices                
+      TMany<RangeType> mBounds;
+
+      struct Builder;
+
+      NOD() static RangeType Empty() noexcept;
+      static void Grow(RangeType&, const RangeType&) noexcept;
+      NOD() static ScalarType HalfArea(const RangeType&) noexcept;
+      NOD() static bool Overlaps(const RangeType&, const RangeType&) noexcept;
+      NOD() static bool Slab(const RangeType&, const PointType&, const PointType&, ScalarType, ScalarType&) noexcept;
+      NOD() static ScalarType DistanceSquared(const RangeType&, const PointType&) noexcept;
+      NOD() static Count GetThreadCount(Count) noexcept;
+
+      void RefitNodes(Offset, Offset) noexcept;
+
+   public:
+      TBVH() = default;
+      TBVH(const RangeType*, Count, Count threads = 0);
+      TBVH(const TMany<RangeType>&, Count threads = 0);
+
+      void Build(const RangeType*, Count, Count threads = 0);
+      void Build(const TMany<RangeType>&, Count threads = 0);
+      void Refit(const RangeType*, Count threads = 0);
+      void Refit(const TMany<RangeType>&, Count threads = 0);
+      void Clear() noexcept;
+
+      NOD() bool IsEmpty() const noexcept;
+      NOD() Count GetNodeCount() const noexcept;
+      NOD() Count GetPrimitiveCount() const noexcept;
+      NOD() auto GetNodes() const noexcept -> const Node*;
+      NOD() auto GetIndices() const noexcept -> const IndexType*;
+      NOD() auto GetBounds() const noexcept -> RangeType;
+      NOD() Count GetDepth() const noexcept;
+
+      template<class F>
+      NOD() Hit Raycast(const RayType&, F&&, ScalarType = ::std::numeric_limits<ScalarType>::infinity()) const;
+      template<class F>
+      void Overlap(const RangeType&, F&&) const;
+      template<class F>
+      void Cull(const FrustumType&, F&&) const;
+      template<class F>
+      NOD() Hit Nearest(const PointType&, F&&, ScalarType = ::std::numeric_limits<ScalarType>::infinity()) const;
+   };
+
+} // namespace Langulus::Math
\ No newline at end of file
@@ -0,0 +1,722 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "TBVH.hpp"
+#include "../Ranges/TRange.inl"
+#include "../Primitives/TFrustum.inl"
+#include <algorithm>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#define TEMPLATE() template<CT::Vector T>
+
+
+namespace Langulus::Math
+{
+
+   ///                                                                        
+   ///   Top-down SAH builder                                                 
+   ///                                                                        
+   /// Each range of primitive indices is partitioned in place, so parallel   
+   /// subtrees never touch the same indices. Every subtree is written into   
+   /// its own node array, which is spliced into the parent's afterwards.     
+   /// Builder threads create and release these arrays themselves, so they    
+   /// are std::vector scratch - only the final nodes are copied into the     
+   /// hierarchy's TMany, on the calling thread                               
+   ///                                                                        
+   TEMPLATE()
+   struct TBVH<T>::Builder {
+      const RangeType* mBounds;
+      const PointType* mCentroids;
+      IndexType* mIndices;
+
+      void Build(Offset begin, Offset end, ::std::vector<Node>& out, Count threads, Count depth) const {
+         const Offset self = out.size();
+         out.emplace_back();
+
+         RangeType bounds = Empty();
+         PointType cmin, cmax;
+         for (Offset c = 0; c < MemberCount; ++c) {
+            cmin[c] =  ::std::numeric_limits<ScalarType>::max();
+            cmax[c] = -::std::numeric_limits<ScalarType>::max();
+         }
+
+         for (Offset i = begin; i < end; ++i) {
+            Grow(bounds, mBounds[mIndices[i]]);
+            const auto& centroid = mCentroids[mIndices[i]];
+            for (Offset c = 0; c < MemberCount; ++c) {
+               cmin[c] = ::std::min(cmin[c], centroid[c]);
+               cmax[c] = ::std::max(cmax[c], centroid[c]);
+            }
+         }
+
+         const Count count = end - begin;
+         out[self].mBounds = bounds;
+         out[self].mOffset = static_cast<IndexType>(begin);
+         out[self].mCount  = static_cast<IndexType>(count);
+         if (count == 1)
+            return;
+
+         // Find the cheapest split among all axes and bin boundaries   
+         ScalarType bestCost = ::std::numeric_limits<ScalarType>::max();
+         Offset bestAxis = MemberCount;
+         Offset bestBin = 0;
+
+         if (depth < MaxSAHDepth) {
+            for (Offset axis = 0; axis < MemberCount; ++axis) {
+               const ScalarType extent = cmax[axis] - cmin[axis];
+               if (extent <= 0)
+                  continue;
+
+               Count binCounts[BinCount] {};
+               RangeType binBounds[BinCount];
+               for (auto& b : binBounds)
+                  b = Empty();
+
+               const ScalarType scale = ScalarType(BinCount) / extent;
+               for (Offset i = begin; i < end; ++i) {
+                  const auto index = mIndices[i];
+                  const Offset bin = ::std::min(BinCount - 1, static_cast<Count>(
+                     (mCentroids[index][axis] - cmin[axis]) * scale));
+                  ++binCounts[bin];
+                  Grow(binBounds[bin], mBounds[index]);
+               }
+
+               // Sweep from the right, then from the left              
+               ScalarType rightArea[BinCount];
+               Count rightCount[BinCount];
+               RangeType accumulated = Empty();
+               Count accumulatedCount = 0;
+               for (Offset b = BinCount - 1; b > 0; --b) {
+                  Grow(accumulated, binBounds[b]);
+                  accumulatedCount += binCounts[b];
+                  rightArea[b] = HalfArea(accumulated);
+                  rightCount[b] = accumulatedCount;
+               }
+
+               accumulated = Empty();
+               accumulatedCount = 0;
+               for (Offset b = 1; b < BinCount; ++b) {
+                  Grow(accumulated, binBounds[b - 1]);
+                  accumulatedCount += binCounts[b - 1];
+                  if (not accumulatedCount or not rightCount[b])
+                     continue;
+
+                  const ScalarType cost = accumulatedCount * HalfArea(accumulated)
+                                        + rightCount[b] * rightArea[b];
+                  if (cost < bestCost) {
+                     bestCost = cost;
+                     bestAxis = axis;
+                     bestBin = b;
+                  }
+               }
+            }
+         }
+
+         Offset middle;
+         if (bestAxis == MemberCount) {
+            // Coincident centroids, or too deep - split in half        
+            if (count <= MaxLeafSize)
+               return;
+            middle = begin + count / 2;
+         }
+         else {
+            // Splitting costs a traversal step, plus the children      
+            const ScalarType area = HalfArea(bounds);
+            if (count <= MaxLeafSize and count * area <= bestCost + area)
+               return;
+
+            const ScalarType scale = ScalarType(BinCount) / (cmax[bestAxis] - cmin[bestAxis]);
+            const ScalarType low = cmin[bestAxis];
+            middle = ::std::partition(mIndices + begin, mIndices + end,
+               [&](IndexType index) {
+                  const Offset bin = ::std::min(BinCount - 1, static_cast<Count>(
+                     (mCentroids[index][bestAxis] - low) * scale));
+                  return bin < bestBin;
+               }
+            ) - mIndices;
+         }
+
+         out[self].mCount = 0;
+
+         if (threads > 1 and count >= ParallelThreshold) {
+            // Build the right subtree on another thread                
+            // N primitives never need more than 2N - 1 nodes           
+            ::std::vector<Node> right;
+            right.reserve((end - middle) * 2 - 1);
+            ::std::thread worker {[&] {
+               Build(middle, end, right, threads - threads / 2, depth + 1);
+            }};
+            Build(begin, middle, out, threads / 2, depth + 1);
+            worker.join();
+
+            const auto base = static_cast<IndexType>(out.size());
+            out[self].mOffset = base;
+            for (auto node : right) {
+               if (not node.IsLeaf())
+                  node.mOffset += base;
+               out.push_back(node);
+            }
+         }
+         else {
+            Build(begin, middle, out, 1, depth + 1);
+            out[self].mOffset = static_cast<IndexType>(out.size());
+            Build(middle, end, out, 1, depth + 1);
+         }
+      }
+   };
+
+   /// Build a hierarchy from primitive bounds                                
+   ///   @param bounds - the primitive bounds                                 
+   ///   @param count - number of primitives                                  
+   ///   @param threads - number of threads to use, zero to use all cores     
+   TEMPLATE() LANGULUS(INLINED)
+   TBVH<T>::TBVH(const RangeType* bounds, Count count, Count threads) {
+      Build(bounds, count, threads);
+   }
+
+   /// Build a hierarchy from primitive bounds                                
+   ///   @param bounds - the primitive bounds                                 
+   ///   @param threads - number of threads to use, zero to use all cores     
+   TEMPLATE() LANGULUS(INLINED)
+   TBVH<T>::TBVH(const TMany<RangeType>& bounds, Count threads) {
+      Build(bounds, threads);
+   }
+
+   /// Rebuild the hierarchy from scratch                                     
+   ///   @param bounds - the primitive bounds; primitive N is bounds[N]       
+   ///   @param count - number of primitives                                  
+   ///   @param threads - number of threads to use, zero to use all cores     
+   TEMPLATE()
+   void TBVH<T>::Build(const RangeType* bounds, Count count, Count threads) {
+      Clear();
+      if (not count)
+         return;
+
+      LANGULUS_ASSUME(UserAssumes,
+         count <= ::std::numeric_limits<IndexType>::max(),
+         "Too many primitives for a BVH");
+
+      TMany<PointType> centroids;
+      centroids.template Reserve<true>(count);
+      for (Offset i = 0; i < count; ++i)
+         centroids[i] = (bounds[i].mMin + bounds[i].mMax) * ScalarType(0.5);
+
+      mIndices.template Reserve<true>(count);
+      ::std::iota(mIndices.GetRaw(), mIndices.GetRaw() + count, IndexType {0});
+      ::std::vector<Node> nodes;
+      nodes.reserve(count * 2 - 1);
+      const Builder builder {bounds, centroids.GetRaw(), mIndices.GetRaw()};
+      builder.Build(0, count, nodes, GetThreadCount(threads), 0);
+
+      mNodes.template Reserve<true>(nodes.size());
+      ::std::copy(nodes.begin(), nodes.end(), mNodes.GetRaw());
+
+      mBounds.template Reserve<true>(count);
+      for (Offset i = 0; i < count; ++i)
+         mBounds[i] = bounds[mIndices[i]];
+   }
+
+   /// Rebuild the hierarchy from scratch                                     
+   ///   @param bounds - the primitive bounds                                 
+   ///   @param threads - number of threads to use, zero to use all cores     
+   TEMPLATE() LANGULUS(INLINED)
+   void TBVH<T>::Build(const TMany<RangeType>& bounds, Count threads) {
+      Build(bounds.GetRaw(), bounds.GetCount(), threads);
+   }
+
+   /// Update the node bounds after primitives have moved, without changing   
+   /// the tree topology. Much faster than rebuilding, but queries degrade    
+   /// as primitives drift away from their original neighbours - rebuild      
+   /// occasionally in highly dynamic scenes                                  
+   ///   @param bounds - the new primitive bounds, in the same order and      
+   ///      count as when the hierarchy was built                             
+   ///   @param threads - number of threads to use, zero to use all cores     
+   TEMPLATE()
+   void TBVH<T>::Refit(const RangeType* bounds, Count threads) {
+      if (IsEmpty())
+         return;
+
+      threads = GetThreadCount(threads);
+      if (threads == 1 or mNodes.GetCount() < ParallelThreshold) {
+         for (Offset i = 0; i < mIndices.GetCount(); ++i)
+            mBounds[i] = bounds[mIndices[i]];
+         RefitNodes(0, mNodes.GetCount());
+         return;
+      }
+
+      // Split the tree into independent subtrees just below the root.  
+      // In depth-first order each subtree is a contiguous node range,  
+      // and every child comes after its parent                         
+      Count splitDepth = 0;
+      while ((Count {1} << splitDepth) < threads * 4)
+         ++splitDepth;
+
+      // The first and past-the-last node of each subtree, in pairs     
+      TMany<Offset> subtrees;
+      subtrees.Reserve(Count {2} << splitDepth);
+      TMany<Offset> top;
+      top.Reserve(Count {1} << splitDepth);
+
+      const auto gather = [&](auto& self, Offset node, Offset end, Count depth) -> void {
+         const auto& n = mNodes[node];
+         if (depth == splitDepth or n.IsLeaf()) {
+            subtrees << node << end;
+            return;
+         }
+
+         top << node;
+         self(self, node + 1, n.mOffset, depth + 1);
+         self(self, n.mOffset, end, depth + 1);
+      };
+      gather(gather, 0, mNodes.GetCount(), 0);
+
+      const Count subtreeCount = subtrees.GetCount() / 2;
+      const auto work = [&](Offset thread) {
+         for (Offset s = thread; s < subtreeCount; s += threads) {
+            const Offset begin = subtrees[s * 2];
+            const Offset end = subtrees[s * 2 + 1];
+            for (Offset n = begin; n < end; ++n) {
+               const auto& node = mNodes[n];
+               for (Offset i = node.mOffset; i < node.mOffset + node.mCount; ++i)
+                  mBounds[i] = bounds[mIndices[i]];
+            }
+            RefitNodes(begin, end);
+         }
+      };
+
+      ::std::vector<::std::thread> workers;
+      workers.reserve(threads - 1);
+      for (Offset t = 1; t < threads; ++t)
+         workers.emplace_back(work, t);
+      work(0);
+      for (auto& worker : workers)
+         worker.join();
+
+      // Finish the nodes above the subtrees, children first            
+      for (Offset n = top.GetCount(); n > 0; --n)
+         RefitNodes(top[n - 1], top[n - 1] + 1);
+   }
+
+   /// Update the node bounds after primitives have moved                     
+   ///   @param bounds - the new primitive bounds                             
+   ///   @param threads - number of threads to use, zero to use all cores     
+   TEMPLATE() LANGULUS(INLINED)
+   void TBVH<T>::Refit(const TMany<RangeType>& bounds, Count threads) {
+      LANGULUS_ASSUME(UserAssumes, bounds.GetCount() == mIndices.GetCount(),
+         "Primitive count changed since the hierarchy was built");
+      Refit(bounds.GetRaw(), threads);
+   }
+
+   /// Recompute the bounds of a range of nodes, in reverse order, so that    
+   /// children are always done before their parents                          
+   ///   @param begin - first node                                            
+   ///   @param end - node past the last one                                  
+   TEMPLATE()
+   void TBVH<T>::RefitNodes(Offset begin, Offset end) noexcept {
+      for (Offset n = end; n > begin; --n) {
+         auto& node = mNodes[n - 1];
+         if (node.IsLeaf()) {
+            node.mBounds = Empty();
+            for (Offset i = node.mOffset; i < node.mOffset + node.mCount; ++i)
+               Grow(node.mBounds, mBounds[i]);
+         }
+         else {
+            node.mBounds = mNodes[n].mBounds;
+            Grow(node.mBounds, mNodes[node.mOffset].mBounds);
+         }
+      }
+   }
+
+   /// Release the hierarchy                                                  
+   TEMPLATE() LANGULUS(INLINED)
+   void TBVH<T>::Clear() noexcept {
+      mNodes.Clear();
+      mIndices.Clear();
+      mBounds.Clear();
+   }
+
+   /// Check if hierarchy contains any primitives                             
+   TEMPLATE() LANGULUS(INLINED)
+   bool TBVH<T>::IsEmpty() const noexcept {
+      return mNodes.IsEmpty();
+   }
+
+   /// Get the number of nodes                                                
+   TEMPLATE() LANGULUS(INLINED)
+   Count TBVH<T>::GetNodeCount() const noexcept {
+      return mNodes.GetCount();
+   }
+
+   /// Get the number of primitives                                           
+   TEMPLATE() LANGULUS(INLINED)
+   Count TBVH<T>::GetPrimitiveCount() const noexcept {
+      return mIndices.GetCount();
+   }
+
+   /// Get the flattened nodes, root first                                    
+   TEMPLATE() LANGULUS(INLINED)
+   auto TBVH<T>::GetNodes() const noexcept -> const Node* {
+      return mNodes.GetRaw();
+   }
+
+   /// Get the primitive indices, in leaf order                               
+   TEMPLATE() LANGULUS(INLINED)
+   auto TBVH<T>::GetIndices() const noexcept -> const IndexType* {
+      return mIndices.GetRaw();
+   }
+
+   /// Get the bounds of all primitives                                       
+   TEMPLATE() LANGULUS(INLINED)
+   auto TBVH<T>::GetBounds() const noexcept -> RangeType {
+      return IsEmpty() ? Empty() : mNodes[0].mBounds;
+   }
+
+   /// Get the depth of the deepest leaf                                      
+   ///   @return the depth, where a lone root is at depth one                 
+   TEMPLATE()
+   Count TBVH<T>::GetDepth() const noexcept {
+      if (IsEmpty())
+         return 0;
+
+      Count deepest = 0;
+      struct Entry { IndexType mNode; Count mDepth; };
+      Entry stack[MaxDepth + 1];
+      Count top = 0;
+      stack[top++] = {0, 1};
+      while (top) {
+         const auto [n, depth] = stack[--top];
+         deepest = ::std::max(deepest, depth);
+         if (not mNodes[n].IsLeaf()) {
+            stack[top++] = {n + 1, depth + 1};
+            stack[top++] = {mNodes[n].mOffset, depth + 1};
+         }
+      }
+      return deepest;
+   }
+
+   /// Cast a ray, finding the closest primitive along it                     
+   /// Nodes are visited front to back, and skipped when they begin past      
+   /// the closest hit so far                                                 
+   ///   @param ray - the ray to cast                                         
+   ///   @param intersect - called as intersect(Offset primitive, ray) for    
+   ///      primitives whose bounds the ray hits; must return the distance    
+   ///      along the ray to the primitive, or a negative number on a miss    
+   ///   @param maxDistance - ignore hits further than this distance          
+   ///   @return the closest hit, invalid if nothing was hit                  
+   TEMPLATE() template<class F>
+   auto TBVH<T>::Raycast(const RayType& ray, F&& intersect, ScalarType maxDistance) const -> Hit {
+      Hit result;
+      result.mDistance = maxDistance;
+
+      if (IsEmpty())
+         return result;
+
+      PointType inverse;
+      for (Offset c = 0; c < MemberCount; ++c)
+         inverse[c] = ScalarType(1) / ray.mNormal[c];
+
+      ScalarType enter;
+      if (not Slab(mNodes[0].mBounds, ray.mOrigin, inverse, maxDistance, enter))
+         return result;
+
+      struct Entry { IndexType mNode; ScalarType mEnter; };
+      Entry stack[MaxDepth + 1];
+      Count top = 0;
+      stack[top++] = {0, enter};
+
+      while (top) {
+         const auto entry = stack[--top];
+         if (entry.mEnter > result.mDistance)
+            continue;
+
+         const auto& node = mNodes[entry.mNode];
+         if (node.IsLeaf()) {
+            for (Offset i = node.mOffset; i < node.mOffset + node.mCount; ++i) {
+               if (not Slab(mBounds[i], ray.mOrigin, inverse, result.mDistance, enter))
+                  continue;
+
+               const ScalarType distance = intersect(Offset {mIndices[i]}, ray);
+               if (distance >= 0 and distance <= result.mDistance) {
+                  result.mIndex = mIndices[i];
+                  result.mDistance = distance;
+               }
+            }
+            continue;
+         }
+
+         // Push the further child first, so the nearer pops first      
+         const IndexType l = entry.mNode + 1;
+         const IndexType r = node.mOffset;
+         ScalarType enterL, enterR;
+         const bool hitL = Slab(mNodes[l].mBounds, ray.mOrigin, inverse, result.mDistance, enterL);
+         const bool hitR = Slab(mNodes[r].mBounds, ray.mOrigin, inverse, result.mDistance, enterR);
+         if (hitL and hitR) {
+            if (enterL <= enterR) {
+               stack[top++] = {r, enterR};
+               stack[top++] = {l, enterL};
+            }
+            else {
+               stack[top++] = {l, enterL};
+               stack[top++] = {r, enterR};
+            }
+         }
+         else if (hitL) stack[top++] = {l, enterL};
+         else if (hitR) stack[top++] = {r, enterR};
+      }
+
+      return result;
+   }
+
+   /// Find all primitives whose bounds overlap a box                         
+   ///   @param box - the box to test                                         
+   ///   @param visit - called as visit(Offset primitive) for each overlap    
+   TEMPLATE() template<class F>
+   void TBVH<T>::Overlap(const RangeType& box, F&& visit) const {
+      if (IsEmpty())
+         return;
+
+      IndexType stack[MaxDepth + 1];
+      Count top = 0;
+      stack[top++] = 0;
+
+      while (top) {
+         const IndexType n = stack[--top];
+         const auto& node = mNodes[n];
+         if (not Overlaps(node.mBounds, box))
+            continue;
+
+         if (node.IsLeaf()) {
+            for (Offset i = node.mOffset; i < node.mOffset + node.mCount; ++i) {
+               if (Overlaps(mBounds[i], box))
+                  visit(Offset {mIndices[i]});
+            }
+         }
+         else {
+            stack[top++] = node.mOffset;
+            stack[top++] = n + 1;
+         }
+      }
+   }
+
+   /// Find all primitives whose bounds intersect a frustum                   
+   /// Planes that a node is fully inside are not tested for its subtree,     
+   /// and subtrees fully inside the frustum are reported without tests       
+   ///   @param frustum - the frustum to test                                 
+   ///   @param visit - called as visit(Offset primitive) for each visible    
+   TEMPLATE() template<class F>
+   void TBVH<T>::Cull(const FrustumType& frustum, F&& visit) const {
+      if (IsEmpty())
+         return;
+
+      using Side = typename FrustumType::Side;
+      using PlaneMask = ::std::uint8_t;
+      constexpr Count PlaneCount = FrustumType::MemberCount * 2;
+      constexpr PlaneMask AllPlanes = (1 << PlaneCount) - 1;
+
+      // Returns false if box is outside, otherwise updates the mask    
+      const auto classify = [&](const RangeType& box, PlaneMask& inside) {
+         for (Offset p = 0; p < PlaneCount; ++p) {
+            const auto bit = PlaneMask(1 << p);
+            if (inside & bit)
+               continue;
+
+            const Side side = frustum.Classify(p, box);
+            if (side == Side::Outside)
+               return false;
+            if (side == Side::Inside)
+               inside |= bit;
+         }
+         return true;
+      };
+
+      struct Entry { IndexType mNode; PlaneMask mInside; };
+      Entry stack[MaxDepth + 1];
+      Count top = 0;
+      stack[top++] = {0, 0};
+
+      while (top) {
+         auto [n, inside] = stack[--top];
+         const auto& node = mNodes[n];
+         if (not classify(node.mBounds, inside))
+            continue;
+
+         if (node.IsLeaf()) {
+            for (Offset i = node.mOffset; i < node.mOffset + node.mCount; ++i) {
+               auto primitiveInside = inside;
+               if (inside == AllPlanes or classify(mBounds[i], primitiveInside))
+                  visit(Offset {mIndices[i]});
+            }
+         }
+         else {
+            stack[top++] = {node.mOffset, inside};
+            stack[top++] = {n + 1, inside};
+         }
+      }
+   }
+
+   /// Find the primitive nearest to a point                                  
+   /// Nodes are visited nearest first, and skipped when they are further     
+   /// than the nearest primitive so far                                      
+   ///   @param point - the point to search around                            
+   ///   @param distance - called as distance(Offset primitive, point) for    
+   ///      primitives that might be nearest; must return the distance from   
+   ///      the point to the primitive                                        
+   ///   @param maxDistance - ignore primitives further than this distance    
+   ///   @return the nearest primitive, invalid if none is within range       
+   TEMPLATE() template<class F>
+   auto TBVH<T>::Nearest(const PointType& point, F&& distance, ScalarType maxDistance) const -> Hit {
+      Hit result;
+      result.mDistance = maxDistance;
+      if (IsEmpty())
+         return result;
+
+      const auto limit = [&] {
+         return result.mDistance * result.mDistance;
+      };
+
+      struct Entry { IndexType mNode; ScalarType mDistanceSquared; };
+      Entry stack[MaxDepth + 1];
+      Count top = 0;
+      stack[top++] = {0, DistanceSquared(mNodes[0].mBounds, point)};
+
+      while (top) {
+         const auto entry = stack[--top];
+         if (entry.mDistanceSquared > limit())
+            continue;
+
+         const auto& node = mNodes[entry.mNode];
+         if (node.IsLeaf()) {
+            for (Offset i = node.mOffset; i < node.mOffset + node.mCount; ++i) {
+               if (DistanceSquared(mBounds[i], point) > limit())
+                  continue;
+
+               const ScalarType d = distance(Offset {mIndices[i]}, point);
+               if (d <= result.mDistance) {
+                  result.mIndex = mIndices[i];
+                  result.mDistance = d;
+               }
+            }
+            continue;
+         }
+
+         // Push the further child first, so the nearer pops first      
+         const IndexType l = entry.mNode + 1;
+         const IndexType r = node.mOffset;
+         const ScalarType dl = DistanceSquared(mNodes[l].mBounds, point);
+         const ScalarType dr = DistanceSquared(mNodes[r].mBounds, point);
+         if (dl <= dr) {
+            stack[top++] = {r, dr};
+            stack[top++] = {l, dl};
+         }
+         else {
+            stack[top++] = {l, dl};
+            stack[top++] = {r, dr};
+         }
+      }
+
+      return result;
+   }
+
+   /// Get an inverted range, that any Grow() overwrites                      
+   TEMPLATE() LANGULUS(INLINED)
+   auto TBVH<T>::Empty() noexcept -> RangeType {
+      RangeType result;
+      for (Offset c = 0; c < MemberCount; ++c) {
+         result.mMin[c] =  ::std::numeric_limits<ScalarType>::max();
+         result.mMax[c] = -::std::numeric_limits<ScalarType>::max();
+      }
+      return result;
+   }
+
+   /// Grow a range, so that it contains another one                          
+   TEMPLATE() LANGULUS(INLINED)
+   void TBVH<T>::Grow(RangeType& range, const RangeType& other) noexcept {
+      for (Offset c = 0; c < MemberCount; ++c) {
+         range.mMin[c] = ::std::min(range.mMin[c], other.mMin[c]);
+         range.mMax[c] = ::std::max(range.mMax[c], other.mMax[c]);
+      }
+   }
+
+   /// Get the SAH cost measure of a range - half the surface area in 3D,     
+   /// half the perimeter in 2D                                               
+   TEMPLATE() LANGULUS(INLINED)
+   auto TBVH<T>::HalfArea(const RangeType& range) noexcept -> ScalarType {
+      PointType extent;
+      for (Offset c = 0; c < MemberCount; ++c)
+         extent[c] = ::std::max(range.mMax[c] - range.mMin[c], ScalarType {0});
+
+      if constexpr (MemberCount == 2)
+         return extent[0] + extent[1];
+      else {
+         ScalarType area = 0;
+         for (Offset a = 0; a < MemberCount; ++a)
+            for (Offset b = a + 1; b < MemberCount; ++b)
+               area += extent[a] * extent[b];
+         return area;
+      }
+   }
+
+   /// Check if two ranges overlap, touching counts as overlapping            
+   TEMPLATE() LANGULUS(INLINED)
+   bool TBVH<T>::Overlaps(const RangeType& a, const RangeType& b) noexcept {
+      for (Offset c = 0; c < MemberCount; ++c) {
+         if (a.mMin[c] > b.mMax[c] or a.mMax[c] < b.mMin[c])
+            return false;
+      }
+      return true;
+   }
+
+   /// Slab test a ray against a range                                        
+   ///   @param range - the box                                               
+   ///   @param origin - ray origin                                           
+   ///   @param inverse - inverted ray direction                              
+   ///   @param maxDistance - the maximum distance along the ray              
+   ///   @param enter - [out] the distance at which the ray enters the box,   
+   ///      zero if the origin is inside                                      
+   ///   @return true if the ray hits the box closer than maxDistance         
+   TEMPLATE() LANGULUS(INLINED)
+   bool TBVH<T>::Slab(
+      const RangeType& range, const PointType& origin, const PointType& inverse,
+      ScalarType maxDistance, ScalarType& enter
+   ) noexcept {
+      enter = 0;
+      for (Offset c = 0; c < MemberCount; ++c) {
+         const ScalarType a = (range.mMin[c] - origin[c]) * inverse[c];
+         const ScalarType b = (range.mMax[c] - origin[c]) * inverse[c];
+         enter = ::std::max(enter, ::std::min(a, b));
+         maxDistance = ::std::min(maxDistance, ::std::max(a, b));
+      }
+      return enter <= maxDistance;
+   }
+
+   /// Get the squared distance from a point to a range, zero if inside       
+   TEMPLATE() LANGULUS(INLINED)
+   auto TBVH<T>::DistanceSquared(const RangeType& range, const PointType& point) noexcept -> ScalarType {
+      ScalarType result = 0;
+      for (Offset c = 0; c < MemberCount; ++c) {
+         const ScalarType d = ::std::max(::std::max(
+            range.mMin[c] - point[c], point[c] - range.mMax[c]), ScalarType {0});
+         result += d * d;
+      }
+      return result;
+   }
+
+   /// Resolve the number of threads to use                                   
+   ///   @param threads - requested threads, zero to use all cores            
+   TEMPLATE() LANGULUS(INLINED)
+   Count TBVH<T>::GetThreadCount(Count threads) noexcept {
+      if (threads)
+         return threads;
+      return ::std::max(Count {1}, static_cast<Count>(::std::thread::hardware_concurrency()));
+   }
+
+} // namespace Langulus::Math
+
+#undef TEMPLATE
\ No newline at end of file
@@ -14,7 +14,7 @@
 #include "Vectors/TForce.hpp"
 #include "Vectors/TScale.hpp"
 #include "Quaternions/TQuaternion.hpp"
-#include "Randomness/MersenneTwister.hpp"
+#include "Randomness/Philox.hpp"
 #include "Verbs/Move.hpp"
 
 #if 0
@@ -38,6 +38,7 @@ namespace Langulus::Math
       using ScalarType = TypeOf<T>;
       using PointType  = T;
       using MatrixType = TMatrix<ScalarType, T::MemberCount + 1, T::MemberCount + 1>;
+      using AffineType = TMatrix<ScalarType, T::MemberCount + 1, T::MemberCount>;
       using RangeType  = TRange<T>;
       using QuatType   = TQuaternion<ScalarType>;
       using SizeType   = TScale<TVector<ScalarType, T::MemberCount, 1>>;
@@ -135,6 +136,11 @@ namespace Langulus::Math
 
       NOD() auto GetModelTransform(Level) const -> MatrixType;
       NOD() auto GetModelTransform() const -> MatrixType;
+      NOD() auto GetModelTransformAffine(Level) const -> AffineType;
+      NOD() auto GetModelTransformAffine() const -> AffineType;
+
+      static void GetModelTransforms(const TInstance*, MatrixType*, Count);
+      static void GetModelTransforms(const TInstance*, AffineType*, Count);
 
       NOD() auto GetViewTransform(Level) const -> MatrixType;
       NOD() auto GetViewTransform() const -> MatrixType;
@@ -192,6 +192,53 @@ namespace Langulus::Math
       return A::Matrix::From<PointType>(GetAim(), GetPosition(), scale);
    }
 
+   /// Get compact affine model transformation, relative to a given level     
+   /// Same as GetModelTransform, but without the redundant last row, which   
+   /// makes it more suitable for storing in big instance arrays              
+   ///   @param level - the level                                             
+   ///   @return the affine model matrix                                      
+   TEMPLATE()
+   auto TME()::GetModelTransformAffine(Level level) const -> AffineType {
+      const auto factor = Math::Pow(Level::Unit, mLevel - level);
+      const auto translate = GetPosition() * factor;
+      auto scale = GetScale() * factor;
+      if (scale.IsDegenerate())
+         scale = 1;
+      return A::Matrix::FromAffine<PointType>(GetAim(), translate, scale);
+   }
+
+   /// Get compact affine model transformation                                
+   ///   @return the affine model matrix                                      
+   TEMPLATE()
+   auto TME()::GetModelTransformAffine() const -> AffineType {
+      auto scale = GetScale();
+      if (scale.IsDegenerate())
+         scale = 1;
+      return A::Matrix::FromAffine<PointType>(GetAim(), GetPosition(), scale);
+   }
+
+   /// Get the model transformations of an array of instances                 
+   /// Each matrix is composed directly from position, orientation and        
+   /// scale, without any intermediate matrices or multiplications            
+   ///   @param instances - the instances                                     
+   ///   @param out - [out] the model matrices                                
+   ///   @param count - number of instances                                   
+   TEMPLATE()
+   void TME()::GetModelTransforms(const TInstance* instances, MatrixType* out, Count count) {
+      for (Offset i = 0; i < count; ++i)
+         out[i] = instances[i].GetModelTransform();
+   }
+
+   /// Get the compact affine model transformations of an array of instances  
+   ///   @param instances - the instances                                     
+   ///   @param out - [out] the affine model matrices                         
+   ///   @param count - number of instances                                   
+   TEMPLATE()
+   void TME()::GetModelTransforms(const TInstance* instances, AffineType* out, Count count) {
+      for (Offset i = 0; i < count; ++i)
+         out[i] = instances[i].GetModelTransformAffine();
+   }
+
    /// Get view transformation, relative to a given level                     
    ///   @param level - the level                                             
    ///   @return the view matrix                                              
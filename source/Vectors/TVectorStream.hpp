@@ -0,0 +1,197 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "TVector.hpp"
+#include <Anyness/Many.hpp>
+
+#define TEMPLATE()   template<CT::ScalarBased T, Count S>
+#define TME()        TVectorStream<T, S>
+
+
+namespace Langulus::Math
+{
+
+   template<CT::ScalarBased T, Count S>
+   struct TVectorStream;
+
+   using Vec1Stream  = TVectorStream<Real, 1>;
+   using Vec1fStream = TVectorStream<Float, 1>;
+   using Vec1dStream = TVectorStream<Double, 1>;
+   using Vec2Stream  = TVectorStream<Real, 2>;
+   using Vec2fStream = TVectorStream<Float, 2>;
+   using Vec2dStream = TVectorStream<Double, 2>;
+   using Vec3Stream  = TVectorStream<Real, 3>;
+   using Vec3fStream = TVectorStream<Float, 3>;
+   using Vec3dStream = TVectorStream<Double, 3>;
+   using Vec4Stream  = TVectorStream<Real, 4>;
+   using Vec4fStream = TVectorStream<Float, 4>;
+   using Vec4dStream = TVectorStream<Double, 4>;
+
+
+   ///                                                                        
+   ///   Structure-of-arrays vector stream                                    
+   ///                                                                        
+   ///   Stores a batch of TVector<T, S> as S separate lanes - one contiguous 
+   /// array per component. Every lane begins on a cache line boundary and is 
+   /// padded to a whole number of blocks, where a block is exactly one       
+   /// 512-bit register worth of T. This allows all batch operations to load  
+   /// full registers (two AVX2, or one AVX-512) without any shuffling,       
+   /// unlike arrays of packed TVector, which can't be loaded lane-wise.      
+   ///   Padding elements past GetCount() are always kept zeroed.             
+   ///                                                                        
+   TEMPLATE()
+   struct TVectorStream {
+      static_assert(S >= 1, "Can't have a vector stream of zero size");
+      static_assert(CT::POD<T>, "Vector stream elements must be POD");
+
+      static constexpr Count MemberCount = S;
+      static constexpr Count Alignment = 64;
+      static constexpr Count Block = Alignment / sizeof(T);
+      static_assert(Alignment % sizeof(T) == 0,
+         "Type size must evenly divide the lane alignment");
+
+      using ScalarType = T;
+      using VectorType = TVector<T, S>;
+      using LaneType   = TVectorStream<T, 1>;
+      using BlockType  = T[Block];
+
+   protected:
+      template<CT::ScalarBased, Count>
+      friend struct TVectorStream;
+
+      // A single aligned allocation, containing all lanes one after    
+      // another, each lane being mStride elements long                 
+      T* mData {};
+      // Number of vectors in the stream                                
+      Count mCount {};
+      // Number of reserved elements per lane, always multiple of Block 
+      Count mStride {};
+
+   public:
+      ///                                                                     
+      ///   Construction                                                      
+      ///                                                                     
+      constexpr TVectorStream() noexcept = default;
+      TVectorStream(const TVectorStream&);
+      TVectorStream(TVectorStream&&) noexcept;
+      explicit TVectorStream(Count);
+      TVectorStream(Count, const VectorType&);
+      TVectorStream(const VectorType*, Count);
+      TVectorStream(const TMany<VectorType>&);
+      ~TVectorStream();
+
+      TVectorStream& operator = (const TVectorStream&);
+      TVectorStream& operator = (TVectorStream&&) noexcept;
+
+      ///                                                                     
+      ///   Capacity                                                          
+      ///                                                                     
+      void Reserve(Count);
+      void Resize(Count);
+      void Clear() noexcept;
+      void Reset() noexcept;
+
+      NOD() constexpr Count GetCount() const noexcept;
+      NOD() constexpr Count GetReserved() const noexcept;
+      NOD() constexpr Count GetBlockCount() const noexcept;
+      NOD() constexpr bool IsEmpty() const noexcept;
+
+      ///                                                                     
+      ///   Access                                                            
+      ///                                                                     
+      NOD() T*       GetLane(Offset) noexcept;
+      NOD() T const* GetLane(Offset) const noexcept;
+
+      NOD() VectorType Get(Offset) const noexcept;
+      NOD() VectorType operator[] (Offset) const noexcept;
+      void Set(Offset, const VectorType&) noexcept;
+      void Push(const VectorType&);
+
+      ///                                                                     
+      ///   Conversion                                                        
+      ///                                                                     
+      void Load(const VectorType*, Count);
+      void Store(VectorType*) const noexcept;
+      NOD() TMany<VectorType> ToMany() const;
+      NOD() explicit operator TMany<VectorType> () const;
+
+      ///                                                                     
+      ///   Batch operations                                                  
+      ///                                                                     
+      NOD() LaneType Dot(const TVectorStream&) const;
+      NOD() LaneType Dot(const VectorType&) const;
+      NOD() LaneType LengthSquared() const;
+      NOD() LaneType Length() const;
+
+      NOD() TVectorStream Cross(const TVectorStream&) const requires (S == 3);
+      NOD() TVectorStream Cross(const VectorType&) const requires (S == 3);
+      NOD() TVectorStream Normalize() const requires (S > 1);
+
+      NOD() TVectorStream Min(const TVectorStream&) const;
+      NOD() TVectorStream Min(const VectorType&) const;
+      NOD() TVectorStream Max(const TVectorStream&) const;
+      NOD() TVectorStream Max(const VectorType&) const;
+      NOD() TVectorStream Clamp(const VectorType&, const VectorType&) const;
+
+      ///                                                                     
+      ///   Arithmetics                                                       
+      ///                                                                     
+      NOD() TVectorStream operator - () const;
+
+      NOD() TVectorStream operator + (const TVectorStream&) const;
+      NOD() TVectorStream operator + (const VectorType&) const;
+      NOD() TVectorStream operator + (const T&) const;
+
+      NOD() TVectorStream operator - (const TVectorStream&) const;
+      NOD() TVectorStream operator - (const VectorType&) const;
+      NOD() TVectorStream operator - (const T&) const;
+
+      NOD() TVectorStream operator * (const TVectorStream&) const;
+      NOD() TVectorStream operator * (const LaneType&) const requires (S > 1);
+      NOD() TVectorStream operator * (const VectorType&) const;
+      NOD() TVectorStream operator * (const T&) const;
+
+      NOD() TVectorStream operator / (const TVectorStream&) const;
+      NOD() TVectorStream operator / (const VectorType&) const;
+      NOD() TVectorStream operator / (const T&) const;
+
+      TVectorStream& operator += (const TVectorStream&);
+      TVectorStream& operator += (const VectorType&);
+      TVectorStream& operator += (const T&);
+
+      TVectorStream& operator -= (const TVectorStream&);
+      TVectorStream& operator -= (const VectorType&);
+      TVectorStream& operator -= (const T&);
+
+      TVectorStream& operator *= (const TVectorStream&);
+      TVectorStream& operator *= (const LaneType&) requires (S > 1);
+      TVectorStream& operator *= (const VectorType&);
+      TVectorStream& operator *= (const T&);
+
+      TVectorStream& operator /= (const TVectorStream&);
+      TVectorStream& operator /= (const VectorType&);
+      TVectorStream& operator /= (const T&);
+
+   protected:
+      static T* Allocate(Count);
+      static void Deallocate(T*) noexcept;
+      void CheckCompatible(Count) const;
+
+      NOD() static constexpr const BlockType& AsBlock(const T*) noexcept;
+      NOD() static constexpr BlockType& AsBlock(T*) noexcept;
+
+      template<class SIMD_OP, class SCALAR_OP>
+      static void Batch(const T*, const T*, T*, Count, SIMD_OP&&, SCALAR_OP&&);
+      template<class SIMD_OP, class SCALAR_OP>
+      static void Batch(const T*, const T&, T*, Count, SIMD_OP&&, SCALAR_OP&&);
+   };
+
+} // namespace Langulus::Math
+
+#undef TEMPLATE
+#undef TME
\ No newline at end of file
@@ -0,0 +1,741 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "TVectorStream.hpp"
+#include "TVector.inl"
+#include <cstring>
+#include <cmath>
+#include <memory>
+#include <new>
+
+#define TEMPLATE()   template<CT::ScalarBased T, Count S>
+#define TME()        TVectorStream<T, S>
+
+
+namespace Langulus::Math
+{
+
+   /// Copy-construct a stream                                                
+   ///   @param other - the stream to copy                                    
+   TEMPLATE()
+   TME()::TVectorStream(const TVectorStream& other) {
+      if (not other.mCount)
+         return;
+
+      mStride = other.mStride;
+      mData = Allocate(mStride * S);
+      ::std::memcpy(mData, other.mData, sizeof(T) * mStride * S);
+      mCount = other.mCount;
+   }
+
+   /// Move-construct a stream                                                
+   ///   @param other - the stream to move, will be reset                     
+   TEMPLATE() LANGULUS(INLINED)
+   TME()::TVectorStream(TVectorStream&& other) noexcept
+      : mData   {other.mData}
+      , mCount  {other.mCount}
+      , mStride {other.mStride} {
+      other.mData = nullptr;
+      other.mCount = other.mStride = 0;
+   }
+
+   /// Create a stream of zero-initialized vectors                            
+   ///   @param count - number of vectors                                     
+   TEMPLATE() LANGULUS(INLINED)
+   TME()::TVectorStream(Count count) {
+      Resize(count);
+   }
+
+   /// Create a stream, where all vectors are the same                        
+   ///   @param count - number of vectors                                     
+   ///   @param value - the vector to fill with                               
+   TEMPLATE()
+   TME()::TVectorStream(Count count, const VectorType& value) {
+      Resize(count);
+      for (Offset c = 0; c < S; ++c) {
+         const T component = value.all[c];
+         T* lane = GetLane(c);
+         for (Offset i = 0; i < count; ++i)
+            lane[i] = component;
+      }
+   }
+
+   /// Create a stream by deinterleaving an array of vectors                  
+   ///   @param source - the vectors to copy                                  
+   ///   @param count - number of vectors                                     
+   TEMPLATE() LANGULUS(INLINED)
+   TME()::TVectorStream(const VectorType* source, Count count) {
+      Load(source, count);
+   }
+
+   /// Create a stream by deinterleaving a container of vectors               
+   ///   @param source - the vectors to copy                                  
+   TEMPLATE() LANGULUS(INLINED)
+   TME()::TVectorStream(const TMany<VectorType>& source) {
+      Load(source.GetRaw(), source.GetCount());
+   }
+
+   /// Stream destructor                                                      
+   TEMPLATE() LANGULUS(INLINED)
+   TME()::~TVectorStream() {
+      Deallocate(mData);
+   }
+
+   /// Copy-assign a stream                                                   
+   ///   @param other - the stream to copy                                    
+   ///   @return a reference to this stream                                   
+   TEMPLATE() LANGULUS(INLINED)
+   TME()& TME()::operator = (const TVectorStream& other) {
+      if (this != &other)
+         *this = TVectorStream {other};
+      return *this;
+   }
+
+   /// Move-assign a stream                                                   
+   ///   @param other - the stream to move, will be reset                     
+   ///   @return a reference to this stream                                   
+   TEMPLATE() LANGULUS(INLINED)
+   TME()& TME()::operator = (TVectorStream&& other) noexcept {
+      if (this == &other)
+         return *this;
+
+      Deallocate(mData);
+      mData = other.mData;
+      mCount = other.mCount;
+      mStride = other.mStride;
+      other.mData = nullptr;
+      other.mCount = other.mStride = 0;
+      return *this;
+   }
+
+   /// Allocate zeroed, cache-line aligned memory                             
+   ///   @param count - number of elements to allocate                        
+   ///   @return the new memory                                               
+   TEMPLATE() LANGULUS(INLINED)
+   T* TME()::Allocate(Count count) {
+      auto memory = static_cast<T*>(::operator new[](
+         sizeof(T) * count, ::std::align_val_t {Alignment}));
+      ::std::memset(memory, 0, sizeof(T) * count);
+      return memory;
+   }
+
+   /// Free memory, previously allocated via Allocate()                       
+   ///   @param memory - the memory to free, can be nullptr                   
+   TEMPLATE() LANGULUS(INLINED)
+   void TME()::Deallocate(T* memory) noexcept {
+      if (memory)
+         ::operator delete[](memory, ::std::align_val_t {Alignment});
+   }
+
+   /// Make sure another stream can be combined with this one                 
+   ///   @param count - the number of vectors in the other stream             
+   TEMPLATE() LANGULUS(INLINED)
+   void TME()::CheckCompatible(Count count) const {
+      LANGULUS_ASSUME(UserAssumes, count == mCount,
+         "Vector stream size mismatch");
+   }
+
+   /// Reserve memory for a number of vectors, retaining the current ones     
+   ///   @param count - the number of vectors to reserve for                  
+   TEMPLATE()
+   void TME()::Reserve(Count count) {
+      // Round up to whole blocks                                       
+      const Count stride = ((count + Block - 1) / Block) * Block;
+      if (stride <= mStride)
+         return;
+
+      auto data = Allocate(stride * S);
+      if (mCount) {
+         for (Offset c = 0; c < S; ++c)
+            ::std::memcpy(data + c * stride, mData + c * mStride, sizeof(T) * mCount);
+      }
+
+      Deallocate(mData);
+      mData = data;
+      mStride = stride;
+   }
+
+   /// Change the number of vectors. New vectors are zero-initialized         
+   ///   @param count - the new number of vectors                             
+   TEMPLATE()
+   void TME()::Resize(Count count) {
+      Reserve(count);
+      if (count < mCount) {
+         // Keep the padding zeroed                                     
+         for (Offset c = 0; c < S; ++c)
+            ::std::memset(GetLane(c) + count, 0, sizeof(T) * (mCount - count));
+      }
+      mCount = count;
+   }
+
+   /// Clear the stream, but keep the memory                                  
+   TEMPLATE() LANGULUS(INLINED)
+   void TME()::Clear() noexcept {
+      if (mData)
+         ::std::memset(mData, 0, sizeof(T) * mStride * S);
+      mCount = 0;
+   }
+
+   /// Clear the stream and free the memory                                   
+   TEMPLATE() LANGULUS(INLINED)
+   void TME()::Reset() noexcept {
+      Deallocate(mData);
+      mData = nullptr;
+      mCount = mStride = 0;
+   }
+
+   /// Get the number of vectors in the stream                                
+   TEMPLATE() LANGULUS(INLINED)
+   constexpr Count TME()::GetCount() const noexcept {
+      return mCount;
+   }
+
+   /// Get the number of vectors the stream can contain without reallocation  
+   TEMPLATE() LANGULUS(INLINED)
+   constexpr Count TME()::GetReserved() const noexcept {
+      return mStride;
+   }
+
+   /// Get the number of blocks, that cover all the vectors                   
+   TEMPLATE() LANGULUS(INLINED)
+   constexpr Count TME()::GetBlockCount() const noexcept {
+      return (mCount + Block - 1) / Block;
+   }
+
+   /// Check if stream contains no vectors                                    
+   TEMPLATE() LANGULUS(INLINED)
+   constexpr bool TME()::IsEmpty() const noexcept {
+      return mCount == 0;
+   }
+
+   /// Get the lane of a component                                            
+   ///   @param c - the component index, must be less than S                  
+   ///   @return a cache line aligned pointer to GetReserved() elements       
+   TEMPLATE() LANGULUS(INLINED)
+   T* TME()::GetLane(Offset c) noexcept {
+      LANGULUS_ASSUME(DevAssumes, c < S, "Component index out of range");
+      return ::std::assume_aligned<Alignment>(mData + c * mStride);
+   }
+
+   /// Get the lane of a component (const)                                    
+   ///   @param c - the component index, must be less than S                  
+   ///   @return a cache line aligned pointer to GetReserved() elements       
+   TEMPLATE() LANGULUS(INLINED)
+   T const* TME()::GetLane(Offset c) const noexcept {
+      LANGULUS_ASSUME(DevAssumes, c < S, "Component index out of range");
+      return ::std::assume_aligned<Alignment>(mData + c * mStride);
+   }
+
+   /// Gather a vector from all lanes                                         
+   ///   @param i - index of the vector                                       
+   ///   @return the vector                                                   
+   TEMPLATE() LANGULUS(INLINED)
+   auto TME()::Get(Offset i) const noexcept -> VectorType {
+      LANGULUS_ASSUME(DevAssumes, i < mCount, "Index out of range");
+      VectorType result;
+      for (Offset c = 0; c < S; ++c)
+         result.all[c] = mData[c * mStride + i];
+      return result;
+   }
+
+   /// Gather a vector from all lanes                                         
+   ///   @param i - index of the vector                                       
+   ///   @return the vector                                                   
+   TEMPLATE() LANGULUS(INLINED)
+   auto TME()::operator[] (Offset i) const noexcept -> VectorType {
+      return Get(i);
+   }
+
+   /// Scatter a vector to all lanes                                          
+   ///   @param i - index of the vector                                       
+   ///   @param value - the vector to set                                     
+   TEMPLATE() LANGULUS(INLINED)
+   void TME()::Set(Offset i, const VectorType& value) noexcept {
+      LANGULUS_ASSUME(DevAssumes, i < mCount, "Index out of range");
+      for (Offset c = 0; c < S; ++c)
+         mData[c * mStride + i] = value.all[c];
+   }
+
+   /// Append a vector at the end of the stream                               
+   ///   @param value - the vector to push                                    
+   TEMPLATE() LANGULUS(INLINED)
+   void TME()::Push(const VectorType& value) {
+      if (mCount == mStride)
+         Reserve(mStride ? mStride * 2 : Block);
+      ++mCount;
+      Set(mCount - 1, value);
+   }
+
+   /// Deinterleave an array of vectors, replacing the stream contents        
+   ///   @param source - the vectors to copy                                  
+   ///   @param count - number of vectors                                     
+   TEMPLATE()
+   void TME()::Load(const VectorType* source, Count count) {
+      Clear();
+      Resize(count);
+      for (Offset c = 0; c < S; ++c) {
+         T* lane = GetLane(c);
+         for (Offset i = 0; i < count; ++i)
+            lane[i] = source[i].all[c];
+      }
+   }
+
+   /// Interleave the stream into an array of vectors                         
+   ///   @param destination - array of at least GetCount() vectors            
+   TEMPLATE()
+   void TME()::Store(VectorType* destination) const noexcept {
+      for (Offset c = 0; c < S; ++c) {
+         const T* lane = GetLane(c);
+         for (Offset i = 0; i < mCount; ++i)
+            destination[i].all[c] = lane[i];
+      }
+   }
+
+   /// Interleave the stream into a container of vectors                      
+   ///   @return the new container                                            
+   TEMPLATE()
+   auto TME()::ToMany() const -> TMany<VectorType> {
+      TMany<VectorType> result;
+      if (mCount) {
+         result.template Reserve<true>(mCount);
+         Store(result.GetRaw());
+      }
+      return result;
+   }
+
+   /// Interleave the stream into a container of vectors                      
+   ///   @return the new container                                            
+   TEMPLATE() LANGULUS(INLINED)
+   TME()::operator TMany<VectorType> () const {
+      return ToMany();
+   }
+
+   /// Reinterpret an element pointer as a block                              
+   ///   @param ptr - block-aligned pointer inside a lane                     
+   ///   @return a reference to the block                                     
+   TEMPLATE() LANGULUS(INLINED)
+   constexpr auto TME()::AsBlock(const T* ptr) noexcept -> const BlockType& {
+      return *static_cast<const BlockType*>(static_cast<const void*>(ptr));
+   }
+
+   /// Reinterpret an element pointer as a block                              
+   ///   @param ptr - block-aligned pointer inside a lane                     
+   ///   @return a reference to the block                                     
+   TEMPLATE() LANGULUS(INLINED)
+   constexpr auto TME()::AsBlock(T* ptr) noexcept -> BlockType& {
+      return *static_cast<BlockType*>(static_cast<void*>(ptr));
+   }
+
+
+
+   /// Run an operation over two lanes, a register at a time                  
+   /// Full blocks go through SIMD, the remainder goes through the scalar op, 
+   /// so that padding never gets involved (important for integer division)   
+   ///   @param lhs - left lane                                               
+   ///   @param rhs - right lane                                              
+   ///   @param out - output lane (can be same as lhs or rhs)                 
+   ///   @param count - number of elements                                    
+   ///   @param simd - operation on blocks (lhs, rhs, out)                    
+   ///   @param scalar - operation on single elements (lhs, rhs, out)         
+   TEMPLATE() template<class SIMD_OP, class SCALAR_OP> LANGULUS(INLINED)
+   void TME()::Batch(
+      const T* lhs, const T* rhs, T* out, Count count,
+      SIMD_OP&& simd, SCALAR_OP&& scalar
+   ) {
+      const Count full = count - count % Block;
+      for (Offset i = 0; i < full; i += Block)
+         simd(AsBlock(lhs + i), AsBlock(rhs + i), AsBlock(out + i));
+      for (Offset i = full; i < count; ++i)
+         scalar(lhs[i], rhs[i], out[i]);
+   }
+
+   /// Run an operation over a lane and a scalar, a register at a time        
+   ///   @param lhs - left lane                                               
+   ///   @param rhs - the scalar                                              
+   ///   @param out - output lane (can be same as lhs)                        
+   ///   @param count - number of elements                                    
+   ///   @param simd - operation on a block and a scalar (lhs, rhs, out)      
+   ///   @param scalar - operation on single elements (lhs, rhs, out)         
+   TEMPLATE() template<class SIMD_OP, class SCALAR_OP> LANGULUS(INLINED)
+   void TME()::Batch(
+      const T* lhs, const T& rhs, T* out, Count count,
+      SIMD_OP&& simd, SCALAR_OP&& scalar
+   ) {
+      const Count full = count - count % Block;
+      for (Offset i = 0; i < full; i += Block)
+         simd(AsBlock(lhs + i), rhs, AsBlock(out + i));
+      for (Offset i = full; i < count; ++i)
+         scalar(lhs[i], rhs, out[i]);
+   }
+
+
+   ///                                                                        
+   ///   Batch operations                                                     
+   ///                                                                        
+   /// Dot product of each pair of vectors                                    
+   ///   @param rhs - the stream to dot with                                  
+   ///   @return a single lane with the dot products                          
+   TEMPLATE()
+   auto TME()::Dot(const TVectorStream& rhs) const -> LaneType {
+      CheckCompatible(rhs.mCount);
+      LaneType result {mCount};
+      T* out = result.GetLane(0);
+
+      Batch(GetLane(0), rhs.GetLane(0), out, mCount,
+         [](const BlockType& a, const BlockType& b, BlockType& r) {
+            SIMD::Multiply(a, b, r);
+         },
+         [](const T& a, const T& b, T& r) { r = a * b; }
+      );
+
+      BlockType temp;
+      for (Offset c = 1; c < S; ++c) {
+         Batch(GetLane(c), rhs.GetLane(c), out, mCount,
+            [&temp](const BlockType& a, const BlockType& b, BlockType& r) {
+               SIMD::Multiply(a, b, temp);
+               SIMD::Add(r, temp, r);
+            },
+            [](const T& a, const T& b, T& r) { r += a * b; }
+         );
+      }
+      return result;
+   }
+
+   /// Dot product of each vector with a single vector                        
+   ///   @param rhs - the vector to dot with                                  
+   ///   @return a single lane with the dot products                          
+   TEMPLATE()
+   auto TME()::Dot(const VectorType& rhs) const -> LaneType {
+      LaneType result {mCount};
+      T* out = result.GetLane(0);
+
+      Batch(GetLane(0), rhs.all[0], out, mCount,
+         [](const BlockType& a, const T& b, BlockType& r) {
+            SIMD::Multiply(a, b, r);
+         },
+         [](const T& a, const T& b, T& r) { r = a * b; }
+      );
+
+      BlockType temp;
+      for (Offset c = 1; c < S; ++c) {
+         Batch(GetLane(c), rhs.all[c], out, mCount,
+            [&temp](const BlockType& a, const T& b, BlockType& r) {
+               SIMD::Multiply(a, b, temp);
+               SIMD::Add(r, temp, r);
+            },
+            [](const T& a, const T& b, T& r) { r += a * b; }
+         );
+      }
+      return result;
+   }
+
+   /// Squared length of each vector                                          
+   ///   @return a single lane with the squared lengths                       
+   TEMPLATE() LANGULUS(INLINED)
+   auto TME()::LengthSquared() const -> LaneType {
+      return Dot(*this);
+   }
+
+   /// Length of each vector                                                  
+   ///   @return a single lane with the lengths                               
+   TEMPLATE()
+   auto TME()::Length() const -> LaneType {
+      auto result = LengthSquared();
+      T* out = result.GetLane(0);
+      for (Offset i = 0; i < mCount; ++i) {
+         if constexpr (CT::Real<T>)
+            out[i] = ::std::sqrt(out[i]);
+         else
+            out[i] = Math::Sqrt(out[i]);
+      }
+      return result;
+   }
+
+   /// Cross product of each pair of vectors                                  
+   ///   @param rhs - the stream to cross with                                
+   ///   @return the stream of cross products                                 
+   TEMPLATE()
+   auto TME()::Cross(const TVectorStream& rhs) const -> TVectorStream requires (S == 3) {
+      CheckCompatible(rhs.mCount);
+      TVectorStream result {mCount};
+      BlockType temp;
+
+      // result[c] = lhs[c+1] * rhs[c+2] - lhs[c+2] * rhs[c+1]          
+      for (Offset c = 0; c < 3; ++c) {
+         const Offset c1 = (c + 1) % 3;
+         const Offset c2 = (c + 2) % 3;
+         T* out = result.GetLane(c);
+
+         Batch(GetLane(c1), rhs.GetLane(c2), out, mCount,
+            [](const BlockType& a, const BlockType& b, BlockType& r) {
+               SIMD::Multiply(a, b, r);
+            },
+            [](const T& a, const T& b, T& r) { r = a * b; }
+         );
+
+         Batch(GetLane(c2), rhs.GetLane(c1), out, mCount,
+            [&temp](const BlockType& a, const BlockType& b, BlockType& r) {
+               SIMD::Multiply(a, b, temp);
+               SIMD::Subtract(r, temp, r);
+            },
+            [](const T& a, const T& b, T& r) { r -= a * b; }
+         );
+      }
+      return result;
+   }
+
+   /// Cross product of each vector with a single vector                      
+   ///   @param rhs - the vector to cross with                                
+   ///   @return the stream of cross products                                 
+   TEMPLATE()
+   auto TME()::Cross(const VectorType& rhs) const -> TVectorStream requires (S == 3) {
+      TVectorStream result {mCount};
+      BlockType temp;
+
+      for (Offset c = 0; c < 3; ++c) {
+         const Offset c1 = (c + 1) % 3;
+         const Offset c2 = (c + 2) % 3;
+         T* out = result.GetLane(c);
+
+         Batch(GetLane(c1), rhs.all[c2], out, mCount,
+            [](const BlockType& a, const T& b, BlockType& r) {
+               SIMD::Multiply(a, b, r);
+            },
+            [](const T& a, const T& b, T& r) { r = a * b; }
+         );
+
+         Batch(GetLane(c2), rhs.all[c1], out, mCount,
+            [&temp](const BlockType& a, const T& b, BlockType& r) {
+               SIMD::Multiply(a, b, temp);
+               SIMD::Subtract(r, temp, r);
+            },
+            [](const T& a, const T& b, T& r) { r -= a * b; }
+         );
+      }
+      return result;
+   }
+
+   /// Normalize each vector                                                  
+   ///   @attention throws if any of the vectors is degenerate                
+   ///   @return the stream of normalized vectors                             
+   TEMPLATE()
+   auto TME()::Normalize() const -> TVectorStream requires (S > 1) {
+      // Compute reciprocal lengths in place                            
+      auto scale = Length();
+      T* inv = scale.GetLane(0);
+      for (Offset i = 0; i < mCount; ++i) {
+         if (inv[i] == T {})
+            LANGULUS_THROW(Arithmetic, "Degenerate vector");
+      }
+
+      for (Offset i = 0; i < mCount; ++i)
+         inv[i] = T {1} / inv[i];
+      return *this * scale;
+   }
+
+   /// Get the per-component minimum of each pair of vectors                  
+   ///   @param rhs - the other stream                                        
+   ///   @return the stream of minimums                                       
+   TEMPLATE()
+   auto TME()::Min(const TVectorStream& rhs) const -> TVectorStream {
+      CheckCompatible(rhs.mCount);
+      TVectorStream result {mCount};
+      for (Offset c = 0; c < S; ++c) {
+         const T* a = GetLane(c);
+         const T* b = rhs.GetLane(c);
+         T* r = result.GetLane(c);
+         for (Offset i = 0; i < mCount; ++i)
+            r[i] = b[i] < a[i] ? b[i] : a[i];
+      }
+      return result;
+   }
+
+   /// Get the per-component minimum of each vector and a single vector       
+   ///   @param rhs - the limits                                              
+   ///   @return the stream of minimums                                       
+   TEMPLATE()
+   auto TME()::Min(const VectorType& rhs) const -> TVectorStream {
+      TVectorStream result {mCount};
+      for (Offset c = 0; c < S; ++c) {
+         const T* a = GetLane(c);
+         const T b = rhs.all[c];
+         T* r = result.GetLane(c);
+         for (Offset i = 0; i < mCount; ++i)
+            r[i] = b < a[i] ? b : a[i];
+      }
+      return result;
+   }
+
+   /// Get the per-component maximum of each pair of vectors                  
+   ///   @param rhs - the other stream                                        
+   ///   @return the stream of maximums                                       
+   TEMPLATE()
+   auto TME()::Max(const TVectorStream& rhs) const -> TVectorStream {
+      CheckCompatible(rhs.mCount);
+      TVectorStream result {mCount};
+      for (Offset c = 0; c < S; ++c) {
+         const T* a = GetLane(c);
+         const T* b = rhs.GetLane(c);
+         T* r = result.GetLane(c);
+         for (Offset i = 0; i < mCount; ++i)
+            r[i] = a[i] < b[i] ? b[i] : a[i];
+      }
+      return result;
+   }
+
+   /// Get the per-component maximum of each vector and a single vector       
+   ///   @param rhs - the limits                                              
+   ///   @return the stream of maximums                                       
+   TEMPLATE()
+   auto TME()::Max(const VectorType& rhs) const -> TVectorStream {
+      TVectorStream result {mCount};
+      for (Offset c = 0; c < S; ++c) {
+         const T* a = GetLane(c);
+         const T b = rhs.all[c];
+         T* r = result.GetLane(c);
+         for (Offset i = 0; i < mCount; ++i)
+            r[i] = a[i] < b ? b : a[i];
+      }
+      return result;
+   }
+
+   /// Clamp each vector between a minimum and maximum                        
+   ///   @param min - lower limit                                             
+   ///   @param max - higher limit                                            
+   ///   @return the stream of clamped vectors                                
+   TEMPLATE()
+   auto TME()::Clamp(const VectorType& min, const VectorType& max) const -> TVectorStream {
+      TVectorStream result {mCount};
+      for (Offset c = 0; c < S; ++c) {
+         const T* a = GetLane(c);
+         const T lo = min.all[c];
+         const T hi = max.all[c];
+         T* r = result.GetLane(c);
+         for (Offset i = 0; i < mCount; ++i) {
+            const T clamped = a[i] < lo ? lo : a[i];
+            r[i] = hi < clamped ? hi : clamped;
+         }
+      }
+      return result;
+   }
+
+
+   ///                                                                        
+   ///   Arithmetics                                                          
+   ///                                                                        
+   /// Generate the stream-stream, stream-vector and stream-scalar variants   
+   /// of an arithmetic operator, along with its mutable counterpart          
+   #define GENERATE_OPERATOR(OP, SIMDOP) \
+      TEMPLATE() \
+      TME()& TME()::operator OP##= (const TVectorStream& rhs) { \
+         CheckCompatible(rhs.mCount); \
+         for (Offset c = 0; c < S; ++c) { \
+            Batch(GetLane(c), rhs.GetLane(c), GetLane(c), mCount, \
+               [](const BlockType& a, const BlockType& b, BlockType& r) { \
+                  SIMD::SIMDOP(a, b, r); \
+               }, \
+               [](const T& a, const T& b, T& r) { r = a OP b; } \
+            ); \
+         } \
+         return *this; \
+      } \
+      TEMPLATE() \
+      TME()& TME()::operator OP##= (const VectorType& rhs) { \
+         for (Offset c = 0; c < S; ++c) { \
+            Batch(GetLane(c), rhs.all[c], GetLane(c), mCount, \
+               [](const BlockType& a, const T& b, BlockType& r) { \
+                  SIMD::SIMDOP(a, b, r); \
+               }, \
+               [](const T& a, const T& b, T& r) { r = a OP b; } \
+            ); \
+         } \
+         return *this; \
+      } \
+      TEMPLATE() \
+      TME()& TME()::operator OP##= (const T& rhs) { \
+         for (Offset c = 0; c < S; ++c) { \
+            Batch(GetLane(c), rhs, GetLane(c), mCount, \
+               [](const BlockType& a, const T& b, BlockType& r) { \
+                  SIMD::SIMDOP(a, b, r); \
+               }, \
+               [](const T& a, const T& b, T& r) { r = a OP b; } \
+            ); \
+         } \
+         return *this; \
+      } \
+      TEMPLATE() LANGULUS(INLINED) \
+      TME() TME()::operator OP (const TVectorStream& rhs) const { \
+         TVectorStream result {*this}; \
+         result OP##= rhs; \
+         return result; \
+      } \
+      TEMPLATE() LANGULUS(INLINED) \
+      TME() TME()::operator OP (const VectorType& rhs) const { \
+         TVectorStream result {*this}; \
+         result OP##= rhs; \
+         return result; \
+      } \
+      TEMPLATE() LANGULUS(INLINED) \
+      TME() TME()::operator OP (const T& rhs) const { \
+         TVectorStream result {*this}; \
+         result OP##= rhs; \
+         return result; \
+      }
+
+   GENERATE_OPERATOR(+, Add)
+   GENERATE_OPERATOR(-, Subtract)
+   GENERATE_OPERATOR(*, Multiply)
+   GENERATE_OPERATOR(/, Divide)
+
+   #undef GENERATE_OPERATOR
+
+   /// Scale each vector by the corresponding element of a lane               
+   ///   @param rhs - the lane of factors                                     
+   ///   @return a reference to this stream                                   
+   TEMPLATE()
+   TME()& TME()::operator *= (const LaneType& rhs) requires (S > 1) {
+      CheckCompatible(rhs.GetCount());
+      for (Offset c = 0; c < S; ++c) {
+         Batch(GetLane(c), rhs.GetLane(0), GetLane(c), mCount,
+            [](const BlockType& a, const BlockType& b, BlockType& r) {
+               SIMD::Multiply(a, b, r);
+            },
+            [](const T& a, const T& b, T& r) { r = a * b; }
+         );
+      }
+      return *this;
+   }
+
+   /// Scale each vector by the corresponding element of a lane               
+   ///   @param rhs - the lane of factors                                     
+   ///   @return the scaled stream                                            
+   TEMPLATE() LANGULUS(INLINED)
+   TME() TME()::operator * (const LaneType& rhs) const requires (S > 1) {
+      TVectorStream result {*this};
+      result *= rhs;
+      return result;
+   }
+
+   /// Negate all vectors                                                     
+   ///   @return the negated stream                                           
+   TEMPLATE() LANGULUS(INLINED)
+   TME() TME()::operator - () const {
+      TVectorStream result {mCount};
+      for (Offset c = 0; c < S; ++c) {
+         const T* a = GetLane(c);
+         T* r = result.GetLane(c);
+         for (Offset i = 0; i < mCount; ++i)
+            r[i] = -a[i];
+      }
+      return result;
+   }
+
+} // namespace Langulus::Math
+
+#undef TEMPLATE
+#undef TME
\ No newline at end of file
@@ -8,6 +8,7 @@
 #pragma once
 #include "Add.hpp"
 #include "Arithmetic.inl"
+#include "../Functions/Arithmetics.hpp"
 #include "../Numbers/Infinity.hpp"
 
 #if 0
@@ -72,45 +73,81 @@ namespace Langulus::Verbs
    }
 
    /// Operate in a number of types                                           
+   ///   @tparam MODE - what to do with results, that don't fit their type    
    ///   @tparam ...T - the list of types to operate on                       
    ///                  order matters!                                        
    ///   @param context - the original context                                
    ///   @param common - the base to operate on                               
    ///   @param verb - the original verb                                      
    ///   @return if at least one of the types matched verb                    
-   template<CT::Data... T>
+   template<OverflowMode MODE, CT::Data... T>
    bool Add::OperateOnTypes(const Many& context, const Many& common, Verb& verb) {
-      return ((common.CastsTo<T, true>()
-         and ArithmeticVerb::Vector<T>(context, common, verb,
-            verb.GetMass() < 0
-               ? [](const T* lhs, const T* rhs) noexcept -> T {
-                  return *lhs - *rhs;
-               }
-               : [](const T* lhs, const T* rhs) noexcept -> T {
-                  return *lhs + *rhs;
-               }
-         )) or ...);
+      if constexpr (MODE == OverflowMode::Wrap) {
+         return ((common.CastsTo<T, true>()
+            and (verb.GetMass() < 0
+               ? ArithmeticVerb::Vector<T>(context, common, verb,
+                  [](const T* lhs, const T* rhs) noexcept -> T {
+                     return *lhs - *rhs;
+                  })
+               : ArithmeticVerb::Vector<T>(context, common, verb,
+                  [](const T* lhs, const T* rhs) noexcept -> T {
+                     return *lhs + *rhs;
+                  })
+            )) or ...);
+      }
+      else {
+         constexpr bool SATURATE = MODE == OverflowMode::Saturate;
+         return ((common.CastsTo<T, true>()
+            and (verb.GetMass() < 0
+               ? ArithmeticVerb::Vector<T>(context, common, verb,
+                  [](const T* lhs, const T* rhs, T* out) noexcept {
+                     return Math::SubChecked<SATURATE>(*lhs, *rhs, *out);
+                  })
+               : ArithmeticVerb::Vector<T>(context, common, verb,
+                  [](const T* lhs, const T* rhs, T* out) noexcept {
+                     return Math::AddChecked<SATURATE>(*lhs, *rhs, *out);
+                  })
+            )) or ...);
+      }
    }
 
    /// Operate in a number of types (destructive version)                     
+   ///   @tparam MODE - what to do with results, that don't fit their type    
    ///   @tparam ...T - the list of types to operate on                       
    ///                  order matters!                                        
    ///   @param context - the original context                                
    ///   @param common - the base to operate on                               
    ///   @param verb - the original verb                                      
    ///   @return if at least one of the types matched verb                    
-   template<CT::Data... T>
+   template<OverflowMode MODE, CT::Data... T>
    bool Add::OperateOnTypes(const Many& context, Many& common, Verb& verb) {
-      return ((common.CastsTo<T, true>()
-         and ArithmeticVerb::Vector<T>(context, common, verb,
-            verb.GetMass() < 0
-               ? [](T* lhs, const T* rhs) noexcept {
-                  *lhs -= *rhs;
-               }
-               : [](T* lhs, const T* rhs) noexcept {
-                  *lhs += *rhs;
-               }
-         )) or ...);
+      if constexpr (MODE == OverflowMode::Wrap) {
+         return ((common.CastsTo<T, true>()
+            and (verb.GetMass() < 0
+               ? ArithmeticVerb::Vector<T>(context, common, verb,
+                  [](T* lhs, const T* rhs) noexcept {
+                     *lhs -= *rhs;
+                  })
+               : ArithmeticVerb::Vector<T>(context, common, verb,
+                  [](T* lhs, const T* rhs) noexcept {
+                     *lhs += *rhs;
+                  })
+            )) or ...);
+      }
+      else {
+         constexpr bool SATURATE = MODE == OverflowMode::Saturate;
+         return ((common.CastsTo<T, true>()
+            and (verb.GetMass() < 0
+               ? ArithmeticVerb::Vector<T>(context, common, verb,
+                  [](const T* lhs, const T* rhs, T* out) noexcept {
+                     return Math::SubChecked<SATURATE>(*lhs, *rhs, *out);
+                  })
+               : ArithmeticVerb::Vector<T>(context, common, verb,
+                  [](const T* lhs, const T* rhs, T* out) noexcept {
+                     return Math::AddChecked<SATURATE>(*lhs, *rhs, *out);
+                  })
+            )) or ...);
+      }
    }
 
    /// Invert verb's arguments                                                
@@ -130,12 +167,14 @@ namespace Langulus::Verbs
    }
 
    /// Default add/subtract in an immutable context                           
+   ///   @tparam MODE - what to do with results, that don't fit their type    
    ///   @param context - the block to execute in                             
    ///   @param verb - add/subtract verb                                      
-   inline bool Add::ExecuteDefault(const Many& context, Verb& verb) {
+   template<OverflowMode MODE>
+   bool Add::ExecuteDefault(const Many& context, Verb& verb) {
       const auto common = context.ReinterpretAs(verb.GetArgument());
       if (common.template CastsTo<A::Number>()) {
-         return OperateOnTypes<
+         return OperateOnTypes<MODE,
             Float, Double,
             int32_t, uint32_t, int64_t, uint64_t,
             int8_t, uint8_t, int16_t, uint16_t
@@ -146,12 +185,14 @@ namespace Langulus::Verbs
    }
 
    /// Default add/subtract in mutable context                                
+   ///   @tparam MODE - what to do with results, that don't fit their type    
    ///   @param context - the block to execute in                             
    ///   @param verb - add/subtract verb                                      
-   inline bool Add::ExecuteDefault(Many& context, Verb& verb) {
+   template<OverflowMode MODE>
+   bool Add::ExecuteDefault(Many& context, Verb& verb) {
       auto common = context.ReinterpretAs(verb.GetArgument());
       if (common.template CastsTo<A::Number>()) {
-         return OperateOnTypes<
+         return OperateOnTypes<MODE,
             Float, Double,
             int32_t, uint32_t, int64_t, uint64_t,
             int8_t, uint8_t, int16_t, uint16_t
@@ -161,6 +202,20 @@ namespace Langulus::Verbs
       return false;
    }
 
+   /// Default add/subtract in an immutable context, wrapping around results  
+   ///   @param context - the block to execute in                             
+   ///   @param verb - add/subtract verb                                      
+   inline bool Add::ExecuteDefault(const Many& context, Verb& verb) {
+      return ExecuteDefault<OverflowMode::Wrap>(context, verb);
+   }
+
+   /// Default add/subtract in mutable context, wrapping around results       
+   ///   @param context - the block to execute in                             
+   ///   @param verb - add/subtract verb                                      
+   inline bool Add::ExecuteDefault(Many& context, Verb& verb) {
+      return ExecuteDefault<OverflowMode::Wrap>(context, verb);
+   }
+
    /// A stateless subtraction                                                
    /// Basically negates rhs when mass is below zero, otherwise does nothing  
    ///   @param verb - the verb instance to execute                           
@@ -10,37 +10,73 @@
 #include <Flow/Verb.hpp>
 
 
+namespace Langulus::CT
+{
+
+   /// Arithmetic operator, that returns the result                           
+   template<class OP, class T>
+   concept ArithmeticOperator = requires (OP op, const T* a) {
+      {op(a, a)} -> Same<T>;
+   };
+
+   /// Arithmetic operator, that writes the result to its first argument      
+   template<class OP, class T>
+   concept ArithmeticOperatorMutable = requires (OP op, T* a, const T* b) {
+      {op(a, b)} -> Same<void>;
+   };
+
+   /// Arithmetic operator, that writes the result to its last argument, and  
+   /// returns true if the result didn't fit the type                         
+   template<class OP, class T>
+   concept ArithmeticOperatorChecked = requires (OP op, const T* a, T* r) {
+      {op(a, a, r)} -> Same<bool>;
+   };
+
+} // namespace Langulus::CT
+
 namespace Langulus::Flow
 {
+
+   /// What arithmetic verbs do with results, that don't fit their type       
+   enum class OverflowMode {
+      // Integers wrap around, reals become infinite                    
+      Wrap,
+      // Results are clamped to the limits of the type, and counted     
+      Saturate,
+      // Results wrap around, and are counted                           
+      Check
+   };
    
    ///                                                                        
    /// Statically typed verb, used as CRTP for arithmetic verbs               
    ///                                                                        
+   /// The operators are functors, that get inlined in loops, processing a    
+   /// whole register worth of elements at a time, so that they vectorize     
+   /// Checked operators additionally report results that didn't fit - their  
+   /// count is pushed to the verb output as Traits::Overflow, right after    
+   /// the result                                                             
+   ///                                                                        
    template<class VERB, bool NOEXCEPT>
    struct ArithmeticVerb : TVerb<VERB> {
-      template<CT::Data T>
-      using Operator = Conditional<NOEXCEPT,
-         T(*)(const T*, const T*) noexcept, 
-         T(*)(const T*, const T*)
-      >;
-
-      template<CT::Data T>
-      using OperatorMutable = Conditional<NOEXCEPT,
-         void(*)(T*, const T*) noexcept,
-         void(*)(T*, const T*)
-      >;
-
       using TVerb<VERB>::TVerb;
 
-      template<CT::Data T>
-      static bool Vector(const Many&, const Many&, Verb&, Operator<T>) noexcept(NOEXCEPT);
-      template<CT::Data T>
-      static bool Vector(const Many&, Many&, Verb&, OperatorMutable<T>) noexcept(NOEXCEPT);
+      template<CT::Data T, CT::ArithmeticOperator<T> OP>
+      static bool Vector(const Many&, const Many&, Verb&, OP&&) noexcept(NOEXCEPT);
+      template<CT::Data T, CT::ArithmeticOperatorMutable<T> OP>
+      static bool Vector(const Many&, Many&, Verb&, OP&&) noexcept(NOEXCEPT);
+      template<CT::Data T, CT::ArithmeticOperatorChecked<T> OP>
+      static bool Vector(const Many&, const Many&, Verb&, OP&&) noexcept(NOEXCEPT);
+      template<CT::Data T, CT::ArithmeticOperatorChecked<T> OP>
+      static bool Vector(const Many&, Many&, Verb&, OP&&) noexcept(NOEXCEPT);
+
+      template<CT::Data T, CT::ArithmeticOperator<T> OP>
+      static bool Scalar(const Many&, const Many&, Verb&, OP&&) noexcept(NOEXCEPT);
+      template<CT::Data T, CT::ArithmeticOperatorMutable<T> OP>
+      static bool Scalar(const Many&, Many&, Verb&, OP&&) noexcept(NOEXCEPT);
 
-      template<CT::Data T>
-      static bool Scalar(const Many&, const Many&, Verb&, Operator<T>) noexcept(NOEXCEPT);
-      template<CT::Data T>
-      static bool Scalar(const Many&, Many&, Verb&, OperatorMutable<T>) noexcept(NOEXCEPT);
+   protected:
+      template<CT::Data T, bool SCALAR, class OP>
+      static Count Batch(const T*, const T*, T*, Count, OP&&) noexcept(NOEXCEPT);
    };
 
 } // namespace Langulus::Flow
\ No newline at end of file
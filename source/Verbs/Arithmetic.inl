@@ -8,6 +8,7 @@
 #pragma once
 #include "Arithmetic.hpp"
 #include <Anyness/Many.hpp>
+#include <type_traits>
 
 
 namespace Langulus::Flow
@@ -18,22 +19,17 @@ namespace Langulus::Flow
    ///   @tparam T - type to interpret as                                     
    ///   @param lhs - left operand                                            
    ///   @param rhs - right operand                                           
-   template<class VERB, bool NOEXCEPT> template<CT::Data T> LANGULUS(INLINED)
+   ///   @param op - the operator, (const T*, const T*) -> T                  
+   template<class VERB, bool NOEXCEPT> template<CT::Data T, CT::ArithmeticOperator<T> OP> LANGULUS(INLINED)
    bool ArithmeticVerb<VERB, NOEXCEPT>::Vector(
-      const Many& original, const Many& lhs, Verb& rhs, Operator<T> op
+      const Many& original, const Many& lhs, Verb& rhs, OP&& op
    ) noexcept (NOEXCEPT) {
-      //TODO use TSIMD to batch compute
       //TODO once vulkan module is available, lock and replace the ExecuteDefault in
       // MVulkan to incorporate compute shader for even batcher batching!!1
-      //TODO detect underflows and overflows
       TMany<T> result;
       result.template Reserve<true>(lhs.GetCount());
-      const T* ilhs = lhs.GetRaw<T>();
-      const T* const ilhsEnd = ilhs + lhs.GetCount();
-      const T* irhs = rhs.GetRaw<T>();
-      T* ires = result.GetRaw();
-      while (ilhs != ilhsEnd)
-         *(ires++) = op(ilhs++, irhs++);
+      Batch<T, false>(lhs.GetRaw<T>(), rhs.GetRaw<T>(), result.GetRaw(),
+         lhs.GetCount(), op);
 
       // Interpret back to the original and push to verb output         
       rhs << result.ReinterpretAs(original);
@@ -46,19 +42,15 @@ namespace Langulus::Flow
    ///   @tparam T - type to interpret as                                     
    ///   @param lhs - left operand                                            
    ///   @param rhs - right operand                                           
-   template<class VERB, bool NOEXCEPT> template<CT::Data T> LANGULUS(INLINED)
+   ///   @param op - the operator, (T*, const T*), writes to the first        
+   template<class VERB, bool NOEXCEPT> template<CT::Data T, CT::ArithmeticOperatorMutable<T> OP> LANGULUS(INLINED)
    bool ArithmeticVerb<VERB, NOEXCEPT>::Vector(
-      const Many& original, Many& lhs, Verb& rhs, OperatorMutable<T> o
+      const Many& original, Many& lhs, Verb& rhs, OP&& op
    ) noexcept (NOEXCEPT) {
-      //TODO use TSIMD to batch compute
       //TODO once vulkan module is available, lock and replace the ExecuteDefault in
       // MVulkan to incorporate compute shader for even batcher batching!!1
-      //TODO detect underflows and overflows
       T* ilhs = lhs.GetRaw<T>();
-      const T* const ilhsEnd = ilhs + lhs.GetCount();
-      const T* irhs = rhs.GetRaw<T>();
-      while (ilhs != ilhsEnd)
-         o(ilhs++, irhs++);
+      Batch<T, false>(ilhs, rhs.GetRaw<T>(), ilhs, lhs.GetCount(), op);
 
       // We're editing through the reinterpretation, but we must return 
       // the original                                                   
@@ -72,22 +64,17 @@ namespace Langulus::Flow
    ///   @tparam T - type to interpret as                                     
    ///   @param lhs - left operand                                            
    ///   @param rhs - right operand                                           
-   template<class VERB, bool NOEXCEPT> template<CT::Data T> LANGULUS(INLINED)
+   ///   @param op - the operator, (const T*, const T*) -> T                  
+   template<class VERB, bool NOEXCEPT> template<CT::Data T, CT::ArithmeticOperator<T> OP> LANGULUS(INLINED)
    bool ArithmeticVerb<VERB, NOEXCEPT>::Scalar(
-      const Many& original, const Many& lhs, Verb& rhs, Operator<T> o
+      const Many& original, const Many& lhs, Verb& rhs, OP&& op
    ) noexcept (NOEXCEPT) {
-      //TODO use TSIMD to batch compute
       //TODO once vulkan module is available, lock and replace the ExecuteDefault in
       // MVulkan to incorporate compute shader for even batcher batching!!1
-      //TODO detect underflows and overflows
       TMany<T> result;
       result.template Reserve<true>(lhs.GetCount());
-      const T* ilhs = lhs.GetRaw<T>();
-      const T* const ilhsEnd = ilhs + lhs.GetCount();
-      const T& irhs = *rhs.GetRaw<T>();
-      T* ires = result.GetRaw();
-      while (ilhs != ilhsEnd)
-         *(ires++) = o(ilhs++, &irhs);
+      Batch<T, true>(lhs.GetRaw<T>(), rhs.GetRaw<T>(), result.GetRaw(),
+         lhs.GetCount(), op);
 
       // Interpret back to the original and push to verb output         
       rhs << result.ReinterpretAs(original);
@@ -101,19 +88,15 @@ namespace Langulus::Flow
    ///   @tparam T - type to interpret as                                     
    ///   @param lhs - left operand                                            
    ///   @param rhs - right operand                                           
-   template<class VERB, bool NOEXCEPT> template<CT::Data T> LANGULUS(INLINED)
+   ///   @param op - the operator, (T*, const T*), writes to the first        
+   template<class VERB, bool NOEXCEPT> template<CT::Data T, CT::ArithmeticOperatorMutable<T> OP> LANGULUS(INLINED)
    bool ArithmeticVerb<VERB, NOEXCEPT>::Scalar(
-      const Many& original, Many& lhs, Verb& rhs, OperatorMutable<T> o
+      const Many& original, Many& lhs, Verb& rhs, OP&& op
    ) noexcept (NOEXCEPT) {
-      //TODO use TSIMD to batch compute
       //TODO once vulkan module is available, lock and replace the ExecuteDefault in
       // MVulkan to incorporate compute shader for even batcher batching!!1
-      //TODO detect underflows and overflows
       T* ilhs = lhs.GetRaw<T>();
-      const T* const ilhsEnd = ilhs + lhs.GetCount();
-      const T& irhs = *rhs.GetRaw<T>();
-      while (ilhs != ilhsEnd)
-         o(ilhs++, &irhs);
+      Batch<T, true>(ilhs, rhs.GetRaw<T>(), ilhs, lhs.GetCount(), op);
 
       // We're editing through the reinterpretation, but we must return 
       // the original                                                   
@@ -121,5 +104,123 @@ namespace Langulus::Flow
       return true;
    }
 
+   /// Do a checked arithmetic operation on two containers                    
+   /// Pushes the result, followed by the number of elements that didn't fit  
+   ///   @tparam T - type to interpret as                                     
+   ///   @param lhs - left operand                                            
+   ///   @param rhs - right operand                                           
+   ///   @param op - the operator, (const T*, const T*, T*) -> bool           
+   template<class VERB, bool NOEXCEPT> template<CT::Data T, CT::ArithmeticOperatorChecked<T> OP> LANGULUS(INLINED)
+   bool ArithmeticVerb<VERB, NOEXCEPT>::Vector(
+      const Many& original, const Many& lhs, Verb& rhs, OP&& op
+   ) noexcept (NOEXCEPT) {
+      TMany<T> result;
+      result.template Reserve<true>(lhs.GetCount());
+      const auto overflows = Batch<T, false>(lhs.GetRaw<T>(),
+         rhs.GetRaw<T>(), result.GetRaw(), lhs.GetCount(), op);
+
+      // Interpret back to the original and push to verb output         
+      rhs << result.ReinterpretAs(original);
+      rhs << Traits::Overflow {overflows};
+      return true;
+   }
+
+   /// Do a checked arithmetic operation on two containers (destructive)      
+   /// Pushes the result, followed by the number of elements that didn't fit  
+   ///   @tparam T - type to interpret as                                     
+   ///   @param lhs - left operand                                            
+   ///   @param rhs - right operand                                           
+   ///   @param op - the operator, (const T*, const T*, T*) -> bool           
+   template<class VERB, bool NOEXCEPT> template<CT::Data T, CT::ArithmeticOperatorChecked<T> OP> LANGULUS(INLINED)
+   bool ArithmeticVerb<VERB, NOEXCEPT>::Vector(
+      const Many& original, Many& lhs, Verb& rhs, OP&& op
+   ) noexcept (NOEXCEPT) {
+      T* ilhs = lhs.GetRaw<T>();
+      const auto overflows = Batch<T, false>(ilhs, rhs.GetRaw<T>(), ilhs,
+         lhs.GetCount(), op);
+
+      // We're editing through the reinterpretation, but we must return 
+      // the original                                                   
+      rhs << Many {original};
+      rhs << Traits::Overflow {overflows};
+      return true;
+   }
+
+   /// Run an operator over arrays of elements                                
+   /// Elements are copied to local arrays a register (64 bytes) at a time,   
+   /// so that the compiler knows they don't alias, and vectorizes the        
+   /// operator. The remainder is processed one element at a time             
+   ///   @tparam T - type of the elements                                     
+   ///   @tparam SCALAR - true to use only the first element of rhs           
+   ///   @param lhs - left operands                                           
+   ///   @param rhs - right operands                                          
+   ///   @param out - [out] results, can be the same as lhs                   
+   ///   @param count - number of elements in lhs and out                     
+   ///   @param op - either (const T*, const T*) -> T, or (T*, const T*),     
+   ///      that writes the result to the first argument, or the checked      
+   ///      (const T*, const T*, T*) -> bool                                  
+   ///   @return the number of results, that the checked operator reported    
+   ///      as not fitting, zero for the other operators                      
+   template<class VERB, bool NOEXCEPT> template<CT::Data T, bool SCALAR, class OP> LANGULUS(INLINED)
+   Count ArithmeticVerb<VERB, NOEXCEPT>::Batch(
+      const T* lhs, const T* rhs, T* out, Count count, OP&& op
+   ) noexcept (NOEXCEPT) {
+      constexpr bool Mutable = CT::ArithmeticOperatorMutable<OP, T>;
+      constexpr bool Checked = CT::ArithmeticOperatorChecked<OP, T>;
+      if constexpr (Mutable) {
+         static_assert(not NOEXCEPT or noexcept(op(::std::declval<T*>(), ::std::declval<const T*>())),
+            "Operator must be noexcept for this verb");
+      }
+      else if constexpr (Checked) {
+         static_assert(not NOEXCEPT or noexcept(op(::std::declval<const T*>(), ::std::declval<const T*>(), ::std::declval<T*>())),
+            "Operator must be noexcept for this verb");
+      }
+      else {
+         static_assert(not NOEXCEPT or noexcept(op(::std::declval<const T*>(), ::std::declval<const T*>())),
+            "Operator must be noexcept for this verb");
+      }
+
+      // Applies the operator to a single element, returns true if the  
+      // result didn't fit                                              
+      const auto apply = [&op](T* l, const T* r, T* o) noexcept(NOEXCEPT) -> bool {
+         if constexpr (Mutable) {
+            op(l, r);
+            *o = *l;
+            return false;
+         }
+         else if constexpr (Checked)
+            return op(l, r, o);
+         else {
+            *o = op(l, r);
+            return false;
+         }
+      };
+
+      Count overflows = 0;
+      Offset i = 0;
+      if constexpr (CT::POD<T> and sizeof(T) <= 32) {
+         constexpr Count Block = 64 / sizeof(T);
+         for (; i + Block <= count; i += Block) {
+            T a[Block], b[Block], r[Block];
+            for (Offset j = 0; j < Block; ++j) {
+               a[j] = lhs[i + j];
+               b[j] = SCALAR ? *rhs : rhs[i + j];
+            }
+
+            for (Offset j = 0; j < Block; ++j)
+               overflows += apply(a + j, b + j, r + j);
+
+            for (Offset j = 0; j < Block; ++j)
+               out[i + j] = r[j];
+         }
+      }
+
+      for (; i < count; ++i) {
+         T a = lhs[i];
+         overflows += apply(&a, SCALAR ? rhs : rhs + i, out + i);
+      }
+      return overflows;
+   }
+
 } // namespace Langulus::Flow
 
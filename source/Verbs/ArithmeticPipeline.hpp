@@ -0,0 +1,82 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "Add.hpp"
+#include "Multiply.hpp"
+#include "Exponent.hpp"
+#include "Modulate.hpp"
+#include "Lerp.hpp"
+
+
+namespace Langulus::Flow
+{
+
+   /// Operations in a fused arithmetic pipeline, one per verb and mass sign  
+   enum class ArithmeticOp : ::std::uint8_t {
+      Add, Subtract,
+      Multiply, Divide,
+      Exponent, Root,
+      Modulate, Lerp
+   };
+
+   /// A pipeline step, with its operand interpreted as T                     
+   template<CT::Number T>
+   struct TArithmeticStep {
+      ArithmeticOp mOp;
+      // The right operand - either one per element, or a single one    
+      const T* mOperand;
+      // Whether the single mOperand is used for all elements           
+      bool mBroadcast;
+   };
+
+
+   ///                                                                        
+   ///   Fused arithmetic pipeline                                            
+   ///                                                                        
+   ///   Recognizes a chain of math verbs, where each verb's source is the    
+   /// previous verb, like (a * b + c) ^ d, and executes it in a single pass, 
+   /// with a single allocation for the output. Executing the verbs one by    
+   /// one would allocate and stream through a whole container per verb.      
+   ///   The chain's first source and all arguments must be containers of     
+   /// the same number type, and of the same length as the first source.      
+   /// Single numbers are used for all elements. Anything else can't be       
+   /// fused, and should be executed as usual.                                
+   ///                                                                        
+   struct ArithmeticPipeline {
+      struct Step {
+         ArithmeticOp mOp;
+         Many mOperand;
+      };
+
+   protected:
+      // The first source in the chain                                  
+      Many mInput;
+      // The steps, in the order they are executed                      
+      TMany<Step> mSteps;
+
+   public:
+      ArithmeticPipeline() = default;
+      ArithmeticPipeline(const Verb&);
+
+      NOD() bool IsFused() const noexcept;
+      NOD() auto GetInput() const noexcept -> const Many&;
+      NOD() auto GetSteps() const noexcept -> const TMany<Step>&;
+
+      bool Execute(Verb&) const;
+
+      template<CT::Number T>
+      static void Stream(const T*, const TArithmeticStep<T>*, Count, T*, Count) noexcept;
+
+   protected:
+      bool Gather(const Verb&);
+
+      template<CT::Data...T>
+      bool ExecuteAs(Verb&) const;
+   };
+
+} // namespace Langulus::Flow
\ No newline at end of file
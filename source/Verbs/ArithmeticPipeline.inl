@@ -0,0 +1,213 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#pragma once
+#include "ArithmeticPipeline.hpp"
+#include "../Functions/Arithmetics.hpp"
+#include <Anyness/Many.hpp>
+#include <cmath>
+
+
+namespace Langulus::Flow
+{
+
+   /// Recognize a chain of verbs                                             
+   /// The pipeline isn't fused, if any part of the chain isn't fusable       
+   ///   @param verb - the last verb in the chain                             
+   inline ArithmeticPipeline::ArithmeticPipeline(const Verb& verb) {
+      if (not Gather(verb) or mSteps.GetCount() < 2) {
+         mInput = Many {};
+         mSteps.Clear();
+      }
+   }
+
+   /// Gather a verb and its sources as steps, the first source first         
+   ///   @param verb - the verb to gather                                     
+   ///   @return true if the verb and all of its sources are fusable          
+   inline bool ArithmeticPipeline::Gather(const Verb& verb) {
+      const bool negative = verb.GetMass() < 0;
+      ArithmeticOp op;
+      if (verb.template IsVerb<Verbs::Add>())
+         op = negative ? ArithmeticOp::Subtract : ArithmeticOp::Add;
+      else if (verb.template IsVerb<Verbs::Multiply>())
+         op = negative ? ArithmeticOp::Divide : ArithmeticOp::Multiply;
+      else if (verb.template IsVerb<Verbs::Exponent>())
+         op = negative ? ArithmeticOp::Root : ArithmeticOp::Exponent;
+      else if (verb.template IsVerb<Verbs::Modulate>())
+         op = ArithmeticOp::Modulate;
+      else if (verb.template IsVerb<Verbs::Lerp>()) {
+         // Lerp is still a placeholder that computes Mod, see Stream   
+         op = ArithmeticOp::Lerp;
+      }
+      else
+         return false;
+
+      const auto& argument = verb.GetArgument();
+      if (not argument.template CastsTo<A::Number>())
+         return false;
+
+      const auto& source = verb.GetSource();
+      if (source.GetCount() == 1 and source.template CastsTo<Verb, true>()) {
+         // The source is another verb in the chain                     
+         if (not Gather(source.template As<Verb>()))
+            return false;
+      }
+      else if (source.template CastsTo<A::Number>())
+         mInput = source;
+      else
+         return false;
+
+      mSteps << Step {op, argument};
+      return true;
+   }
+
+   /// Check if a chain of at least two verbs was recognized                  
+   ///   @return true if the pipeline can be executed                         
+   inline bool ArithmeticPipeline::IsFused() const noexcept {
+      return not mSteps.IsEmpty();
+   }
+
+   /// Get the first source in the chain                                      
+   ///   @return the input                                                    
+   inline auto ArithmeticPipeline::GetInput() const noexcept -> const Many& {
+      return mInput;
+   }
+
+   /// Get the recognized steps                                               
+   ///   @return the steps, in the order they are executed                    
+   inline auto ArithmeticPipeline::GetSteps() const noexcept -> const TMany<Step>& {
+      return mSteps;
+   }
+
+   /// Execute the pipeline in a single pass                                  
+   ///   @param verb - the last verb in the chain, receives the output        
+   ///   @return true if the pipeline was executed, false if the types or     
+   ///      the lengths of the input and operands can't be fused - nothing    
+   ///      is executed then, and the chain should be executed as usual       
+   inline bool ArithmeticPipeline::Execute(Verb& verb) const {
+      if (not IsFused())
+         return false;
+
+      return ExecuteAs<
+         Float, Double,
+         int32_t, uint32_t, int64_t, uint64_t,
+         int8_t, uint8_t, int16_t, uint16_t
+      >(verb);
+   }
+
+   /// Execute the pipeline, interpreting everything as the first matching    
+   /// type                                                                   
+   ///   @tparam ...T - the list of types to try, order matters!              
+   ///   @param verb - the last verb in the chain, receives the output        
+   ///   @return true if the pipeline was executed                            
+   template<CT::Data...T>
+   bool ArithmeticPipeline::ExecuteAs(Verb& verb) const {
+      const auto execute = [&]<class N>() -> bool {
+         if (not mInput.template CastsTo<N, true>())
+            return false;
+
+         const Count count = mInput.GetCount();
+         TMany<TArithmeticStep<N>> steps;
+         steps.Reserve(mSteps.GetCount());
+         for (auto& step : mSteps) {
+            const Count operands = step.mOperand.GetCount();
+            if (not step.mOperand.template CastsTo<N, true>()
+            or (operands != count and operands != 1))
+               return false;
+
+            steps << TArithmeticStep<N> {
+               step.mOp, step.mOperand.template GetRaw<N>(), operands != count
+            };
+         }
+
+         TMany<N> result;
+         result.template Reserve<true>(count);
+         Stream(mInput.template GetRaw<N>(), steps.GetRaw(), steps.GetCount(),
+            result.GetRaw(), count);
+
+         // Interpret back to the original and push to verb output      
+         verb << result.ReinterpretAs(mInput);
+         return true;
+      };
+
+      return (execute.template operator()<T>() or ...);
+   }
+
+   /// Stream numbers through a list of steps                                 
+   /// Numbers are processed in blocks, that stay in L1 cache through all     
+   /// steps. Each step is dispatched once per block, and runs a branchless   
+   /// loop over the whole block, that compilers vectorize                    
+   ///   @param input - the numbers to stream                                 
+   ///   @param steps - the steps to apply to each number, in order           
+   ///   @param stepCount - number of steps                                   
+   ///   @param output - [out] the results, can be the same as input          
+   ///   @param count - number of elements in input and output                
+   template<CT::Number T>
+   void ArithmeticPipeline::Stream(
+      const T* input, const TArithmeticStep<T>* steps, Count stepCount,
+      T* output, Count count
+   ) noexcept {
+      constexpr Count Block = 1024 / sizeof(T);
+      T r[Block], b[Block];
+
+      for (Offset i = 0; i < count; i += Block) {
+         const Count n = count - i < Block ? count - i : Block;
+         for (Offset j = 0; j < n; ++j)
+            r[j] = input[i + j];
+
+         for (Offset s = 0; s < stepCount; ++s) {
+            const auto& step = steps[s];
+            if (step.mBroadcast) {
+               for (Offset j = 0; j < n; ++j)
+                  b[j] = *step.mOperand;
+            }
+            else {
+               for (Offset j = 0; j < n; ++j)
+                  b[j] = step.mOperand[i + j];
+            }
+
+            const auto apply = [&](auto&& op) noexcept {
+               for (Offset j = 0; j < n; ++j)
+                  r[j] = static_cast<T>(op(r[j], b[j]));
+            };
+
+            // Each operation matches what its verb does by default     
+            switch (step.mOp) {
+            case ArithmeticOp::Add:
+               apply([](T lhs, T rhs) noexcept { return lhs + rhs; });
+               break;
+            case ArithmeticOp::Subtract:
+               apply([](T lhs, T rhs) noexcept { return lhs - rhs; });
+               break;
+            case ArithmeticOp::Multiply:
+               apply([](T lhs, T rhs) noexcept { return lhs * rhs; });
+               break;
+            case ArithmeticOp::Divide:
+               apply([](T lhs, T rhs) noexcept { return lhs / rhs; });
+               break;
+            case ArithmeticOp::Exponent:
+               apply([](T lhs, T rhs) noexcept { return ::std::pow(lhs, rhs); });
+               break;
+            case ArithmeticOp::Root:
+               apply([](T lhs, T rhs) noexcept { return ::std::pow(lhs, T {1} / rhs); });
+               break;
+            case ArithmeticOp::Modulate:
+            case ArithmeticOp::Lerp:
+               // Mirrors the placeholder in Lerp::OperateOnTypes on    
+               // purpose, so that fused chains give the same results   
+               // as running the verbs. Change both once Lerp is done   
+               apply([](T lhs, T rhs) noexcept { return Math::Mod(lhs, rhs); });
+               break;
+            }
+         }
+
+         for (Offset j = 0; j < n; ++j)
+            output[i + j] = r[j];
+      }
+   }
+
+} // namespace Langulus::Flow
\ No newline at end of file
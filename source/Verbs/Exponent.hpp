@@ -38,10 +38,14 @@ namespace Langulus::Verbs
 
       static bool ExecuteDefault(const Many&, Verb&);
       static bool ExecuteDefault(Many&, Verb&);
+      template<OverflowMode>
+      static bool ExecuteDefault(const Many&, Verb&);
+      template<OverflowMode>
+      static bool ExecuteDefault(Many&, Verb&);
 
-      template<CT::Data...>
+      template<OverflowMode, CT::Data...>
       static bool OperateOnTypes(const Many&, const Many&, Verb&);
-      template<CT::Data...>
+      template<OverflowMode, CT::Data...>
       static bool OperateOnTypes(const Many&, Many&, Verb&);
    };
 
@@ -8,6 +8,7 @@
 #pragma once
 #include "Exponent.hpp"
 #include "Arithmetic.inl"
+#include "../Functions/Arithmetics.hpp"
 
 #if 0
    #define VERBOSE_EXP(...) Logger::Verbose(__VA_ARGS__)
@@ -60,33 +61,53 @@ namespace Langulus::Verbs
    }
 
    /// Operate in a number of types                                           
+   ///   @tparam MODE - what to do with results, that don't fit their type    
    ///   @tparam ...T - the list of types to operate on                       
    ///                  order matters!                                        
    ///   @param context - the original context                                
    ///   @param common - the base to operate on                               
    ///   @param verb - the original verb                                      
    ///   @return if at least one of the types matched verb                    
-   template<CT::Data... T>
+   template<OverflowMode MODE, CT::Data... T>
    bool Exponent::OperateOnTypes(const Many& context, const Many& common, Verb& verb) {
-      return ((common.template CastsTo<T, true>()
-         and ArithmeticVerb::Vector<T>(context, common, verb,
-            verb.GetMass() < 0
-               ? [](const T* lhs, const T* rhs) noexcept -> T {
-                  return static_cast<T>(::std::pow(*lhs, T {1} / *rhs));
-               }
-               : [](const T* lhs, const T* rhs) noexcept -> T {
-                  return static_cast<T>(::std::pow(*lhs, *rhs));
-               }
-         )) or ...);
+      if constexpr (MODE == OverflowMode::Wrap) {
+         return ((common.template CastsTo<T, true>()
+            and (verb.GetMass() < 0
+               ? ArithmeticVerb::Vector<T>(context, common, verb,
+                  [](const T* lhs, const T* rhs) noexcept -> T {
+                     return static_cast<T>(::std::pow(*lhs, T {1} / *rhs));
+                  })
+               : ArithmeticVerb::Vector<T>(context, common, verb,
+                  [](const T* lhs, const T* rhs) noexcept -> T {
+                     return static_cast<T>(::std::pow(*lhs, *rhs));
+                  })
+            )) or ...);
+      }
+      else {
+         constexpr bool SATURATE = MODE == OverflowMode::Saturate;
+         return ((common.template CastsTo<T, true>()
+            and (verb.GetMass() < 0
+               ? ArithmeticVerb::Vector<T>(context, common, verb,
+                  [](const T* lhs, const T* rhs, T* out) noexcept {
+                     return Math::RootChecked<SATURATE>(*lhs, *rhs, *out);
+                  })
+               : ArithmeticVerb::Vector<T>(context, common, verb,
+                  [](const T* lhs, const T* rhs, T* out) noexcept {
+                     return Math::PowChecked<SATURATE>(*lhs, *rhs, *out);
+                  })
+            )) or ...);
+      }
    }
 
    /// Default power/root in an immutable context                             
+   ///   @tparam MODE - what to do with results, that don't fit their type    
    ///   @param context - the block to execute in                             
    ///   @param verb - power/root verb                                        
-   inline bool Exponent::ExecuteDefault(const Many& context, Verb& verb) {
+   template<OverflowMode MODE>
+   bool Exponent::ExecuteDefault(const Many& context, Verb& verb) {
       const auto common = context.ReinterpretAs(verb.GetArgument());
       if (common.template CastsTo<A::Number>()) {
-         return OperateOnTypes<
+         return OperateOnTypes<MODE,
             Float, Double,
             int32_t, uint32_t, int64_t, uint64_t,
             int8_t, uint8_t, int16_t, uint16_t
@@ -97,12 +118,14 @@ namespace Langulus::Verbs
    }
 
    /// Default power/root in mutable context                                  
+   ///   @tparam MODE - what to do with results, that don't fit their type    
    ///   @param context - the block to execute in                             
    ///   @param verb - power/root verb                                        
-   inline bool Exponent::ExecuteDefault(Many& context, Verb& verb) {
+   template<OverflowMode MODE>
+   bool Exponent::ExecuteDefault(Many& context, Verb& verb) {
       const auto common = context.ReinterpretAs(verb.GetArgument());
       if (common.template CastsTo<A::Number>()) {
-         return OperateOnTypes<
+         return OperateOnTypes<MODE,
             Float, Double,
             int32_t, uint32_t, int64_t, uint64_t,
             int8_t, uint8_t, int16_t, uint16_t
@@ -112,6 +135,20 @@ namespace Langulus::Verbs
       return false;
    }
 
+   /// Default power/root in an immutable context, wrapping around results    
+   ///   @param context - the block to execute in                             
+   ///   @param verb - power/root verb                                        
+   inline bool Exponent::ExecuteDefault(const Many& context, Verb& verb) {
+      return ExecuteDefault<OverflowMode::Wrap>(context, verb);
+   }
+
+   /// Default power/root in mutable context, wrapping around results         
+   ///   @param context - the block to execute in                             
+   ///   @param verb - power/root verb                                        
+   inline bool Exponent::ExecuteDefault(Many& context, Verb& verb) {
+      return ExecuteDefault<OverflowMode::Wrap>(context, verb);
+   }
+
 } // namespace Langulus::Verbs
 
 #undef VERBOSE_EXP
\ No newline at end of file
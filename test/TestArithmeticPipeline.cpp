@@ -0,0 +1,247 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include <Math/Verbs/ArithmeticPipeline.hpp>
+#include "Common.hpp"
+
+
+/// Execute a chain of verbs one by one, as if it wasn't fused                
+///   @param verb - the last verb in the chain                                
+///   @return the output of the last verb                                     
+Many ExecuteUnfused(const Verb& verb) {
+	const auto& source = verb.GetSource();
+	const Many context = source.GetCount() == 1 and source.CastsTo<Verb, true>()
+		? ExecuteUnfused(source.As<Verb>())
+		: source;
+
+	Verb step = verb;
+	step.GetOutput().Reset();
+	bool done = false;
+	if (verb.IsVerb<Verbs::Add>())
+		done = Verbs::Add::ExecuteDefault(context, step);
+	else if (verb.IsVerb<Verbs::Multiply>())
+		done = Verbs::Multiply::ExecuteDefault(context, step);
+	else if (verb.IsVerb<Verbs::Exponent>())
+		done = Verbs::Exponent::ExecuteDefault(context, step);
+	else if (verb.IsVerb<Verbs::Modulate>())
+		done = Verbs::Modulate::ExecuteDefault(context, step);
+	else if (verb.IsVerb<Verbs::Lerp>())
+		done = Verbs::Lerp::ExecuteDefault(context, step);
+
+	REQUIRE(done);
+	return step.GetOutput();
+}
+
+TEMPLATE_TEST_CASE("Streaming through arithmetic steps", "[verbs]", REAL_TYPES, ::std::int32_t, ::std::uint8_t, ::std::int64_t) {
+	using T = TestType;
+
+	GIVEN("Numbers, that don't fill a whole block, and a few steps") {
+		constexpr Count count = 1024 / sizeof(T) * 2 + 3;
+		T input[count], a[count], b[count], output[count];
+		for (Offset i = 0; i < count; ++i) {
+			input[i] = T(i % 11 + 1);
+			a[i] = T(i % 5 + 1);
+			b[i] = T(i % 7);
+		}
+
+		const T two = 2;
+		const TArithmeticStep<T> steps[] {
+			{ArithmeticOp::Multiply, a, false},
+			{ArithmeticOp::Add, b, false},
+			{ArithmeticOp::Modulate, &two, true},
+			{ArithmeticOp::Exponent, &two, true},
+			{ArithmeticOp::Divide, a, false}
+		};
+
+		WHEN("Streamed") {
+			ArithmeticPipeline::Stream(input, steps, 5, output, count);
+
+			THEN("Results match applying the steps one by one") {
+				for (Offset i = 0; i < count; ++i) {
+					T expected = input[i] * a[i] + b[i];
+					expected = Math::Mod(expected, two);
+					expected = static_cast<T>(::std::pow(expected, two));
+					expected = expected / a[i];
+					REQUIRE(output[i] == expected);
+				}
+			}
+		}
+
+		WHEN("Streamed in place") {
+			ArithmeticPipeline::Stream(input, steps, 5, output, count);
+			ArithmeticPipeline::Stream(input, steps, 5, input, count);
+
+			THEN("Results are the same") {
+				for (Offset i = 0; i < count; ++i)
+					REQUIRE(input[i] == output[i]);
+			}
+		}
+	}
+}
+
+SCENARIO("Fusing chains of arithmetic verbs", "[verbs]") {
+	GIVEN("The chain a * b + c, over containers of the same length") {
+		TMany<Float> a, b, c;
+		for (int i = 0; i < 100; ++i) {
+			a << Float(i);
+			b << Float(i % 3);
+			c << Float(-i);
+		}
+
+		Verbs::Add add {c};
+		add.SetSource(Verbs::Multiply {b}.SetSource(a));
+
+		WHEN("Recognized") {
+			const ArithmeticPipeline pipeline {add};
+
+			THEN("Both verbs are fused, in the order they execute") {
+				REQUIRE(pipeline.IsFused());
+				REQUIRE(pipeline.GetSteps().GetCount() == 2);
+				REQUIRE(pipeline.GetSteps()[0].mOp == ArithmeticOp::Multiply);
+				REQUIRE(pipeline.GetSteps()[1].mOp == ArithmeticOp::Add);
+			}
+		}
+
+		WHEN("Executed") {
+			const auto unfused = ExecuteUnfused(add);
+			const ArithmeticPipeline pipeline {add};
+			REQUIRE(pipeline.Execute(add));
+
+			THEN("The last verb outputs the result of the whole chain") {
+				const auto& output = add.GetOutput();
+				REQUIRE(output.GetCount() == 100);
+				for (Offset i = 0; i < 100; ++i)
+					REQUIRE(output.GetRaw<Float>()[i] == a[i] * b[i] + c[i]);
+			}
+
+			THEN("The result matches executing the verbs one by one") {
+				const auto& output = add.GetOutput();
+				REQUIRE(unfused.GetCount() == 100);
+				for (Offset i = 0; i < 100; ++i)
+					REQUIRE(output.GetRaw<Float>()[i] == unfused.GetRaw<Float>()[i]);
+			}
+		}
+	}
+
+	GIVEN("The chain a - b, where b is a single number") {
+		TMany<Float> a;
+		for (int i = 0; i < 10; ++i)
+			a << Float(i);
+
+		Verbs::Add sub {Float(2)};
+		sub.SetSource(Verbs::Multiply {Float(4)}.SetSource(a)).SetMass(-1);
+
+		WHEN("Executed") {
+			const ArithmeticPipeline pipeline {sub};
+			REQUIRE(pipeline.Execute(sub));
+
+			THEN("The single number is used for all elements") {
+				const auto& output = sub.GetOutput();
+				REQUIRE(output.GetCount() == 10);
+				for (Offset i = 0; i < 10; ++i)
+					REQUIRE(output.GetRaw<Float>()[i] == a[i] * 4 - 2);
+			}
+
+			THEN("The result matches executing the verbs one by one") {
+				// Verbs don't broadcast, so repeat the numbers for them   
+				TMany<Float> fours, twos;
+				for (int i = 0; i < 10; ++i) {
+					fours << Float(4);
+					twos << Float(2);
+				}
+
+				Verbs::Add reference {twos};
+				reference.SetSource(Verbs::Multiply {fours}.SetSource(a)).SetMass(-1);
+				const auto unfused = ExecuteUnfused(reference);
+				const auto& output = sub.GetOutput();
+				REQUIRE(unfused.GetCount() == 10);
+				for (Offset i = 0; i < 10; ++i)
+					REQUIRE(output.GetRaw<Float>()[i] == unfused.GetRaw<Float>()[i]);
+			}
+		}
+	}
+
+	GIVEN("The chain a + b, lerped by c and modulated by d") {
+		TMany<Float> a, b, c, d;
+		for (int i = 0; i < 100; ++i) {
+			a << Float(i) * Float(0.5) + 1;
+			b << Float(i % 3 + 1);
+			c << Float(i % 4) + Float(1.5);
+			d << Float(i % 2) + Float(2.5);
+		}
+
+		Verbs::Modulate mod {d};
+		mod.SetSource(Verbs::Lerp {c}.SetSource(Verbs::Add {b}.SetSource(a)));
+
+		WHEN("Executed") {
+			const auto unfused = ExecuteUnfused(mod);
+			const ArithmeticPipeline pipeline {mod};
+			REQUIRE(pipeline.GetSteps().GetCount() == 3);
+			REQUIRE(pipeline.GetSteps()[1].mOp == ArithmeticOp::Lerp);
+			REQUIRE(pipeline.Execute(mod));
+
+			THEN("The result matches executing the verbs one by one") {
+				const auto& output = mod.GetOutput();
+				REQUIRE(output.GetCount() == 100);
+				REQUIRE(unfused.GetCount() == 100);
+				for (Offset i = 0; i < 100; ++i)
+					REQUIRE(output.GetRaw<Float>()[i] == unfused.GetRaw<Float>()[i]);
+			}
+		}
+	}
+
+	GIVEN("The chain (a - b) ^ c, over integers") {
+		TMany<int32_t> a, b, c;
+		for (int i = 0; i < 100; ++i) {
+			a << int32_t(i % 13);
+			b << int32_t(i % 5);
+			c << int32_t(i % 4);
+		}
+
+		Verbs::Exponent exp {c};
+		exp.SetSource(Verbs::Add {b}.SetSource(a).SetMass(-1));
+
+		WHEN("Executed") {
+			const auto unfused = ExecuteUnfused(exp);
+			const ArithmeticPipeline pipeline {exp};
+			REQUIRE(pipeline.GetSteps().GetCount() == 2);
+			REQUIRE(pipeline.GetSteps()[0].mOp == ArithmeticOp::Subtract);
+			REQUIRE(pipeline.Execute(exp));
+
+			THEN("The result matches executing the verbs one by one") {
+				const auto& output = exp.GetOutput();
+				REQUIRE(output.GetCount() == 100);
+				REQUIRE(unfused.GetCount() == 100);
+				for (Offset i = 0; i < 100; ++i)
+					REQUIRE(output.GetRaw<int32_t>()[i] == unfused.GetRaw<int32_t>()[i]);
+			}
+		}
+	}
+
+	GIVEN("Chains, that can't be fused") {
+		TMany<Float> a, b;
+		for (int i = 0; i < 10; ++i) {
+			a << Float(i);
+			b << Float(i);
+		}
+		b << Float(10);
+
+		THEN("A single verb isn't fused") {
+			Verbs::Add add {a};
+			add.SetSource(a);
+			REQUIRE_FALSE(ArithmeticPipeline {add}.IsFused());
+		}
+
+		THEN("Operands of different lengths aren't executed") {
+			Verbs::Add add {b};
+			add.SetSource(Verbs::Multiply {a}.SetSource(a));
+			const ArithmeticPipeline pipeline {add};
+			REQUIRE(pipeline.IsFused());
+			REQUIRE_FALSE(pipeline.Execute(add));
+		}
+	}
+}
\ No newline at end of file
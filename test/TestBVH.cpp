@@ -0,0 +1,213 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include <Math/BVH.hpp>
+#include "Common.hpp"
+
+
+/// Brute-force ray versus box, returns entry distance or -1 on a miss        
+template<class T>
+T RayVersusBox(const TRange<TVector<T, 3>>& box, const TRay<TVector<T, 3>>& ray) {
+	T enter = 0, exit = ::std::numeric_limits<T>::infinity();
+	for (Offset c = 0; c < 3; ++c) {
+		const T a = (box.mMin[c] - ray.mOrigin[c]) / ray.mNormal[c];
+		const T b = (box.mMax[c] - ray.mOrigin[c]) / ray.mNormal[c];
+		enter = ::std::max(enter, ::std::min(a, b));
+		exit = ::std::min(exit, ::std::max(a, b));
+	}
+	return enter <= exit ? enter : T(-1);
+}
+
+/// Brute-force distance from a point to a box                                
+template<class T>
+T PointVersusBox(const TRange<TVector<T, 3>>& box, const TVector<T, 3>& point) {
+	T result = 0;
+	for (Offset c = 0; c < 3; ++c) {
+		const T d = ::std::max({box.mMin[c] - point[c], point[c] - box.mMax[c], T(0)});
+		result += d * d;
+	}
+	return ::std::sqrt(result);
+}
+
+TEMPLATE_TEST_CASE("Bounding volume hierarchy", "[bvh]", REAL_TYPES) {
+	using T = TestType;
+	using V = TVector<T, 3>;
+	using R = TRange<V>;
+	using B = TBVH<V>;
+
+	// Deterministic pseudo-random numbers in [0; 1)                       
+	::std::uint32_t seed = 12345;
+	const auto random = [&] {
+		seed = seed * 1664525u + 1013904223u;
+		return T(seed >> 8) / T(1 << 24);
+	};
+
+	const auto scatter = [&](Count count) {
+		TMany<R> boxes;
+		for (Count i = 0; i < count; ++i) {
+			const V center {random() * 100 - 50, random() * 100 - 50, random() * 100 - 50};
+			const V extent {random() + T(0.1), random() + T(0.1), random() + T(0.1)};
+			boxes << R {center - extent, center + extent};
+		}
+		return boxes;
+	};
+
+	const auto check = [&](const B& bvh, const TMany<R>& boxes) {
+		REQUIRE(bvh.GetPrimitiveCount() == boxes.GetCount());
+		REQUIRE(bvh.GetDepth() <= B::MaxDepth);
+
+		// Every primitive is referenced exactly once                    
+		::std::vector<int> seen(boxes.GetCount());
+		for (Offset i = 0; i < bvh.GetPrimitiveCount(); ++i)
+			++seen[bvh.GetIndices()[i]];
+		for (auto s : seen)
+			REQUIRE(s == 1);
+
+		// Every node contains its children                              
+		for (Offset n = 0; n < bvh.GetNodeCount(); ++n) {
+			const auto& node = bvh.GetNodes()[n];
+			if (node.IsLeaf())
+				continue;
+			for (auto child : {n + 1, Offset {node.mOffset}}) {
+				for (Offset c = 0; c < 3; ++c) {
+					REQUIRE(bvh.GetNodes()[child].mBounds.mMin[c] >= node.mBounds.mMin[c]);
+					REQUIRE(bvh.GetNodes()[child].mBounds.mMax[c] <= node.mBounds.mMax[c]);
+				}
+			}
+		}
+
+		// Rays                                                          
+		for (int r = 0; r < 32; ++r) {
+			const TRay<V> ray {
+				V {random() * 120 - 60, random() * 120 - 60, -80},
+				V {random() - T(0.5), random() - T(0.5), T(1)}
+			};
+
+			const auto hit = bvh.Raycast(ray, [&](Offset i, const TRay<V>& ray) {
+				return RayVersusBox(boxes[i], ray);
+			});
+
+			T closest = ::std::numeric_limits<T>::infinity();
+			for (Offset i = 0; i < boxes.GetCount(); ++i) {
+				const T d = RayVersusBox(boxes[i], ray);
+				if (d >= 0 and d < closest)
+					closest = d;
+			}
+
+			REQUIRE(bool(hit) == (closest != ::std::numeric_limits<T>::infinity()));
+			if (hit)
+				REQUIRE(hit.mDistance == closest);
+		}
+
+		// Box overlaps                                                  
+		for (int q = 0; q < 16; ++q) {
+			const V center {random() * 100 - 50, random() * 100 - 50, random() * 100 - 50};
+			const R query {center - 5, center + 5};
+
+			::std::vector<int> found(boxes.GetCount());
+			bvh.Overlap(query, [&](Offset i) { ++found[i]; });
+
+			for (Offset i = 0; i < boxes.GetCount(); ++i) {
+				bool overlaps = true;
+				for (Offset c = 0; c < 3; ++c)
+					overlaps &= boxes[i].mMin[c] <= query.mMax[c] and boxes[i].mMax[c] >= query.mMin[c];
+				REQUIRE(found[i] == int(overlaps));
+			}
+		}
+
+		// Nearest primitive                                             
+		for (int q = 0; q < 16; ++q) {
+			const V point {random() * 140 - 70, random() * 140 - 70, random() * 140 - 70};
+			const auto nearest = bvh.Nearest(point, [&](Offset i, const V& p) {
+				return PointVersusBox(boxes[i], p);
+			});
+
+			T closest = ::std::numeric_limits<T>::infinity();
+			for (Offset i = 0; i < boxes.GetCount(); ++i)
+				closest = ::std::min(closest, PointVersusBox(boxes[i], point));
+
+			REQUIRE(nearest);
+			REQUIRE(nearest.mDistance == closest);
+		}
+
+		// Frustum culling                                               
+		TFrustum<V> frustum;
+		frustum.mPlanes[0] = TPlane<V>(V {-1, 0, 0}, -20);
+		frustum.mPlanes[1] = TPlane<V>(V { 1, 0, 0}, -10);
+		frustum.mPlanes[2] = TPlane<V>(V { 0, 1, 0}, -25);
+		frustum.mPlanes[3] = TPlane<V>(V { 0,-1, 0}, -5);
+		frustum.mPlanes[4] = TPlane<V>(V { 1, 1, 1}, -30);
+		frustum.mPlanes[5] = TPlane<V>(V { 0, 0, 1}, -40);
+
+		::std::vector<int> visible(boxes.GetCount());
+		bvh.Cull(frustum, [&](Offset i) { ++visible[i]; });
+		for (Offset i = 0; i < boxes.GetCount(); ++i) {
+			bool expected = true;
+			for (Offset p = 0; p < 6; ++p)
+				expected &= frustum.Classify(p, boxes[i]) != TFrustum<V>::Side::Outside;
+			REQUIRE(visible[i] == int(expected));
+		}
+	};
+
+	GIVEN("A hierarchy built on a single thread") {
+		auto boxes = scatter(1000);
+		B bvh {boxes, 1};
+		check(bvh, boxes);
+
+		WHEN("Primitives are moved, and the hierarchy is refit") {
+			for (auto& box : boxes) {
+				const V offset {random() * 4 - 2, random() * 4 - 2, random() * 4 - 2};
+				box = R {box.mMin + offset, box.mMax + offset};
+			}
+			bvh.Refit(boxes, 1);
+			check(bvh, boxes);
+		}
+	}
+
+	GIVEN("A hierarchy built on multiple threads") {
+		auto boxes = scatter(B::ParallelThreshold * 4);
+		B bvh {boxes, 4};
+		check(bvh, boxes);
+
+		WHEN("Primitives are moved, and the hierarchy is refit on multiple threads") {
+			for (auto& box : boxes) {
+				const V offset {random() * 4 - 2, random() * 4 - 2, random() * 4 - 2};
+				box = R {box.mMin + offset, box.mMax + offset};
+			}
+			bvh.Refit(boxes, 4);
+			check(bvh, boxes);
+		}
+	}
+
+	GIVEN("A hierarchy, whose subtrees split again on worker threads") {
+		// Eight threads split the root, and then each of its halves     
+		auto boxes = scatter(B::ParallelThreshold * 8);
+		B parallel {boxes, 8};
+		B serial {boxes, 1};
+		check(parallel, boxes);
+
+		// Partitioning doesn't depend on threads, so neither do nodes   
+		REQUIRE(parallel.GetNodeCount() == serial.GetNodeCount());
+		for (Offset n = 0; n < serial.GetNodeCount(); ++n) {
+			const auto& p = parallel.GetNodes()[n];
+			const auto& s = serial.GetNodes()[n];
+			REQUIRE(p.mOffset == s.mOffset);
+			REQUIRE(p.mCount == s.mCount);
+			REQUIRE(p.mBounds.mMin == s.mBounds.mMin);
+			REQUIRE(p.mBounds.mMax == s.mBounds.mMax);
+		}
+		for (Offset i = 0; i < serial.GetPrimitiveCount(); ++i)
+			REQUIRE(parallel.GetIndices()[i] == serial.GetIndices()[i]);
+	}
+
+	GIVEN("An empty hierarchy") {
+		B bvh;
+		REQUIRE(bvh.IsEmpty());
+		REQUIRE_FALSE(bvh.Raycast(TRay<V> {V {0}, V {0, 0, 1}}, [](Offset, const TRay<V>&) { return T(0); }));
+		REQUIRE_FALSE(bvh.Nearest(V {0}, [](Offset, const V&) { return T(0); }));
+	}
+}
\ No newline at end of file
@@ -215,3 +215,186 @@ SCENARIO("Parsing scripts", "[code]") {
       }
    }
 }
+
+/// The output of a checked arithmetic verb - the result, followed by the     
+/// number of elements, that didn't fit their type                            
+///   @param result - the expected result                                     
+///   @param overflows - the expected number of overflows                     
+///   @return the expected output                                             
+Many CheckedOutput(const Many& result, Count overflows) {
+   Verb expected;
+   expected << Many {result};
+   expected << Traits::Overflow {overflows};
+   return expected.GetOutput();
+}
+
+SCENARIO("Arithmetic verbs, that overflow", "[verbs]") {
+   GIVEN("Additions and subtractions of bytes") {
+      const Many lhs = Many::Wrap<int8_t>(100, -100, 1);
+      const Many rhs = Many::Wrap<int8_t>(100, -100, 2);
+
+      WHEN("Added with saturation") {
+         Verbs::Add add {rhs};
+         REQUIRE(Verbs::Add::ExecuteDefault<OverflowMode::Saturate>(lhs, add));
+
+         THEN("Results are clamped, and overflows are counted") {
+            REQUIRE(add.GetOutput() == CheckedOutput(
+               Many::Wrap<int8_t>(127, -128, 3), 2));
+            REQUIRE(lhs == Many::Wrap<int8_t>(100, -100, 1));
+         }
+      }
+
+      WHEN("Added with checks") {
+         Verbs::Add add {rhs};
+         REQUIRE(Verbs::Add::ExecuteDefault<OverflowMode::Check>(lhs, add));
+
+         THEN("Results wrap around, and overflows are counted") {
+            REQUIRE(add.GetOutput() == CheckedOutput(
+               Many::Wrap<int8_t>(-56, 56, 3), 2));
+         }
+      }
+
+      WHEN("Subtracted with saturation") {
+         Verbs::Add sub {Many::Wrap<int8_t>(-100, 100, 2)};
+         sub.SetMass(-1);
+         REQUIRE(Verbs::Add::ExecuteDefault<OverflowMode::Saturate>(lhs, sub));
+
+         THEN("Results are clamped, and overflows are counted") {
+            REQUIRE(sub.GetOutput() == CheckedOutput(
+               Many::Wrap<int8_t>(127, -128, -1), 2));
+         }
+      }
+
+      WHEN("Added in place with saturation") {
+         Many context = Many::Wrap<int8_t>(100, -100, 1);
+         Verbs::Add add {rhs};
+         REQUIRE(Verbs::Add::ExecuteDefault<OverflowMode::Saturate>(context, add));
+
+         THEN("The context is clamped, and overflows are counted") {
+            REQUIRE(context == Many::Wrap<int8_t>(127, -128, 3));
+            REQUIRE(add.GetOutput() == CheckedOutput(context, 2));
+         }
+      }
+
+      WHEN("Added in place with checks") {
+         Many context = Many::Wrap<int8_t>(100, -100, 1);
+         Verbs::Add add {rhs};
+         REQUIRE(Verbs::Add::ExecuteDefault<OverflowMode::Check>(context, add));
+
+         THEN("The context wraps around, and overflows are counted") {
+            REQUIRE(context == Many::Wrap<int8_t>(-56, 56, 3));
+            REQUIRE(add.GetOutput() == CheckedOutput(context, 2));
+         }
+      }
+   }
+
+   GIVEN("Multiplications and divisions of integers") {
+      const Many lhs = Many::Wrap<int8_t>(16, -16, 3);
+      const Many rhs = Many::Wrap<int8_t>(16, 16, 3);
+      const Many dividend = Many::Wrap<int32_t>(10, -10, 0, 9, ::std::numeric_limits<int32_t>::lowest());
+      const Many divisor  = Many::Wrap<int32_t>(0, 0, 0, 3, -1);
+
+      WHEN("Multiplied with saturation") {
+         Verbs::Multiply mul {rhs};
+         REQUIRE(Verbs::Multiply::ExecuteDefault<OverflowMode::Saturate>(lhs, mul));
+
+         THEN("Results are clamped, and overflows are counted") {
+            REQUIRE(mul.GetOutput() == CheckedOutput(
+               Many::Wrap<int8_t>(127, -128, 9), 2));
+         }
+      }
+
+      WHEN("Multiplied with checks, in a mutable context") {
+         Many context = Many::Wrap<int8_t>(16, -16, 3);
+         Verbs::Multiply mul {rhs};
+         REQUIRE(Verbs::Multiply::ExecuteDefault<OverflowMode::Check>(context, mul));
+
+         THEN("Results wrap around, and overflows are counted") {
+            REQUIRE(mul.GetOutput() == CheckedOutput(
+               Many::Wrap<int8_t>(0, 0, 9), 2));
+         }
+      }
+
+      WHEN("Divided by zero with saturation") {
+         Verbs::Multiply div {divisor};
+         div.SetMass(-1);
+         REQUIRE(Verbs::Multiply::ExecuteDefault<OverflowMode::Saturate>(dividend, div));
+
+         THEN("Results are clamped by the sign of the dividend") {
+            REQUIRE(div.GetOutput() == CheckedOutput(Many::Wrap<int32_t>(
+               ::std::numeric_limits<int32_t>::max(),
+               ::std::numeric_limits<int32_t>::lowest(),
+               0, 3,
+               ::std::numeric_limits<int32_t>::max()
+            ), 4));
+         }
+      }
+
+      WHEN("Divided by zero with checks, in a mutable context") {
+         Many context = dividend;
+         Verbs::Multiply div {divisor};
+         div.SetMass(-1);
+         REQUIRE(Verbs::Multiply::ExecuteDefault<OverflowMode::Check>(context, div));
+
+         THEN("Divisions by zero result in zero") {
+            REQUIRE(div.GetOutput() == CheckedOutput(Many::Wrap<int32_t>(
+               0, 0, 0, 3,
+               ::std::numeric_limits<int32_t>::lowest()
+            ), 4));
+         }
+      }
+   }
+
+   GIVEN("Powers and roots of integers") {
+      const Many base = Many::Wrap<int32_t>(2, -3, 10);
+      const Many power = Many::Wrap<int32_t>(10, 3, 10);
+      const Many radicand = Many::Wrap<int32_t>(27, -27, 17, -4, 5);
+      const Many degree = Many::Wrap<int32_t>(3, 3, 2, 2, 0);
+
+      WHEN("Raised with saturation") {
+         Verbs::Exponent exp {power};
+         REQUIRE(Verbs::Exponent::ExecuteDefault<OverflowMode::Saturate>(base, exp));
+
+         THEN("Results are clamped, and overflows are counted") {
+            REQUIRE(exp.GetOutput() == CheckedOutput(Many::Wrap<int32_t>(
+               1024, -27, ::std::numeric_limits<int32_t>::max()
+            ), 1));
+         }
+      }
+
+      WHEN("Raised with checks, in a mutable context") {
+         Many context = base;
+         Verbs::Exponent exp {power};
+         REQUIRE(Verbs::Exponent::ExecuteDefault<OverflowMode::Check>(context, exp));
+
+         THEN("Results wrap around, and overflows are counted") {
+            REQUIRE(exp.GetOutput() == CheckedOutput(
+               Many::Wrap<int32_t>(1024, -27, 1410065408), 1));
+         }
+      }
+
+      WHEN("Rooted with saturation") {
+         Verbs::Exponent root {degree};
+         root.SetMass(-1);
+         REQUIRE(Verbs::Exponent::ExecuteDefault<OverflowMode::Saturate>(radicand, root));
+
+         THEN("Roots are exact, and the ones that don't exist are counted") {
+            REQUIRE(root.GetOutput() == CheckedOutput(Many::Wrap<int32_t>(
+               3, -3, 4, 0, ::std::numeric_limits<int32_t>::max()
+            ), 2));
+         }
+      }
+
+      WHEN("Rooted with checks, in a mutable context") {
+         Many context = radicand;
+         Verbs::Exponent root {degree};
+         root.SetMass(-1);
+         REQUIRE(Verbs::Exponent::ExecuteDefault<OverflowMode::Check>(context, root));
+
+         THEN("Roots are exact, and the ones that don't exist are counted") {
+            REQUIRE(root.GetOutput() == CheckedOutput(
+               Many::Wrap<int32_t>(3, -3, 4, 0, 0), 2));
+         }
+      }
+   }
+}
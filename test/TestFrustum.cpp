@@ -0,0 +1,152 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include <Math/Primitives/FrustumCuller.hpp>
+#include <Math/VectorStream.hpp>
+#include "Common.hpp"
+
+
+TEMPLATE_TEST_CASE("Frustum culling", "[frustum][stream]", REAL_TYPES) {
+	using T = TestType;
+	using V = TVector<T, 3>;
+	using F = TFrustum<V>;
+	using Stream = typename F::StreamType;
+
+	GIVEN("A box-shaped frustum, and a lot of volumes around it") {
+		// A volume is outside a plane, when n * p + d > 0                 
+		F frustum;
+		frustum.mPlanes[F::Left]   = TPlane<V>(V {-1, 0, 0}, -1);
+		frustum.mPlanes[F::Right]  = TPlane<V>(V { 1, 0, 0}, -1);
+		frustum.mPlanes[F::Top]    = TPlane<V>(V { 0, 1, 0}, -1);
+		frustum.mPlanes[F::Bottom] = TPlane<V>(V { 0,-1, 0}, -1);
+		frustum.mPlanes[F::Near]   = TPlane<V>(V { 0, 0,-1}, -1);
+		frustum.mPlanes[F::Far]    = TPlane<V>(V { 0, 0, 1}, -1);
+
+		// Odd count, so that full blocks, partial mask words, and a     
+		// partial block at the end are all exercised                    
+		constexpr Count count = 64 * 2 + Stream::Block + 5;
+		TMany<V> mins, maxs, centers;
+		TVectorStream<T, 1> radii {count};
+		for (Count i = 0; i < count; ++i) {
+			// Scatter the volumes on a line that crosses the frustum   
+			const T x = T(int(i % 23) - 11) * T(0.25);
+			const V center {x, T(int(i % 7) - 3) * T(0.5), 0};
+			const V extent {T(0.1) * T(i % 3), T(0.2), T(0.2)};
+			mins << center - extent;
+			maxs << center + extent;
+			centers << center;
+			radii.GetLane(0)[i] = T(0.1) * T(i % 4);
+		}
+
+		const Stream minStream {mins};
+		const Stream maxStream {maxs};
+		const Stream centerStream {centers};
+
+		WHEN("Culling axis-aligned boxes") {
+			typename F::MaskType mask[F::GetMaskSize(count)];
+			for (auto& word : mask)
+				word = ~typename F::MaskType {};
+			frustum.Cull(minStream, maxStream, mask);
+
+			for (Offset i = 0; i < count; ++i) {
+				const bool visible = (mask[i / 64] >> (i % 64)) & 1;
+				REQUIRE(visible == frustum.Intersects(TRange<V> {mins[i], maxs[i]}));
+			}
+
+			// Bits past the count must remain cleared                    
+			REQUIRE((mask[F::GetMaskSize(count) - 1] >> (count % 64)) == 0);
+		}
+
+		WHEN("Culling bounding spheres") {
+			typename F::MaskType mask[F::GetMaskSize(count)];
+			frustum.Cull(centerStream, radii, mask);
+
+			for (Offset i = 0; i < count; ++i) {
+				const bool visible = (mask[i / 64] >> (i % 64)) & 1;
+				bool expected = true;
+				for (auto& plane : frustum.mPlanes)
+					expected &= plane.mNormal.Dot(centers[i]) + plane.mOffset <= radii.GetLane(0)[i];
+				REQUIRE(visible == expected);
+			}
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE("Stateful frustum culling", "[frustum]", REAL_TYPES) {
+	using T = TestType;
+	using V = TVector<T, 3>;
+	using F = TFrustum<V>;
+	using C = TFrustumCuller<V>;
+	using R = TRange<V>;
+
+	GIVEN("A culler for a box-shaped frustum") {
+		F frustum;
+		frustum.mPlanes[F::Left]   = TPlane<V>(V {-1, 0, 0}, -1);
+		frustum.mPlanes[F::Right]  = TPlane<V>(V { 1, 0, 0}, -1);
+		frustum.mPlanes[F::Top]    = TPlane<V>(V { 0, 1, 0}, -1);
+		frustum.mPlanes[F::Bottom] = TPlane<V>(V { 0,-1, 0}, -1);
+		frustum.mPlanes[F::Near]   = TPlane<V>(V { 0, 0,-1}, -1);
+		frustum.mPlanes[F::Far]    = TPlane<V>(V { 0, 0, 1}, -1);
+
+		constexpr Count count = 100;
+		TMany<R> boxes;
+		for (Count i = 0; i < count; ++i) {
+			const V center {T(int(i % 13) - 6) * T(0.3), T(int(i % 5) - 2) * T(0.6), 0};
+			const V extent {T(0.1) * T(i % 3), T(0.2), T(0.2)};
+			boxes << R {center - extent, center + extent};
+		}
+
+		C culler {frustum, count};
+		REQUIRE(culler.GetCount() == count);
+
+		WHEN("Culling the same boxes over several frames") {
+			for (int frame = 0; frame < 3; ++frame) {
+				typename F::MaskType mask[F::GetMaskSize(count)];
+				culler.Cull(boxes.GetRaw(), count, mask);
+
+				for (Offset i = 0; i < count; ++i) {
+					const bool visible = (mask[i / 64] >> (i % 64)) & 1;
+					REQUIRE(visible == frustum.Intersects(boxes[i]));
+				}
+			}
+		}
+
+		WHEN("Moving the frustum away, after the planes were remembered") {
+			for (Offset i = 0; i < count; ++i)
+				(void) culler.Cull(i, boxes[i]);
+
+			F moved = frustum;
+			for (auto& plane : moved.mPlanes)
+				plane.mOffset += plane.mNormal[0] * T(-0.7);
+			culler.SetFrustum(moved);
+
+			for (Offset i = 0; i < count; ++i)
+				REQUIRE(culler.Cull(i, boxes[i]) == moved.Intersects(boxes[i]));
+		}
+
+		WHEN("Culling a hierarchy of boxes") {
+			typename C::PlaneMask inside = 0;
+			REQUIRE(culler.Cull(0, R {V {-T(0.5)}, V {T(0.5)}}, inside));
+			REQUIRE(inside == C::AllPlanes);
+
+			// A child of a fully inside box is never tested             
+			typename C::PlaneMask childInside = inside;
+			REQUIRE(culler.Cull(1, R {V {T(0.1)}, V {T(0.2)}}, childInside));
+
+			// A box crossing the right plane is inside all others       
+			inside = 0;
+			REQUIRE(culler.Cull(2, R {V {T(0.5), 0, 0}, V {T(1.5), T(0.5), T(0.5)}}, inside));
+			REQUIRE(inside == (C::AllPlanes & ~(1 << F::Right)));
+
+			// So its child is only tested against the right plane       
+			childInside = inside;
+			REQUIRE_FALSE(culler.Cull(3, R {V {T(1.2), 0, 0}, V {T(1.4), T(0.5), T(0.5)}}, childInside));
+			childInside = inside;
+			REQUIRE(culler.Cull(3, R {V {T(0.6), 0, 0}, V {T(1.4), T(0.5), T(0.5)}}, childInside));
+		}
+	}
+}
\ No newline at end of file
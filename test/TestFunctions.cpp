@@ -6,6 +6,7 @@
 /// SPDX-License-Identifier: GPL-3.0-or-later                                 
 ///                                                                           
 #include <Math/Number.hpp>
+#include <Math/Vector.hpp>
 #include "Common.hpp"
 
 
@@ -164,6 +165,18 @@ TEMPLATE_TEST_CASE("Lerp 1D - Real", "[arithmetics]", REAL_TYPES) {
 	REQUIRE(Lerp(T(666), T(666), T(555.5)) == Approx(666));
 }
 
+TEMPLATE_TEST_CASE("Fast trigonometry - Real", "[arithmetics]", REAL_TYPES) {
+	using T = TestType;
+	for (int i = -100; i <= 100; ++i) {
+		const T x = T(i) / T(100);
+		REQUIRE(FastAcos(x) == Approx(::std::acos(x)).margin(0.00007));
+
+		const T a = x * PI<T> * T(2);
+		REQUIRE(FastSin(a) == Approx(::std::sin(a)).margin(0.00001));
+		REQUIRE(FastCos(a) == Approx(::std::cos(a)).margin(0.00001));
+	}
+}
+
 TEMPLATE_TEST_CASE("Frac 1D - Unsigned Integers", "[arithmetics]", UNSIGNED_TYPES) {
 	using T = TestType;
 	REQUIRE(Frac(T(0)) == 0);
@@ -352,6 +365,128 @@ TEMPLATE_TEST_CASE("Distance 1D - Reals", "[arithmetics]", REAL_TYPES) {
 	REQUIRE(Distance(T(-7), T(5)) == 12);
 }
 
+TEMPLATE_TEST_CASE("Checked arithmetic - Unsigned", "[arithmetics]", UNSIGNED_TYPES) {
+	using T = TestType;
+	constexpr T Max = ::std::numeric_limits<T>::max();
+	T r;
+	REQUIRE_FALSE(AddChecked<false>(T(2), T(3), r));
+	REQUIRE(r == 5);
+	REQUIRE(AddChecked<false>(Max, T(2), r));
+	REQUIRE(r == 1);
+	REQUIRE(AddChecked<true>(Max, T(2), r));
+	REQUIRE(r == Max);
+	REQUIRE(SubChecked<false>(T(2), T(3), r));
+	REQUIRE(r == Max);
+	REQUIRE(SubChecked<true>(T(2), T(3), r));
+	REQUIRE(r == 0);
+	REQUIRE_FALSE(MulChecked<true>(T(15), T(17), r));
+	REQUIRE(r == 255);
+	REQUIRE(MulChecked<true>(Max, T(2), r));
+	REQUIRE(r == Max);
+	REQUIRE(DivChecked<true>(T(5), T(0), r));
+	REQUIRE(r == Max);
+	REQUIRE_FALSE(PowChecked<true>(T(2), T(7), r));
+	REQUIRE(r == 128);
+	REQUIRE(PowChecked<false>(T(2), T(sizeof(T) * 8), r));
+	REQUIRE(r == 0);
+	REQUIRE(PowChecked<true>(T(3), T(sizeof(T) * 8), r));
+	REQUIRE(r == Max);
+	REQUIRE_FALSE(RootChecked<true>(T(125), T(3), r));
+	REQUIRE(r == 5);
+	REQUIRE_FALSE(RootChecked<true>(T(124), T(3), r));
+	REQUIRE(r == 4);
+	REQUIRE_FALSE(RootChecked<true>(Max, T(1), r));
+	REQUIRE(r == Max);
+	REQUIRE_FALSE(RootChecked<true>(Max, T(sizeof(T) * 8), r));
+	REQUIRE(r == 1);
+	REQUIRE(RootChecked<false>(T(5), T(0), r));
+	REQUIRE(r == 0);
+	REQUIRE(RootChecked<true>(T(5), T(0), r));
+	REQUIRE(r == Max);
+}
+
+TEMPLATE_TEST_CASE("Checked arithmetic - Signed", "[arithmetics]", SIGNED_INTEGER_TYPES) {
+	using T = TestType;
+	constexpr T Max = ::std::numeric_limits<T>::max();
+	constexpr T Min = ::std::numeric_limits<T>::lowest();
+	T r;
+	REQUIRE_FALSE(AddChecked<true>(T(-2), T(3), r));
+	REQUIRE(r == 1);
+	REQUIRE(AddChecked<false>(Max, T(1), r));
+	REQUIRE(r == Min);
+	REQUIRE(AddChecked<true>(Max, T(1), r));
+	REQUIRE(r == Max);
+	REQUIRE(AddChecked<true>(Min, T(-1), r));
+	REQUIRE(r == Min);
+	REQUIRE(SubChecked<true>(Min, T(1), r));
+	REQUIRE(r == Min);
+	REQUIRE(SubChecked<true>(T(0), Min, r));
+	REQUIRE(r == Max);
+	REQUIRE_FALSE(MulChecked<true>(T(-11), T(11), r));
+	REQUIRE(r == -121);
+	REQUIRE(MulChecked<true>(Min, T(-1), r));
+	REQUIRE(r == Max);
+	REQUIRE(MulChecked<true>(Max, T(-2), r));
+	REQUIRE(r == Min);
+	REQUIRE(DivChecked<false>(Min, T(-1), r));
+	REQUIRE(r == Min);
+	REQUIRE(DivChecked<true>(Min, T(-1), r));
+	REQUIRE(r == Max);
+	REQUIRE(DivChecked<true>(T(-5), T(0), r));
+	REQUIRE(r == Min);
+	REQUIRE_FALSE(PowChecked<true>(T(-2), T(5), r));
+	REQUIRE(r == -32);
+	REQUIRE_FALSE(PowChecked<true>(T(-1), T(-3), r));
+	REQUIRE(r == -1);
+	REQUIRE_FALSE(PowChecked<true>(T(5), T(-1), r));
+	REQUIRE(r == 0);
+	REQUIRE(PowChecked<true>(T(-3), T(sizeof(T) * 8 - 1), r));
+	REQUIRE(r == Min);
+	REQUIRE_FALSE(RootChecked<true>(T(-27), T(3), r));
+	REQUIRE(r == -3);
+	REQUIRE_FALSE(RootChecked<true>(T(100), T(2), r));
+	REQUIRE(r == 10);
+	REQUIRE_FALSE(RootChecked<true>(Min, T(1), r));
+	REQUIRE(r == Min);
+	REQUIRE_FALSE(RootChecked<true>(T(-1), T(-3), r));
+	REQUIRE(r == -1);
+	REQUIRE_FALSE(RootChecked<true>(T(16), T(-2), r));
+	REQUIRE(r == 0);
+	REQUIRE(RootChecked<false>(T(-4), T(2), r));
+	REQUIRE(r == 0);
+	REQUIRE(RootChecked<true>(T(0), T(-2), r));
+	REQUIRE(r == Max);
+	REQUIRE(RootChecked<true>(T(-5), T(0), r));
+	REQUIRE(r == Min);
+}
+
+TEMPLATE_TEST_CASE("Checked arithmetic - Real", "[arithmetics]", REAL_TYPES) {
+	using T = TestType;
+	constexpr T Max = ::std::numeric_limits<T>::max();
+	constexpr T Inf = ::std::numeric_limits<T>::infinity();
+	T r;
+	REQUIRE_FALSE(AddChecked<true>(T(0.5), T(0.25), r));
+	REQUIRE(r == T(0.75));
+	REQUIRE(AddChecked<false>(Max, Max, r));
+	REQUIRE(r == Inf);
+	REQUIRE(AddChecked<true>(Max, Max, r));
+	REQUIRE(r == Max);
+	REQUIRE(MulChecked<true>(-Max, T(2), r));
+	REQUIRE(r == -Max);
+	REQUIRE(DivChecked<true>(T(1), T(0), r));
+	REQUIRE(r == Max);
+	REQUIRE(PowChecked<true>(T(10), T(400), r));
+	REQUIRE(r == Max);
+	REQUIRE_FALSE(RootChecked<true>(T(16), T(-2), r));
+	REQUIRE(r == Approx(0.25));
+	REQUIRE(RootChecked<false>(T(16), T(0), r));
+	REQUIRE(r == Inf);
+	REQUIRE(RootChecked<true>(T(16), T(0), r));
+	REQUIRE(r == Max);
+	REQUIRE_FALSE(AddChecked<true>(Inf, T(1), r));
+	REQUIRE(r == Inf);
+}
+
 
 /*
 TEMPLATE_TEST_CASE("Testing algebra", "[pcPow 1D]", pcu8, pcu16, pcu32, pcu64, pcr32, pcr64) {
@@ -0,0 +1,104 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include <Math/Hashes.hpp>
+#include "Common.hpp"
+#include <bit>
+
+
+SCENARIO("Integer hashes known answers", "[hash]") {
+	// Answers come from the reference implementations, through the       
+	// mmh3 and xxhash Python packages, seeded where a seed is given:     
+	//   mmh3.hash(struct.pack('<3i', 1, -2, 3), signed=False)            
+	//   xxhash.xxh32_intdigest(struct.pack('<3i', 1, -2, 3))             
+	//   xxhash.xxh64_intdigest(struct.pack('<3q', 1, 2, 3), 7)           
+	GIVEN("Coordinates, hashed as little-endian bytes by the references") {
+		const ::std::int32_t a[] {1, -2, 3};
+		const ::std::uint32_t b[] {0xDEADBEEF};
+		const ::std::int32_t c[] {1, 2, 3, 4};
+
+		THEN("MurmurHash3") {
+			REQUIRE(TMurmur3<3>::Hash(a) == 0xdee49d03u);
+			REQUIRE(TMurmur3<1>::Hash(b, 42u) == 0x086b46c3u);
+			REQUIRE(TMurmur3<4>::Hash(c) == 0x4445ad00u);
+		}
+
+		THEN("xxHash 32") {
+			REQUIRE(TXXHash32<3>::Hash(a) == 0x6d9bfe26u);
+			REQUIRE(TXXHash32<1>::Hash(b, 42u) == 0x79bdc19eu);
+		}
+
+		THEN("xxHash 64") {
+			const ::std::int64_t d[] {5, -7};
+			const ::std::int64_t e[] {1, 2, 3};
+			REQUIRE(TXXHash64<2>::Hash(d) == 0xd0346c7769f9f9a0ull);
+			REQUIRE(TXXHash64<3>::Hash(e, 7ull) == 0x134d580a0bb1834dull);
+		}
+
+		THEN("Finalizers") {
+			REQUIRE(PCGHash(0) == 0x07bb2fe2u);
+			REQUIRE(Fmix32(1) == 0x514e28b7u);
+			REQUIRE(Fmix64(1) == 0xb456bcfc34c2cb2cull);
+		}
+	}
+}
+
+SCENARIO("Integer hashes of streams", "[hash]") {
+	GIVEN("A stream of coordinates, that doesn't fill a whole block") {
+		using Stream = TVectorStream<::std::int32_t, 3>;
+		constexpr Count count = Stream::Block * 2 + 3;
+		Stream points {count};
+		for (Offset i = 0; i < count; ++i) {
+			points.Set(i, TVector<::std::int32_t, 3> {
+				static_cast<::std::int32_t>(i) - 20,
+				static_cast<::std::int32_t>(i * 7),
+				-static_cast<::std::int32_t>(i / 3)
+			});
+		}
+
+		WHEN("Hashing the whole stream") {
+			::std::uint32_t murmur[count], xxh32[count], pcg[count];
+			::std::uint64_t xxh64[count];
+			TMurmur3<3>::Hash(points, murmur, 5u);
+			TXXHash32<3>::Hash(points, xxh32, 5u);
+			TXXHash64<3>::Hash(points, xxh64, 5ull);
+			TPCG<3>::Hash(points, pcg, 5u);
+
+			THEN("Results match hashing the points one by one") {
+				for (Offset i = 0; i < count; ++i) {
+					const auto p = points.Get(i);
+					REQUIRE(murmur[i] == TMurmur3<3>::Hash(p, 5u));
+					REQUIRE(xxh32[i] == TXXHash32<3>::Hash(p, 5u));
+					REQUIRE(xxh64[i] == TXXHash64<3>::Hash(p, 5ull));
+					REQUIRE(pcg[i] == TPCG<3>::Hash(p, 5u));
+				}
+			}
+		}
+	}
+}
+
+SCENARIO("Integer hashes avalanche", "[hash]") {
+	GIVEN("Neighbouring lattice points") {
+		THEN("Flipping an input bit flips about half of the output bits") {
+			Count murmur = 0, xxh32 = 0, xxh64 = 0, tests = 0;
+			for (::std::int32_t x = -16; x < 16; ++x) {
+				for (int bit = 0; bit < 32; ++bit) {
+					const ::std::int32_t p[] {x, 3};
+					const ::std::int32_t q[] {x ^ (1 << bit), 3};
+					murmur += ::std::popcount(TMurmur3<2>::Hash(p) ^ TMurmur3<2>::Hash(q));
+					xxh32  += ::std::popcount(TXXHash32<2>::Hash(p) ^ TXXHash32<2>::Hash(q));
+					xxh64  += ::std::popcount(TXXHash64<2>::Hash(p) ^ TXXHash64<2>::Hash(q));
+					++tests;
+				}
+			}
+
+			REQUIRE(murmur / double(tests) == Approx(16).margin(1));
+			REQUIRE(xxh32 / double(tests) == Approx(16).margin(1));
+			REQUIRE(xxh64 / double(tests) == Approx(32).margin(2));
+		}
+	}
+}
\ No newline at end of file
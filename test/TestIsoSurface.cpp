@@ -0,0 +1,142 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include <Math/Primitives.hpp>
+#include <Math/SignedDistanceBatch.hpp>
+#include <Math/IsoSurface.hpp>
+#include "Common.hpp"
+#include <array>
+#include <map>
+
+
+/// Make sure a mesh is closed, and consistently wound - every directed edge  
+/// appears once, and so does its reverse                                     
+template<class T>
+void CheckClosed(const TIsoMesh<T>& mesh) {
+	std::map<std::pair<std::uint32_t, std::uint32_t>, int> edges;
+	for (Offset t = 0; t < mesh.GetTriangleCount(); ++t) {
+		for (Offset e = 0; e < 3; ++e)
+			++edges[{mesh.mIndices[t * 3 + e], mesh.mIndices[t * 3 + (e + 1) % 3]}];
+	}
+
+	for (const auto& [edge, count] : edges) {
+		REQUIRE(count == 1);
+		REQUIRE(edges.count({edge.second, edge.first}) == 1);
+	}
+
+	// Euler characteristic of a sphere                                   
+	const auto euler = static_cast<long long>(mesh.mPoints.GetCount())
+		- static_cast<long long>(edges.size() / 2)
+		+ static_cast<long long>(mesh.GetTriangleCount());
+	REQUIRE(euler == 2);
+}
+
+TEMPLATE_TEST_CASE("Isosurface extraction", "[sdf]", REAL_TYPES) {
+	using T = TestType;
+	using V = TVector<T, 3>;
+
+	TSphere<V> sphere;
+	sphere.mRadius = T(0.7);
+	const auto scalar = [&](const V& p) {
+		return sphere.SignedDistance(p);
+	};
+	const auto batched = [&](const TVectorStream<T, 3>& p, T* d) {
+		SignedDistance(p, sphere, d);
+	};
+
+	// An odd resolution and a small chunk, so chunks are uneven          
+	TIsoSurface<V> iso;
+	iso.mResolution = 29;
+	iso.mChunk = 4;
+	const T cell = T(2) / T(29);
+
+	GIVEN("Marching cubes") {
+		const auto mesh = iso.MarchingCubes(scalar, 3);
+
+		REQUIRE(mesh.GetTriangleCount() > 0);
+		REQUIRE(mesh.mNormals.GetCount() == mesh.mPoints.GetCount());
+		CheckClosed(mesh);
+
+		for (Offset i = 0; i < mesh.mPoints.GetCount(); ++i) {
+			const V p = mesh.mPoints[i];
+			REQUIRE(p.Length() == Approx(T(0.7)).margin(cell * T(0.1)));
+			REQUIRE(mesh.mNormals[i].Dot(p.Normalize()) == Approx(1).margin(0.001));
+		}
+
+		// Triangles face outwards                                      
+		for (Offset t = 0; t < mesh.GetTriangleCount(); ++t) {
+			const auto tri = mesh.GetTriangle(t);
+			const V n = (tri.mABC[1] - tri.mABC[0]).Cross(tri.mABC[2] - tri.mABC[0]);
+			REQUIRE(n.Dot(tri.mABC[0] + tri.mABC[1] + tri.mABC[2]) > 0);
+		}
+
+		THEN("Results don't depend on threads or batching") {
+			const auto single = iso.MarchingCubes(batched, 1);
+			REQUIRE(single.mPoints.GetCount() == mesh.mPoints.GetCount());
+			REQUIRE(single.mIndices.GetCount() == mesh.mIndices.GetCount());
+			for (Offset i = 0; i < mesh.mIndices.GetCount(); ++i)
+				REQUIRE(single.mIndices[i] == mesh.mIndices[i]);
+		}
+	}
+
+	GIVEN("Dual contouring") {
+		const auto mesh = iso.DualContouring(batched, 3);
+
+		REQUIRE(mesh.GetTriangleCount() > 0);
+		CheckClosed(mesh);
+		for (Offset i = 0; i < mesh.mPoints.GetCount(); ++i)
+			REQUIRE(mesh.mPoints[i].Length() == Approx(T(0.7)).margin(cell * T(0.2)));
+
+		THEN("Sharp box corners are kept") {
+			TBox<V> box;
+			box.mOffsets = V {T(0.5)};
+			const auto boxMesh = iso.DualContouring([&](const V& p) {
+				return box.SignedDistance(p);
+			}, 2);
+
+			CheckClosed(boxMesh);
+			T furthest = 0;
+			for (Offset i = 0; i < boxMesh.mPoints.GetCount(); ++i) {
+				for (Offset c = 0; c < 3; ++c)
+					furthest = std::max(furthest, std::abs(boxMesh.mPoints[i][c]));
+			}
+			REQUIRE(furthest == Approx(T(0.5)).margin(0.001));
+		}
+	}
+
+	GIVEN("A triangle strip") {
+		const auto mesh = iso.MarchingCubes(scalar);
+		const auto strip = mesh.GetStripIndices();
+
+		// Every non-degenerate strip triangle is a mesh triangle with   
+		// the same winding, and all mesh triangles are covered          
+		std::map<std::array<std::uint32_t, 3>, int> triangles;
+		const auto rotated = [](std::uint32_t a, std::uint32_t b, std::uint32_t c) {
+			if (b < a and b < c)
+				return std::array<std::uint32_t, 3> {b, c, a};
+			if (c < a and c < b)
+				return std::array<std::uint32_t, 3> {c, a, b};
+			return std::array<std::uint32_t, 3> {a, b, c};
+		};
+		for (Offset t = 0; t < mesh.GetTriangleCount(); ++t)
+			++triangles[rotated(mesh.mIndices[t * 3], mesh.mIndices[t * 3 + 1], mesh.mIndices[t * 3 + 2])];
+
+		Count covered = 0;
+		for (Offset k = 0; k + 2 < strip.GetCount(); ++k) {
+			auto a = strip[k], b = strip[k + 1];
+			const auto c = strip[k + 2];
+			if (k % 2)
+				std::swap(a, b);
+			if (a == b or b == c or a == c)
+				continue;
+			REQUIRE(--triangles[rotated(a, b, c)] == 0);
+			++covered;
+		}
+		REQUIRE(covered == mesh.GetTriangleCount());
+		REQUIRE(mesh.GetStrip().mPoints.GetCount() == strip.GetCount());
+	}
+}
\ No newline at end of file
@@ -6,6 +6,8 @@
 /// SPDX-License-Identifier: GPL-3.0-or-later                                 
 ///                                                                           
 #include <Math/Matrix.hpp>
+#include <Math/MatrixBatch.hpp>
+#include <Math/Quaternion.hpp>
 #include "Common.hpp"
 
 
@@ -175,6 +177,92 @@ TEMPLATE_TEST_CASE("Matrices", "[mat]", REAL_TYPES) {
 			REQUIRE(r[3][2] == Approx(15.5061));
 			REQUIRE(r[3][3] == Approx(1));
 		}
+
+		WHEN("Getting the affine and rigid inverses") {
+			const auto r = y4.Invert();
+			const auto ra = y4.InvertAffine();
+			const auto rr = y4.InvertRigid();
+
+			for (int c = 0; c < 4; ++c) {
+				for (int i = 0; i < 4; ++i) {
+					REQUIRE(ra[c][i] == Approx(r[c][i]).margin(0.0001));
+					REQUIRE(rr[c][i] == Approx(r[c][i]).margin(0.0001));
+				}
+			}
+		}
+
+		WHEN("Getting the rigid inverse of a scaled matrix") {
+			const auto scaled = y4 * testMat4::Scale(testVec3 {2, 3, 4});
+			const auto r = scaled.Invert();
+			const auto rr = scaled.InvertRigid();
+
+			for (int c = 0; c < 4; ++c) {
+				for (int i = 0; i < 4; ++i)
+					REQUIRE(rr[c][i] == Approx(r[c][i]).margin(0.0001));
+			}
+		}
+	}
+
+	GIVEN("A compact affine matrix") {
+		using testAffine = TAffine<T>;
+		const auto full = testMat4::Rotate(Degrees(45), Degrees(45))
+			.SetPosition(testVec3 {15, 29, -5}) * testMat4::Scale(testVec3 {2, 3, 4});
+		const testAffine affine {full};
+		const testVec3 point {3, -7, 11};
+
+		REQUIRE(sizeof(testAffine) == sizeof(T) * 12);
+
+		WHEN("Converting it back to a 4x4 matrix") {
+			const testMat4 back {affine};
+
+			for (int c = 0; c < 4; ++c) {
+				for (int r = 0; r < 4; ++r)
+					REQUIRE(back[c][r] == Approx(full[c][r]).margin(0.0001));
+			}
+		}
+
+		WHEN("Transforming points, directions and normals") {
+			const testVec4 expected = full * testVec4 {point[0], point[1], point[2], 1};
+			const auto p = affine.TransformPoint(point);
+			const auto d = affine.TransformDirection(point);
+			const auto n = affine.TransformNormal(point);
+			const auto nexpected = testMat3 {full}.Invert().Transpose() * point;
+
+			for (int i = 0; i < 3; ++i) {
+				REQUIRE(p[i] == Approx(expected[i]));
+				REQUIRE(d[i] == Approx(expected[i] - full[3][i]));
+				REQUIRE(n.Normalize()[i] == Approx(nexpected.Normalize()[i]).margin(0.0001));
+			}
+		}
+
+		WHEN("Composing and inverting") {
+			const auto composed = affine * affine;
+			const auto expected = full * full;
+			const auto inverse = affine.InvertAffine();
+			const auto inverseExpected = full.Invert();
+			const auto rigid = affine.InvertRigid();
+
+			for (int c = 0; c < 4; ++c) {
+				for (int r = 0; r < 3; ++r) {
+					REQUIRE(composed[c][r] == Approx(expected[c][r]).margin(0.0001));
+					REQUIRE(inverse[c][r] == Approx(inverseExpected[c][r]).margin(0.0001));
+					REQUIRE(rigid[c][r] == Approx(inverseExpected[c][r]).margin(0.0001));
+				}
+			}
+		}
+
+		WHEN("Composing it from a quaternion") {
+			const auto q = TQuaternion<T>::FromAxis(Axes::Up<T>, Degrees(45));
+			const testVec3 position {1, 2, 3};
+			const testVec3 scale {2, 2, 2};
+			const auto m4 = A::Matrix::From<testVec3>(q, position, scale);
+			const auto m43 = A::Matrix::FromAffine<testVec3>(q, position, scale);
+
+			for (int c = 0; c < 4; ++c) {
+				for (int r = 0; r < 3; ++r)
+					REQUIRE(m43[c][r] == Approx(m4[c][r]).margin(0.0001));
+			}
+		}
 	}
 
 	GIVEN("Two matrices and a resulting matrix") {
@@ -252,6 +340,33 @@ TEMPLATE_TEST_CASE("Matrices", "[mat]", REAL_TYPES) {
 			REQUIRE(r4[3][3] == Approx(1));
 		}
 
+		WHEN("Multiplying a batch of matrices") {
+			const testMat4 expected = x4 * y4;
+			TMany<testMat4> models;
+			for (int i = 0; i < 9; ++i)
+				models << x4;
+
+			const auto products = Multiply(models, y4);
+			REQUIRE(products.GetCount() == 9);
+			for (int i = 0; i < 9; ++i) {
+				for (int c = 0; c < 4; ++c) {
+					for (int r = 0; r < 4; ++r)
+						REQUIRE(products[i][c][r] == Approx(expected[c][r]).margin(0.0001));
+				}
+			}
+		}
+
+		WHEN("Multiplying affine matrices") {
+			using testMat4x3 = TMatrix<T, 4, 3>;
+			const testMat4 expected = x4 * y4;
+			const auto r43 = testMat4x3 {x4} * testMat4x3 {y4};
+
+			for (int c = 0; c < 4; ++c) {
+				for (int r = 0; r < 3; ++r)
+					REQUIRE(r43[c][r] == Approx(expected[c][r]).margin(0.0001));
+			}
+		}
+
 		WHEN("Multiplying the matrices in reverse order") {
 			r2 = y2 * x2;
 			Logger::Info("Multiplying the matrices r2 = x2 * y2 done");
@@ -338,5 +453,32 @@ TEMPLATE_TEST_CASE("Matrices", "[mat]", REAL_TYPES) {
 			REQUIRE(r4rev[2] == Approx(0.0).margin(0.001));
 			REQUIRE(r4rev[3] == Approx(651));
 		}
+
+		WHEN("Transforming a batch of points") {
+			const testVec4 expected = matrix4 * point4;
+			TMany<testVec4> points4;
+			TMany<testVec3> points3;
+			for (int i = 0; i < 37; ++i) {
+				points4 << point4;
+				points3 << testVec3 {point4};
+			}
+
+			const auto full = Transform(matrix4, points4);
+			const auto affine = TransformAffine(matrix4, points3);
+			const auto projected = TransformProject(matrix4, points3);
+			const auto streamed = TransformAffine(matrix4, TVectorStream<T, 3> {points3});
+
+			REQUIRE(full.GetCount() == 37);
+			REQUIRE(streamed.GetCount() == 37);
+			for (int i = 0; i < 37; ++i) {
+				for (int c = 0; c < 3; ++c) {
+					REQUIRE(full[i][c] == Approx(expected[c]));
+					REQUIRE(affine[i][c] == Approx(expected[c]));
+					REQUIRE(projected[i][c] == Approx(expected[c]));
+					REQUIRE(streamed[i][c] == Approx(expected[c]));
+				}
+				REQUIRE(full[i][3] == Approx(1));
+			}
+		}
 	}
 }
@@ -6,6 +6,7 @@
 /// SPDX-License-Identifier: GPL-3.0-or-later                                 
 ///                                                                           
 #include <Math/Quaternion.hpp>
+#include <Math/QuaternionBatch.hpp>
 #include "Common.hpp"
 
 
@@ -137,4 +138,152 @@ TEMPLATE_TEST_CASE("Quaternions", "[quat]", REAL_TYPES) {
 			REQUIRE(back_to_quat[3] == Approx(orientation[3]));
 		}
 	}
+}
+
+TEMPLATE_TEST_CASE("Quaternion batches and interpolation", "[quat]", REAL_TYPES) {
+	using T = TestType;
+	using testVec3 = TVector<T, 3>;
+	using testQuat = TQuaternion<T>;
+
+	GIVEN("A quaternion and a batch of vectors") {
+		const auto q = testQuat::FromAxis(Axes::Up<T>, Degrees(45))
+			* testQuat::FromAxis(Axes::Right<T>, Degrees(30));
+		TMany<testVec3> points;
+		for (int i = 0; i < 37; ++i)
+			points << testVec3 {T(i), T(50 - i), T(i % 7)};
+
+		WHEN("Rotating the batch by a single quaternion") {
+			const auto rotated = Rotate(q, points);
+			const auto streamed = Rotate(q, TVectorStream<T, 3> {points});
+
+			REQUIRE(rotated.GetCount() == 37);
+			REQUIRE(streamed.GetCount() == 37);
+			for (int i = 0; i < 37; ++i) {
+				const testVec3 expected = q * points[i];
+				for (int c = 0; c < 3; ++c) {
+					REQUIRE(rotated[i][c] == Approx(expected[c]).margin(0.001));
+					REQUIRE(streamed[i][c] == Approx(expected[c]).margin(0.001));
+				}
+			}
+		}
+
+		WHEN("Rotating the batch by a quaternion per vector") {
+			TMany<testQuat> quats;
+			TVectorStream<T, 4> quatStream;
+			for (int i = 0; i < 37; ++i) {
+				const auto qi = testQuat::FromAxis(Axes::Forward<T>, Degrees(i * 10));
+				quats << qi;
+				quatStream.Push(TVector<T, 4> {qi.x, qi.y, qi.z, qi.w});
+			}
+
+			TMany<testVec3> rotated;
+			rotated.template Reserve<true>(37);
+			Rotate(quats.GetRaw(), points.GetRaw(), rotated.GetRaw(), 37);
+			const auto streamed = Rotate(quatStream, TVectorStream<T, 3> {points});
+
+			for (int i = 0; i < 37; ++i) {
+				const testVec3 expected = quats[i] * points[i];
+				for (int c = 0; c < 3; ++c) {
+					REQUIRE(rotated[i][c] == Approx(expected[c]).margin(0.001));
+					REQUIRE(streamed[i][c] == Approx(expected[c]).margin(0.001));
+				}
+			}
+		}
+	}
+
+	GIVEN("Arrays of orientations, positions and scales") {
+		TMany<testQuat> orientations;
+		TMany<testVec3> positions, scales;
+		TVectorStream<T, 4> orientationStream;
+		for (int i = 0; i < 13; ++i) {
+			const auto qi = testQuat::FromAxis(Axes::Up<T>, Degrees(i * 15))
+				* testQuat::FromAxis(Axes::Right<T>, Degrees(i * 5));
+			orientations << qi;
+			orientationStream.Push(TVector<T, 4> {qi.x, qi.y, qi.z, qi.w});
+			positions << testVec3 {T(i), T(-i), T(i * 2)};
+			scales << testVec3 {T(1), T(i + 1), T(2)};
+		}
+
+		WHEN("Composing transformations in bulk") {
+			TMatrix<T, 4, 4> full[13];
+			TMatrix<T, 4, 3> affine[13];
+			TMatrix<T, 4, 4> streamed[13];
+			Compose(orientations.GetRaw(), positions.GetRaw(), scales.GetRaw(), full, 13);
+			Compose(orientations.GetRaw(), positions.GetRaw(), scales.GetRaw(), affine, 13);
+			Compose(orientationStream, TVectorStream<T, 3> {positions}, TVectorStream<T, 3> {scales}, streamed);
+
+			for (int i = 0; i < 13; ++i) {
+				const auto expected = A::Matrix::From<testVec3>(orientations[i], positions[i], scales[i]);
+				for (int c = 0; c < 4; ++c) {
+					for (int r = 0; r < 4; ++r) {
+						REQUIRE(full[i][c][r] == Approx(expected[c][r]).margin(0.0001));
+						REQUIRE(streamed[i][c][r] == Approx(expected[c][r]).margin(0.0001));
+						if (r < 3)
+							REQUIRE(affine[i][c][r] == Approx(expected[c][r]).margin(0.0001));
+					}
+				}
+			}
+		}
+	}
+
+	GIVEN("Two orientations") {
+		const auto a = testQuat::FromAxis(Axes::Up<T>, Degrees(0));
+		const auto b = testQuat::FromAxis(Axes::Up<T>, Degrees(90));
+		const auto half = testQuat::FromAxis(Axes::Up<T>, Degrees(45));
+		const auto quarter = testQuat::FromAxis(Axes::Up<T>, Degrees(22.5));
+
+		WHEN("Interpolating them") {
+			const auto s0 = Slerp(a, b, T(0));
+			const auto s1 = Slerp(a, b, T(1));
+			const auto sh = Slerp(a, b, 0.5);
+			const auto sq = Slerp(a, b, 0.25);
+			const auto nh = Nlerp(a, b, 0.5);
+			const auto flipped = Slerp(a, b * T(-1), 0.5);
+
+			for (int c = 0; c < 4; ++c) {
+				REQUIRE(s0[c] == Approx(a[c]).margin(0.0001));
+				REQUIRE(s1[c] == Approx(b[c]).margin(0.0001));
+				REQUIRE(sh[c] == Approx(half[c]).margin(0.0001));
+				REQUIRE(sq[c] == Approx(quarter[c]).margin(0.0001));
+				REQUIRE(nh[c] == Approx(half[c]).margin(0.0001));
+				REQUIRE(flipped[c] == Approx(half[c]).margin(0.0001));
+			}
+		}
+
+		WHEN("Interpolating batches of them") {
+			TMany<testQuat> as, bs;
+			TVectorStream<T, 4> aStream, bStream;
+			for (int i = 0; i < 19; ++i) {
+				as << a;
+				bs << b;
+				aStream.Push(TVector<T, 4> {a.x, a.y, a.z, a.w});
+				bStream.Push(TVector<T, 4> {b.x, b.y, b.z, b.w});
+			}
+
+			const auto slerped = Slerp(as, bs, 0.25);
+			const auto nlerped = Nlerp(as, bs, 0.5);
+			const auto slerpedStream = Slerp(aStream, bStream, 0.25);
+			const auto nlerpedStream = Nlerp(aStream, bStream, 0.5);
+
+			for (int i = 0; i < 19; ++i) {
+				for (int c = 0; c < 4; ++c) {
+					REQUIRE(slerped[i][c] == Approx(quarter[c]).margin(0.0001));
+					REQUIRE(nlerped[i][c] == Approx(half[c]).margin(0.0001));
+					REQUIRE(slerpedStream[i][c] == Approx(quarter[c]).margin(0.0001));
+					REQUIRE(nlerpedStream[i][c] == Approx(half[c]).margin(0.0001));
+				}
+			}
+		}
+
+		WHEN("Doing a squad through evenly spaced keys on the same axis") {
+			const auto k0 = testQuat::FromAxis(Axes::Up<T>, Degrees(-90));
+			const auto k3 = testQuat::FromAxis(Axes::Up<T>, Degrees(180));
+			const auto c1 = SquadControl(k0, a, b);
+			const auto c2 = SquadControl(a, b, k3);
+			const auto r = Squad(a, b, c1, c2, 0.5);
+
+			for (int c = 0; c < 4; ++c)
+				REQUIRE(r[c] == Approx(half[c]).margin(0.0001));
+		}
+	}
 }
\ No newline at end of file
@@ -0,0 +1,231 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include <Math/Random.hpp>
+#include "Common.hpp"
+#include <vector>
+
+
+SCENARIO("Philox known answers", "[random]") {
+	GIVEN("The reference counters and keys") {
+		::std::uint32_t out[4];
+
+		THEN("Zero key and counter") {
+			Philox::Generate(0, 0, 0, 1, out);
+			REQUIRE(out[0] == 0x6627e8d5);
+			REQUIRE(out[1] == 0xe169c58d);
+			REQUIRE(out[2] == 0xbc57ac4c);
+			REQUIRE(out[3] == 0x9b00dbd8);
+		}
+
+		THEN("All bits set") {
+			Philox::Generate(~0ull, ~0ull, ~0ull, 1, out);
+			REQUIRE(out[0] == 0x408f276d);
+			REQUIRE(out[1] == 0x41c83b0e);
+			REQUIRE(out[2] == 0xa20bc7c6);
+			REQUIRE(out[3] == 0x6d5451fd);
+		}
+
+		THEN("Digits of pi") {
+			Philox::Generate(0x299f31d0a4093822, 0x0370734413198a2e, 0x85a308d3243f6a88, 1, out);
+			REQUIRE(out[0] == 0xd16cfe09);
+			REQUIRE(out[1] == 0x94fdcceb);
+			REQUIRE(out[2] == 0x5001e420);
+			REQUIRE(out[3] == 0x24126ea1);
+		}
+
+		THEN("The generator yields the same words") {
+			Philox rng;
+			REQUIRE(rng.Get<::std::uint32_t>() == 0x6627e8d5);
+			REQUIRE(rng.Get<::std::uint32_t>() == 0xe169c58d);
+			REQUIRE(rng.Get<::std::uint32_t>() == 0xbc57ac4c);
+			REQUIRE(rng.Get<::std::uint32_t>() == 0x9b00dbd8);
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE("Philox streams", "[random]", REAL_TYPES, ::std::uint16_t, ::std::int32_t, ::std::uint64_t) {
+	using T = TestType;
+
+	GIVEN("Two generators with the same seed and stream") {
+		Philox a {42, 7};
+		Philox b {42, 7};
+
+		WHEN("One fills an array, the other is called repeatedly") {
+			THEN("The numbers are the same, wherever the stream is") {
+				for (Offset skip = 0; skip < 4; ++skip) {
+					a.Discard(skip);
+					b.Discard(skip);
+
+					::std::vector<T> filled(203), got(203);
+					a.Fill(::std::span<T> {filled});
+					for (auto& n : got)
+						n = b.template Get<T>();
+
+					REQUIRE(filled == got);
+					REQUIRE(a.GetPosition() == b.GetPosition());
+				}
+			}
+		}
+
+		WHEN("One jumps ahead, the other generates the skipped numbers") {
+			for (int i = 0; i < 37; ++i)
+				(void) a.template Get<T>();
+			b.Discard(37 * (sizeof(T) > 4 ? 2 : 1));
+
+			THEN("Both continue the same way") {
+				for (int i = 0; i < 16; ++i)
+					REQUIRE(a.template Get<T>() == b.template Get<T>());
+			}
+		}
+
+		WHEN("They are split into different streams") {
+			auto s1 = a.Split(1);
+			auto s2 = a.Split(2);
+
+			THEN("The streams are different") {
+				::std::vector<::std::uint32_t> n1(64), n2(64);
+				s1.Fill(::std::span {n1});
+				s2.Fill(::std::span {n2});
+				REQUIRE(n1 != n2);
+				REQUIRE(s1.GetSeed() == a.GetSeed());
+				REQUIRE(s2.GetStream() == 2);
+			}
+		}
+	}
+
+	GIVEN("A generator and a range") {
+		Philox rng {1};
+
+		WHEN("Numbers are generated in the range") {
+			const T min = CT::Real<T> ? T(2) : T(3);
+			const T max = T(9);
+
+			THEN("All of them are inside the range") {
+				for (int i = 0; i < 10000; ++i) {
+					const auto n = rng.template Get<T>(min, max);
+					REQUIRE(n >= min);
+					REQUIRE(n <= max);
+					const auto e = rng.template Get<T, false, false>(min, max);
+					REQUIRE(e > min);
+					REQUIRE(e < max);
+				}
+			}
+		}
+
+		WHEN("Numbers are generated in the entire range") {
+			THEN("Reals are in [-1:1)") {
+				if constexpr (CT::Real<T>) {
+					::std::vector<T> numbers(1000);
+					rng.Fill(::std::span<T> {numbers});
+					for (auto n : numbers) {
+						REQUIRE(n >= T(-1));
+						REQUIRE(n < T(1));
+					}
+				}
+			}
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE("Bulk random distributions", "[random]", REAL_TYPES) {
+	using T = TestType;
+	using V = TVector<T, 3>;
+	constexpr Count N = 10000;
+	RNG rng {3};
+
+	GIVEN("A range") {
+		const TRange<V> range {V {-1, 2, 5}, V {1, 3, 5}};
+
+		WHEN("Vectors are generated in it") {
+			const auto points = RandomUniform(rng, range, N);
+
+			THEN("All of them are inside") {
+				REQUIRE(points.GetCount() == N);
+				for (auto& p : points) {
+					REQUIRE(p[0] >= T(-1));
+					REQUIRE(p[0] < T(1));
+					REQUIRE(p[1] >= T(2));
+					REQUIRE(p[1] < T(3));
+					REQUIRE(p[2] == T(5));
+				}
+			}
+		}
+
+		WHEN("A stream is filled in it") {
+			TVectorStream<T, 3> stream;
+			stream.Resize(N);
+			RandomUniform(rng, range, stream);
+
+			THEN("All of them are inside") {
+				for (Offset i = 0; i < N; ++i) {
+					const auto p = stream.Get(i);
+					REQUIRE(p[0] >= T(-1));
+					REQUIRE(p[0] < T(1));
+					REQUIRE(p[1] >= T(2));
+					REQUIRE(p[1] < T(3));
+				}
+			}
+		}
+	}
+
+	GIVEN("A sphere") {
+		WHEN("Points are generated on it") {
+			const auto points = RandomOnSphere<V>(rng, N, T(2));
+
+			THEN("They are all on the surface, and evenly spread") {
+				V mean;
+				for (auto& p : points) {
+					REQUIRE(p.Length() == Approx(T(2)).epsilon(0.0001));
+					mean += p / T(N);
+				}
+				REQUIRE(mean.Length() < T(0.1));
+			}
+		}
+
+		WHEN("Points are generated inside it") {
+			const auto points = RandomInBall<V>(rng, N);
+
+			THEN("They are all inside, and fill it by volume") {
+				Count inner = 0;
+				for (auto& p : points) {
+					REQUIRE(p.Length() <= T(1.0001));
+					inner += p.Length() < T(0.5);
+				}
+				REQUIRE(T(inner) / T(N) == Approx(T(0.125)).margin(0.02));
+			}
+		}
+	}
+
+	GIVEN("Rotations, normal and exponential distributions") {
+		const auto rotations = RandomRotation<T>(rng, N);
+		const auto normal = RandomNormal<T>(rng, N, T(3), T(2));
+		const auto exponential = RandomExponential<T>(rng, N, T(4));
+
+		THEN("Rotations are unit quaternions") {
+			for (auto& q : rotations)
+				REQUIRE(q.Length() == Approx(T(1)).epsilon(0.0001));
+		}
+
+		THEN("The moments match") {
+			T mean {}, variance {};
+			for (auto n : normal)
+				mean += n / T(N);
+			for (auto n : normal)
+				variance += (n - mean) * (n - mean) / T(N);
+			REQUIRE(mean == Approx(T(3)).margin(0.1));
+			REQUIRE(variance == Approx(T(4)).margin(0.3));
+
+			T expMean {};
+			for (auto n : exponential) {
+				REQUIRE(n >= T(0));
+				expMean += n / T(N);
+			}
+			REQUIRE(expMean == Approx(T(0.25)).margin(0.02));
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,267 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include <Math/Primitives.hpp>
+#include <Math/PrimitiveBatch.hpp>
+#include "Common.hpp"
+
+
+TEMPLATE_TEST_CASE("Ray-primitive intersection", "[ray][primitive]", REAL_TYPES) {
+	using T = TestType;
+	using V = TVector<T, 3>;
+	using R = TRay<V>;
+	const R alongX {V {-5, 0, 0}, V {1, 0, 0}};
+	const R downY {V {0, 5, 0}, V {0, -1, 0}};
+
+	GIVEN("A sphere and an ellipsoid") {
+		TSphere<V> sphere;
+		sphere.mRadius = 1;
+		TEllipsoid<V> ellipsoid;
+		ellipsoid.mRadii = V {2, 1, 1};
+
+		WHEN("Hit from outside") {
+			const auto s = sphere.Intersect(alongX);
+			const auto e = ellipsoid.Intersect(alongX);
+			REQUIRE(s.mDistance == Approx(4));
+			REQUIRE(s.mNormal[0] == Approx(-1));
+			REQUIRE(e.mDistance == Approx(3));
+			REQUIRE(e.mNormal[0] == Approx(-1));
+			REQUIRE(ellipsoid.Intersect(downY).mDistance == Approx(4));
+		}
+
+		WHEN("Hit from inside") {
+			const R ray {V {0, 0, 0}, V {0, 0, 1}};
+			REQUIRE(sphere.Intersect(ray).mDistance == Approx(1));
+			REQUIRE(sphere.Intersect(ray).mNormal[2] == Approx(1));
+		}
+
+		WHEN("Missed") {
+			REQUIRE_FALSE(sphere.Intersect(R {V {-5, 2, 0}, V {1, 0, 0}}));
+			REQUIRE_FALSE(sphere.Intersect(R {V {5, 0, 0}, V {1, 0, 0}}));
+			REQUIRE_FALSE(ellipsoid.Intersect(R {V {0, T(1.5), 0}, V {1, 0, 0}}));
+		}
+	}
+
+	GIVEN("A box and a rounded box") {
+		TBox<V> box;
+		TBoxRounded<V> rounded;
+		rounded.mOffsets = V {1, 1, 1};
+		rounded.mRadius = T(0.5);
+
+		WHEN("Hit a face") {
+			const auto b = box.Intersect(alongX);
+			const auto r = rounded.Intersect(alongX);
+			REQUIRE(b.mDistance == Approx(4.5));
+			REQUIRE(b.mNormal == V {-1, 0, 0});
+			REQUIRE(r.mDistance == Approx(3.5));
+			REQUIRE(r.mNormal[0] == Approx(-1));
+		}
+
+		WHEN("Hit a rounded corner") {
+			const R ray {V {-5, -5, -5}, V {1, 1, 1}};
+			const auto r = rounded.Intersect(ray);
+			REQUIRE(r.mDistance == Approx(4 * std::sqrt(T(3)) - T(0.5)));
+			REQUIRE(r.mNormal[0] == Approx(-1 / std::sqrt(T(3))));
+			REQUIRE(r.mNormal[1] == Approx(-1 / std::sqrt(T(3))));
+		}
+
+		WHEN("Hit a rounded edge") {
+			const R ray {V {-5, -5, 0}, V {1, 1, 0}};
+			const auto r = rounded.Intersect(ray);
+			REQUIRE(r.mDistance == Approx(4 * std::sqrt(T(2)) - T(0.5)));
+			REQUIRE(r.mNormal[2] == Approx(0).margin(0.0001));
+		}
+
+		WHEN("Hit a rounded corner from the gap around it") {
+			// Inside the bounds, but outside the rounded box            
+			const V gap {T(1.45), T(1.45), T(1.45)};
+			const R ray {gap, V {-1, -1, -1}.Normalize()};
+			REQUIRE(rounded.SignedDistance(gap) > 0);
+			const auto r = rounded.Intersect(ray);
+			REQUIRE(r.mDistance == Approx(T(0.45) * std::sqrt(T(3)) - T(0.5)));
+			REQUIRE(r.mNormal[0] == Approx(1 / std::sqrt(T(3))));
+			REQUIRE(r.mNormal[2] == Approx(1 / std::sqrt(T(3))));
+			REQUIRE_FALSE(rounded.Intersect(R {V {0, 0, 0}, V {0, 1, 0}}));
+		}
+
+		WHEN("Hit the box from inside") {
+			const auto b = box.Intersect(R {V {0, 0, 0}, V {0, 1, 0}});
+			REQUIRE(b.mDistance == Approx(0.5));
+			REQUIRE(b.mNormal == V {0, 1, 0});
+		}
+
+		WHEN("Missed") {
+			REQUIRE_FALSE(box.Intersect(R {V {-5, 1, 0}, V {1, 0, 0}}));
+			REQUIRE_FALSE(box.Intersect(R {V {5, 0, 0}, V {1, 0, 0}}));
+			// Passes through the bounds, but not the rounded corner     
+			REQUIRE_FALSE(rounded.Intersect(R {V {-5, T(1.45), T(1.45)}, V {1, 0, 0}}));
+		}
+	}
+
+	GIVEN("Cylinders") {
+		TCylinder<V> infinite;
+		TCylinderCapped<V> capped;
+		capped.mHeight = 1;
+
+		WHEN("Hit the side") {
+			REQUIRE(infinite.Intersect(R {V {-5, 100, 0}, V {1, 0, 0}}).mDistance == Approx(4.5));
+			const auto c = capped.Intersect(alongX);
+			REQUIRE(c.mDistance == Approx(4.5));
+			REQUIRE(c.mNormal[0] == Approx(-1));
+		}
+
+		WHEN("Hit a cap") {
+			const auto c = capped.Intersect(downY);
+			REQUIRE(c.mDistance == Approx(4));
+			REQUIRE(c.mNormal == V {0, 1, 0});
+		}
+
+		WHEN("Missed") {
+			REQUIRE_FALSE(infinite.Intersect(downY));
+			REQUIRE_FALSE(capped.Intersect(R {V {-5, 2, 0}, V {1, 0, 0}}));
+		}
+	}
+
+	GIVEN("A cone") {
+		TCone<V> cone;
+		cone.mHeight = 1;
+		cone.mAngle = TRadians<T> {HALFPI<T> / 2};
+
+		WHEN("Hit the side") {
+			const auto c = cone.Intersect(R {V {-5, T(-0.5), 0}, V {1, 0, 0}});
+			REQUIRE(c.mDistance == Approx(4.5));
+			REQUIRE(c.mNormal[0] == Approx(-std::sqrt(T(0.5))));
+			REQUIRE(c.mNormal[1] == Approx(std::sqrt(T(0.5))));
+		}
+
+		WHEN("Hit the base") {
+			const auto c = cone.Intersect(R {V {0, -5, 0}, V {0, 1, 0}});
+			REQUIRE(c.mDistance == Approx(4));
+			REQUIRE(c.mNormal == V {0, -1, 0});
+		}
+
+		WHEN("Missed") {
+			// Above the tip, where the mirrored cone would be           
+			REQUIRE_FALSE(cone.Intersect(R {V {-5, T(0.5), 0}, V {1, 0, 0}}));
+		}
+	}
+
+	GIVEN("A wide cone") {
+		// Base radius is mHeight * cos / sin = sqrt(3)                  
+		TCone<V> cone;
+		cone.mHeight = 1;
+		cone.mAngle = TRadians<T> {PI<T> / 6};
+
+		WHEN("Hit the base near its rim") {
+			const R up {V {T(1.5), -5, 0}, V {0, 1, 0}};
+			const auto c = cone.Intersect(up);
+			REQUIRE(c.mDistance == Approx(4));
+			REQUIRE(c.mNormal == V {0, -1, 0});
+			REQUIRE(cone.SignedDistance(up.Point(c.mDistance)) == Approx(0).margin(0.0001));
+		}
+
+		WHEN("Missed outside the rim") {
+			const R up {V {T(1.9), -5, 0}, V {0, 1, 0}};
+			REQUIRE_FALSE(cone.Intersect(up));
+			REQUIRE(cone.SignedDistance(up.Point(4)) > 0);
+		}
+	}
+
+	GIVEN("A plane") {
+		const TPlane<V> plane {V {0, 1, 0}, 1};
+
+		WHEN("Hit") {
+			const auto p = plane.Intersect(downY);
+			REQUIRE(p.mDistance == Approx(6));
+			REQUIRE(p.mNormal == V {0, 1, 0});
+		}
+
+		WHEN("Missed") {
+			REQUIRE_FALSE(plane.Intersect(R {V {0, 5, 0}, V {0, 1, 0}}));
+			REQUIRE_FALSE(plane.Intersect(alongX));
+		}
+	}
+
+	GIVEN("A torus") {
+		TTorus<V> torus;
+		torus.mOuterRadius = 1;
+		torus.mInnerRadius = T(0.25);
+
+		WHEN("Hit across") {
+			const auto t = torus.Intersect(R {V {-3, 0, 0}, V {1, 0, 0}});
+			REQUIRE(t.mDistance == Approx(1.75));
+			REQUIRE(t.mNormal[0] == Approx(-1));
+		}
+
+		WHEN("Hit from above") {
+			const auto t = torus.Intersect(R {V {1, 3, 0}, V {0, -1, 0}});
+			REQUIRE(t.mDistance == Approx(2.75));
+			REQUIRE(t.mNormal[1] == Approx(1));
+		}
+
+		WHEN("Missed through the hole") {
+			REQUIRE_FALSE(torus.Intersect(downY));
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE("Batched ray-primitive intersection", "[ray][primitive]", REAL_TYPES) {
+	using T = TestType;
+	using V = TVector<T, 3>;
+	using R = TRay<V>;
+	constexpr Count count = 100;
+
+	GIVEN("Spheres and boxes along the X axis") {
+		TSphere<V> spheres[count];
+		V positions[count];
+		TVectorStream<T, 3> centers {count};
+		TVectorStream<T, 1> radii {count};
+		TVectorStream<T, 3> min {count};
+		TVectorStream<T, 3> max {count};
+
+		for (Offset i = 0; i < count; ++i) {
+			positions[i] = V {T(i * 3), T(i % 2), 0};
+			spheres[i].mRadius = 1;
+			centers.Set(i, positions[i]);
+			radii.Set(i, TVector<T, 1> {1});
+			min.Set(i, positions[i] - T(1));
+			max.Set(i, positions[i] + T(1));
+		}
+
+		WHEN("A ray is cast from the far end") {
+			const R ray {V {1000, T(0.25), 0}, V {-1, 0, 0}};
+			const auto aos = Intersect(ray, positions, spheres, count);
+			const auto soa = IntersectSpheres(ray, centers, radii);
+			const auto boxes = IntersectBoxes(ray, min, max);
+
+			REQUIRE(aos.mIndex == count - 1);
+			REQUIRE(soa.mIndex == count - 1);
+			REQUIRE(boxes.mIndex == count - 1);
+			REQUIRE(aos.mDistance == Approx(soa.mDistance));
+			REQUIRE(aos.mNormal[0] == Approx(soa.mNormal[0]));
+			REQUIRE(boxes.mDistance == Approx(1000 - 297 - 1));
+			REQUIRE(boxes.mNormal == V {1, 0, 0});
+		}
+
+		WHEN("A ray is cast between the rows") {
+			const R ray {V {1000, T(0.5), 3}, V {-1, 0, 0}};
+			REQUIRE_FALSE(Intersect(ray, positions, spheres, count));
+			REQUIRE_FALSE(IntersectSpheres(ray, centers, radii));
+			REQUIRE_FALSE(IntersectBoxes(ray, min, max));
+		}
+
+		WHEN("A ray starts inside") {
+			const R ray {V {6, 0, 0}, V {0, 1, 0}};
+			const auto soa = IntersectSpheres(ray, centers, radii);
+			const auto boxes = IntersectBoxes(ray, min, max);
+			REQUIRE(soa.mIndex == 2);
+			REQUIRE(soa.mDistance == Approx(1));
+			REQUIRE(boxes.mIndex == 2);
+			REQUIRE(boxes.mDistance == Approx(1));
+		}
+	}
+}
\ No newline at end of file
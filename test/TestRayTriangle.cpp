@@ -0,0 +1,171 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include <Math/PrimitiveBatch.hpp>
+#include "Common.hpp"
+
+
+TEMPLATE_TEST_CASE("Ray-triangle intersection", "[ray][triangle]", REAL_TYPES) {
+	using T = TestType;
+	using V = TVector<T, 3>;
+	using Tri = TTriangle<V>;
+	using R = TRay<V>;
+
+	GIVEN("A single triangle") {
+		const Tri tri {V {0, 0, 0}, V {1, 0, 0}, V {0, 1, 0}};
+
+		WHEN("Hit from the front") {
+			const R ray {V {T(0.25), T(0.5), 2}, V {0, 0, -1}};
+			const auto mt = tri.Intersect(ray);
+			const auto wt = tri.IntersectWatertight(ray);
+
+			REQUIRE(mt);
+			REQUIRE(wt);
+			REQUIRE(mt.mDistance == Approx(2));
+			REQUIRE(wt.mDistance == Approx(2));
+			REQUIRE(mt.mU == Approx(0.25));
+			REQUIRE(mt.mV == Approx(0.5));
+			REQUIRE(wt.mU == Approx(0.25));
+			REQUIRE(wt.mV == Approx(0.5));
+			REQUIRE(mt.mNormal == V {0, 0, 1});
+			REQUIRE(wt.mNormal == V {0, 0, 1});
+		}
+
+		WHEN("Hit from the back") {
+			const R ray {V {T(0.25), T(0.25), -3}, V {0, 0, 1}};
+			REQUIRE(tri.Intersect(ray).mDistance == Approx(3));
+			REQUIRE(tri.IntersectWatertight(ray).mDistance == Approx(3));
+			REQUIRE(tri.Intersect(ray).mNormal == V {0, 0, -1});
+		}
+
+		WHEN("Missed") {
+			REQUIRE_FALSE(tri.Intersect(R {V {1, 1, 1}, V {0, 0, -1}}));
+			REQUIRE_FALSE(tri.IntersectWatertight(R {V {1, 1, 1}, V {0, 0, -1}}));
+
+			// Triangle is behind the ray                                 
+			REQUIRE_FALSE(tri.Intersect(R {V {T(0.1), T(0.1), 1}, V {0, 0, 1}}));
+			REQUIRE_FALSE(tri.IntersectWatertight(R {V {T(0.1), T(0.1), 1}, V {0, 0, 1}}));
+
+			// Ray is parallel to the triangle                            
+			REQUIRE_FALSE(tri.Intersect(R {V {-1, T(0.1), 0}, V {1, 0, 0}}));
+			REQUIRE_FALSE(tri.IntersectWatertight(R {V {-1, T(0.1), 0}, V {1, 0, 0}}));
+		}
+	}
+
+	GIVEN("Two triangles sharing an edge") {
+		const Tri tris[2] {
+			{V {0, 0, 0}, V {1, 0, 0}, V {1, 1, 0}},
+			{V {0, 0, 0}, V {1, 1, 0}, V {0, 1, 0}}
+		};
+
+		WHEN("Casting rays exactly through the shared edge") {
+			for (int i = 1; i < 10; ++i) {
+				const T x = T(i) / T(10);
+				const R ray {V {x, x, 0}, V {T(0.3), T(-0.2), -1}};
+				const R shifted {ray.Point(-2), ray.mNormal};
+
+				// Watertight test never misses both triangles             
+				bool hit = false;
+				for (auto& tri : tris)
+					hit |= bool(tri.IntersectWatertight(shifted));
+				REQUIRE(hit);
+			}
+		}
+	}
+
+	GIVEN("A lot of triangles in a stream") {
+		::std::uint32_t seed = 777;
+		const auto random = [&] {
+			seed = seed * 1664525u + 1013904223u;
+			return T(seed >> 8) / T(1 << 24) * 2 - 1;
+		};
+
+		TMany<Tri> source;
+		for (int i = 0; i < 101; ++i) {
+			const V center {random() * 4, random() * 4, random() * 4};
+			source << Tri {
+				center + V {random(), random(), random()},
+				center + V {random(), random(), random()},
+				center + V {random(), random(), random()}
+			};
+		}
+
+		const TTriangleStream<T> stream {source};
+		REQUIRE(stream.GetCount() == 101);
+
+		TMany<R> rays;
+		for (int i = 0; i < 64; ++i)
+			rays << R {V {random() * 6, random() * 6, -10}, V {random() * T(0.2), random() * T(0.2), 1}};
+
+		WHEN("Testing single rays against the stream") {
+			for (auto& ray : rays) {
+				const auto mt = Intersect(ray, stream);
+				const auto wt = Intersect<TriangleTest::Watertight>(ray, stream);
+
+				T closest = ::std::numeric_limits<T>::infinity();
+				Offset index = 0;
+				for (Offset i = 0; i < source.GetCount(); ++i) {
+					const auto hit = source[i].Intersect(ray);
+					if (hit and hit.mDistance < closest) {
+						closest = hit.mDistance;
+						index = i;
+					}
+				}
+
+				REQUIRE(bool(mt) == bool(closest != ::std::numeric_limits<T>::infinity()));
+				REQUIRE(bool(wt) == bool(mt));
+				if (mt) {
+					REQUIRE(mt.mIndex == index);
+					REQUIRE(mt.mDistance == closest);
+					REQUIRE(wt.mDistance == Approx(closest).epsilon(0.001));
+					REQUIRE(mt.mNormal == source[index].Intersect(ray).mNormal);
+				}
+			}
+		}
+
+		WHEN("Testing packets of 4, 8 and 16 rays against the stream") {
+			const auto check = [&]<Count N>(TRayPacket<T, N>& packet, Offset first) {
+				Intersect(packet, stream);
+				for (Offset j = 0; j < N; ++j) {
+					const auto expected = Intersect(rays[first + j], stream);
+					const auto hit = packet.GetHit(j);
+					REQUIRE(bool(hit) == bool(expected));
+					if (expected) {
+						REQUIRE(hit.mIndex == expected.mIndex);
+						REQUIRE(hit.mDistance == Approx(expected.mDistance));
+						REQUIRE(hit.mU == Approx(expected.mU));
+						REQUIRE(hit.mV == Approx(expected.mV));
+					}
+				}
+			};
+
+			TRayPacket4<T> p4;
+			TRayPacket8<T> p8;
+			TRayPacket16<T> p16;
+			for (Offset j = 0; j < 4; ++j)
+				p4.Set(j, rays[j]);
+			for (Offset j = 0; j < 8; ++j)
+				p8.Set(j, rays[4 + j]);
+			for (Offset j = 0; j < 16; ++j)
+				p16.Set(j, rays[12 + j]);
+
+			check(p4, 0);
+			check(p8, 4);
+			check(p16, 12);
+
+			TRayPacket16<T> watertight;
+			for (Offset j = 0; j < 16; ++j)
+				watertight.Set(j, rays[28 + j]);
+			Intersect<TriangleTest::Watertight>(watertight, stream);
+			for (Offset j = 0; j < 16; ++j) {
+				const auto expected = Intersect<TriangleTest::Watertight>(rays[28 + j], stream);
+				REQUIRE(watertight.GetHit(j).mIndex == expected.mIndex);
+				REQUIRE(bool(watertight.GetHit(j)) == bool(expected));
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,180 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include <Math/Primitives.hpp>
+#include <Math/SignedDistanceInterval.hpp>
+#include <Math/SignedDistanceVoxelize.hpp>
+#include "Common.hpp"
+
+
+/// Make sure the distance bounds contain all distances sampled in a box      
+template<class T, Count C, class P>
+void CheckBounds(const TRange<TVector<T, C>>& box, const P& primitive) {
+	const auto bounds = SignedDistance(box, primitive);
+	REQUIRE(bounds.mMin[0] <= bounds.mMax[0]);
+
+	constexpr Count steps = 5;
+	const Count count = C == 2 ? steps * steps : steps * steps * steps;
+	for (Offset i = 0; i < count; ++i) {
+		TVector<T, C> point;
+		Offset index = i;
+		for (Offset c = 0; c < C; ++c) {
+			const T t = T(index % steps) / T(steps - 1);
+			point[c] = box.mMin[c] + (box.mMax[c] - box.mMin[c]) * t;
+			index /= steps;
+		}
+
+		const T distance = primitive.SignedDistance(point);
+		REQUIRE(distance >= bounds.mMin[0] - T(0.0001));
+		REQUIRE(distance <= bounds.mMax[0] + T(0.0001));
+	}
+}
+
+TEMPLATE_TEST_CASE("Signed distance bounds over boxes", "[sdf]", REAL_TYPES) {
+	using T = TestType;
+	using V2 = TVector<T, 2>;
+	using V3 = TVector<T, 3>;
+
+	// Boxes away from the surfaces, straddling them, and around origin   
+	const TRange<V3> boxes[] {
+		{V3 {T(-0.25), T(-0.25), T(-0.25)}, V3 {T(0.25), T(0.25), T(0.25)}},
+		{V3 {T(0.5), T(-0.1), T(0.2)}, V3 {T(1.5), T(0.3), T(0.6)}},
+		{V3 {T(2), T(2), T(-3)}, V3 {T(2.5), T(3), T(-2)}},
+		{V3 {T(-1.5), T(0.1), T(-0.4)}, V3 {T(-0.9), T(0.8), T(1.2)}}
+	};
+
+	GIVEN("Boxes") {
+		TBox<V3> box;
+		box.mOffsets = V3 {1, T(0.5), T(0.75)};
+		TBoxRounded<V3> rounded;
+		rounded.mOffsets = V3 {T(0.5), T(0.5), 1};
+		rounded.mRadius = T(0.25);
+
+		for (const auto& range : boxes) {
+			CheckBounds(range, box);
+			CheckBounds(range, rounded);
+		}
+
+		CheckBounds(TRange<V2> {V2 {T(0.1), T(-1)}, V2 {T(0.9), T(2)}}, TBox<V2> {});
+	}
+
+	GIVEN("Cylinders, a cone and a torus") {
+		TCylinder<V3> cylinder;
+		TCylinderCapped<V3> capped;
+		capped.mHeight = T(0.75);
+		TCone<V3> cone;
+		cone.mHeight = 1;
+		cone.mAngle = TRadians<T> {T(0.5)};
+		TTorus<V3> torus;
+
+		for (const auto& range : boxes) {
+			CheckBounds(range, cylinder);
+			CheckBounds(range, capped);
+			CheckBounds(range, cone);
+			CheckBounds(range, torus);
+		}
+	}
+
+	GIVEN("A plane, a sphere, an ellipsoid and a triangle") {
+		const TPlane<V3> plane {V3 {1, 2, 3}, T(0.5)};
+		TSphere<V3> sphere;
+		sphere.mRadius = T(1.25);
+		TEllipsoid<V3> ellipsoid;
+		ellipsoid.mRadii = V3 {1, 2, T(0.5)};
+		const TTriangle<V3> triangle {V3 {-1, 0, 0}, V3 {1, T(0.5), 0}, V3 {0, 1, 1}};
+
+		for (const auto& range : boxes) {
+			CheckBounds(range, plane);
+			CheckBounds(range, sphere);
+			CheckBounds(range, ellipsoid);
+			CheckBounds(range, triangle);
+		}
+	}
+
+	GIVEN("A box far away from a sphere") {
+		TSphere<V3> sphere;
+		const auto bounds = SignedDistance(boxes[2], sphere);
+
+		THEN("The bounds exclude the surface") {
+			REQUIRE(bounds.mMin[0] > 0);
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE("SDF tape bounds and voxelization", "[sdf]", REAL_TYPES) {
+	using T = TestType;
+	using V = TVector<T, 3>;
+
+	TSDFTree<T> tree;
+	TSphere<V> sphere;
+	sphere.mRadius = T(0.3);
+	TBox<V> box;
+	box.mOffsets = V {T(0.2), T(0.15), T(0.25)};
+
+	const auto s = tree.Translate(tree.Add(sphere), V {T(0.2), 0, 0});
+	const auto b = tree.Rotate(tree.Add(box), TQuaternion<T>::FromAxis(Axes::Up<T>, Degrees(30)));
+	const auto u = tree.SmoothUnion(s, b, T(0.1));
+	const auto root = tree.Scale(tree.Onion(u, T(0.05)), T(1.5));
+	const auto tape = tree.Compile(root);
+	const TRange<V> bounds {V {-1}, V {1}};
+
+	WHEN("Bounding parts of space") {
+		const TRange<V> ranges[] {
+			{V {T(-0.2), T(-0.1), T(-0.1)}, V {T(0.1), T(0.2), T(0.3)}},
+			{V {T(0.5), T(0.5), T(0.5)}, V {1, 1, 1}},
+			{V {-1, T(-0.2), T(-0.3)}, V {T(-0.4), T(0.3), T(0.1)}}
+		};
+
+		TMany<Inner::Interval<T>> scratch;
+		for (const auto& range : ranges) {
+			const auto distances = tape.Evaluate(range);
+			const auto reused = tape.Evaluate(range, scratch);
+			REQUIRE(reused.mMin[0] == distances.mMin[0]);
+			REQUIRE(reused.mMax[0] == distances.mMax[0]);
+			for (Offset i = 0; i < 27; ++i) {
+				const V t {T(i % 3) / 2, T(i / 3 % 3) / 2, T(i / 9) / 2};
+				const auto point = range.mMin + (range.mMax - range.mMin) * t;
+				const T distance = tape.Evaluate(point);
+				REQUIRE(distance >= distances.mMin[0] - T(0.0001));
+				REQUIRE(distance <= distances.mMax[0] + T(0.0001));
+			}
+		}
+	}
+
+	WHEN("Voxelizing") {
+		// Big enough for several chunks, so that all threads get work   
+		constexpr Count N = 96;
+		const T band = T(0.1);
+		TMany<T> grid;
+		grid.template Reserve<true>(N * N * N);
+		const Count evaluated = Voxelize(tape, bounds, N, band, grid.GetRaw(), 4);
+
+		THEN("The grid matches densely evaluated distances, and most of it was pruned") {
+			REQUIRE(evaluated > 0);
+			REQUIRE(evaluated < N * N * N / 2);
+
+			TVectorStream<T, 3> points {N * N * N};
+			const T step = T(2) / T(N);
+			for (Offset i = 0; i < N * N * N; ++i) {
+				points.Set(i, V {
+					T(-1) + (T(i % N) + T(0.5)) * step,
+					T(-1) + (T(i / N % N) + T(0.5)) * step,
+					T(-1) + (T(i / (N * N)) + T(0.5)) * step
+				});
+			}
+
+			const auto dense = tape.Evaluate(points);
+			for (Offset i = 0; i < N * N * N; ++i)
+				REQUIRE(grid[i] == Approx(std::clamp(dense[i], -band, band)).margin(0.0001));
+
+			const auto single = Voxelize(tape, bounds, N, band, 1);
+			REQUIRE(single.GetCount() == N * N * N);
+			for (Offset i = 0; i < N * N * N; ++i)
+				REQUIRE(single[i] == grid[i]);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,142 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include <Math/Primitives.hpp>
+#include <Math/SignedDistanceTape.hpp>
+#include "Common.hpp"
+
+
+/// Compare a tape against a reference distance function                      
+template<class T, class F>
+void CompareTape(const TSDFTape<T>& tape, const TVectorStream<T, 3>& points, F&& reference) {
+	const auto distances = tape.Evaluate(points);
+	REQUIRE(distances.GetCount() == points.GetCount());
+
+	// Registers kept between calls must not change the results           
+	TMany<T> scratch;
+	TMany<T> reused;
+	reused.template Reserve<true>(points.GetCount());
+	tape.Evaluate(points, reused.GetRaw(), scratch);
+
+	for (Offset i = 0; i < points.GetCount(); ++i) {
+		const auto expected = reference(points.Get(i));
+		REQUIRE(distances[i] == Approx(expected).margin(0.0001));
+		REQUIRE(reused[i] == Approx(expected).margin(0.0001));
+		REQUIRE(tape.Evaluate(points.Get(i)) == Approx(expected).margin(0.0001));
+		REQUIRE(tape.Evaluate(points.Get(i), scratch) == Approx(expected).margin(0.0001));
+	}
+}
+
+TEMPLATE_TEST_CASE("SDF expression tapes", "[sdf]", REAL_TYPES) {
+	using T = TestType;
+	using V = TVector<T, 3>;
+
+	constexpr Count count = 101;
+	TVectorStream<T, 3> points {count};
+	for (Offset i = 0; i < count; ++i) {
+		points.Set(i, V {
+			T(int(i % 7) - 3) * T(0.4),
+			T(int(i % 5) - 2) * T(0.45),
+			T(int(i % 11) - 5) * T(0.3)
+		});
+	}
+
+	TSDFTree<T> tree;
+	TSphere<V> sphere;
+	sphere.mRadius = T(0.5);
+	TBox<V> box;
+	box.mOffsets = V {T(0.4), T(0.3), T(0.2)};
+	TCylinder<V> cylinder;
+	cylinder.mRadius = T(0.1);
+
+	GIVEN("A single primitive") {
+		const auto tape = tree.Compile(tree.Add(sphere));
+
+		REQUIRE(tape.GetCode().GetCount() == 1);
+		REQUIRE(tape.GetPointRegisters() == 1);
+		REQUIRE(tape.GetDistanceRegisters() == 1);
+		CompareTape(tape, points, [&](const V& p) {
+			return sphere.SignedDistance(p);
+		});
+	}
+
+	GIVEN("Transforms and CSG operations") {
+		const auto s = tree.Translate(tree.Add(sphere), V {T(0.5), 0, 0});
+		const auto u = tree.SmoothUnion(s, tree.Add(box), T(0.2));
+		const auto c = tree.Subtraction(u, tree.Add(cylinder));
+		const auto root = tree.Scale(tree.Round(c, T(0.05)), 2);
+		const auto tape = tree.Compile(root);
+
+		CompareTape(tape, points, [&](const V& p) {
+			const V q = p / T(2);
+			const T a = sphere.SignedDistance(q - V {T(0.5), 0, 0});
+			const T b = box.SignedDistance(q);
+			const T h = std::clamp(T(0.5) + T(0.5) * (b - a) / T(0.2), T(0), T(1));
+			const T smooth = b + (a - b) * h - T(0.2) * h * (1 - h);
+			const T carved = std::max(smooth, -cylinder.SignedDistance(q));
+			return (carved - T(0.05)) * 2;
+		});
+	}
+
+	GIVEN("Smooth intersection and subtraction, and onion") {
+		const auto a = tree.Add(sphere);
+		const auto b = tree.Add(box);
+		const auto i = tree.SmoothIntersection(a, b, T(0.1));
+		const auto root = tree.Onion(tree.SmoothSubtraction(i, tree.Add(cylinder), T(0.1)), T(0.02));
+		const auto tape = tree.Compile(root);
+
+		CompareTape(tape, points, [&](const V& p) {
+			const T da = sphere.SignedDistance(p);
+			const T db = box.SignedDistance(p);
+			T h = std::clamp(T(0.5) - T(0.5) * (db - da) / T(0.1), T(0), T(1));
+			const T inter = db + (da - db) * h + T(0.1) * h * (1 - h);
+			const T dc = cylinder.SignedDistance(p);
+			h = std::clamp(T(0.5) - T(0.5) * (inter + dc) / T(0.1), T(0), T(1));
+			const T carved = inter - (inter + dc) * h + T(0.1) * h * (1 - h);
+			return std::abs(carved) - T(0.02);
+		});
+	}
+
+	GIVEN("A rotated box, away from the origin") {
+		TBox<V> bar;
+		bar.mOffsets = V {1, T(0.25), T(0.25)};
+		const auto rotation = TQuaternion<T>::FromAxis(V {0, 1, 0}, Degrees(90));
+		const auto moved = tree.Translate(tree.Add(bar), V {2, 0, 0});
+		const auto tape = tree.Compile(tree.Rotate(moved, rotation));
+
+		// The bar goes wherever the quaternion takes its center, which 
+		// is +Z for this quarter turn - a sign error would send it to  
+		// -Z instead                                                   
+		const V center = rotation * V {2, 0, 0};
+		REQUIRE(center[2] == Approx(2));
+		REQUIRE(tape.Evaluate(center) == Approx(-0.25));
+		REQUIRE(tape.Evaluate(V {0, 0, T(1.2)}) < 0);
+		REQUIRE(tape.Evaluate(V {0, 0, T(-1.2)}) > 0);
+		REQUIRE(tape.Evaluate(V {2, 0, 0}) > 0);
+		REQUIRE(tape.Evaluate(V {0, 0, T(3.5)}) == Approx(0.5));
+		CompareTape(tape, points, [&](const V& p) {
+			return bar.SignedDistance(V {p * rotation} - V {2, 0, 0});
+		});
+	}
+
+	GIVEN("A long chain of unions") {
+		auto root = tree.Add(sphere);
+		for (int i = 1; i < 20; ++i)
+			root = tree.Union(root, tree.Translate(tree.Add(sphere), V {T(i) * T(0.2), 0, 0}));
+		const auto tape = tree.Compile(root);
+
+		// Evaluating the deeper child first keeps register use constant
+		REQUIRE(tape.GetDistanceRegisters() == 2);
+		REQUIRE(tape.GetPointRegisters() == 2);
+		CompareTape(tape, points, [&](const V& p) {
+			T d = sphere.SignedDistance(p);
+			for (int i = 1; i < 20; ++i)
+				d = std::min(d, sphere.SignedDistance(p - V {T(i) * T(0.2), 0, 0}));
+			return d;
+		});
+	}
+}
\ No newline at end of file
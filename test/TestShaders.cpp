@@ -0,0 +1,142 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include <Math/Shaders.hpp>
+#include <Math/Hashes.hpp>
+#include "Common.hpp"
+
+
+/// Count the occurrences of a piece of code                                  
+Count Occurrences(Token code, Token what) {
+	Count count = 0;
+	for (auto i = code.find(what); i != Token::npos; i = code.find(what, i + 1))
+		++count;
+	return count;
+}
+
+/// Remove all whitespace from a piece of code                                
+::std::string Squeeze(Token code) {
+	::std::string result;
+	for (auto c : code) {
+		if (c != ' ' and c != '\t' and c != '\n')
+			result += c;
+	}
+	return result;
+}
+
+/// Check that THoskins gives the same shader code as its snippet             
+template<Count DOUT, Count DIN>
+void CompareHoskins() {
+	using Library = TShaderLibrary<ShaderLanguage::GLSL, Shaders::HoskinsHash<DOUT, DIN>>;
+	const auto code = THoskins<DOUT, DIN>::template Hash<true>();
+	REQUIRE(Squeeze({code.GetRaw(), code.GetCount()}) == Squeeze(Library::Code));
+}
+
+SCENARIO("Generating shader libraries", "[shaders]") {
+	GIVEN("Snippets that depend on each other") {
+		using Library = TShaderLibrary<ShaderLanguage::GLSL,
+			Shaders::SimplexFractal<2>,
+			Shaders::SDFBoxRounded<3>,
+			Shaders::SimplexNoise<2>,
+			Shaders::SDFBox<3>
+		>;
+
+		static_assert(not Library::Code.empty(),
+			"Library must be generated at compile-time");
+
+		THEN("Dependencies are defined before the functions that call them") {
+			constexpr Token expected[] {
+				"Prelude", "HoskinsHash22", "SimplexNoise12", "SimplexFractal12",
+				"SDFBox3", "SDFBoxRounded3"
+			};
+
+			REQUIRE(Library::Names.size() == 6);
+			for (Offset i = 0; i < Library::Names.size(); ++i)
+				REQUIRE(Library::Names[i] == expected[i]);
+
+			REQUIRE(Library::Code.find("vec2 HoskinsHash22(vec2 p) {")
+				  < Library::Code.find("float SimplexNoise12(vec2 p) {"));
+			REQUIRE(Library::Code.find("float SimplexNoise12(vec2 p) {")
+				  < Library::Code.find("float SimplexFractal12(vec2 p,"));
+		}
+
+		THEN("Every function is defined exactly once") {
+			REQUIRE(Occurrences(Library::Code, "HoskinsHash22(vec2 p)") == 1);
+			REQUIRE(Occurrences(Library::Code, "SimplexNoise12(vec2 p)") == 1);
+			REQUIRE(Occurrences(Library::Code, "SDFBox3(vec3 p, vec3 size)") == 1);
+			REQUIRE(Library::Contains<Shaders::HoskinsHash<2, 2>>());
+			REQUIRE_FALSE(Library::Contains<Shaders::HoskinsHash<3, 3>>());
+		}
+
+		THEN("Arguments and escaped braces are filled in") {
+			REQUIRE(Occurrences(Library::Code, "{") == Occurrences(Library::Code, "}"));
+			REQUIRE(Library::Code.find("{0}") == Token::npos);
+			REQUIRE(Library::Code.find("{{") == Token::npos);
+			REQUIRE(Library::Code.find("min(max(d.x, max(d.y, d.z)), 0.0)") != Token::npos);
+			REQUIRE(Library::Code.find("return SDFBox3(p, size) - radius;") != Token::npos);
+		}
+
+		THEN("Common indentation is removed") {
+			REQUIRE(Library::Code.starts_with("vec2 HoskinsHash22(vec2 p) {\n   vec3 p3"));
+			REQUIRE(Library::Code.ends_with("\n}\n"));
+			REQUIRE(Library::Code.find("\n\n\n") == Token::npos);
+		}
+
+		THEN("GLSL libraries have no prelude") {
+			REQUIRE(Library::Code.find("#define") == Token::npos);
+		}
+	}
+
+	GIVEN("The same snippets, generated for HLSL") {
+		using Library = TShaderLibrary<ShaderLanguage::HLSL,
+			Shaders::SimplexFractal<2>,
+			Shaders::SDFBoxRounded<3>
+		>;
+
+		THEN("Code is prefixed with the compatibility prelude") {
+			REQUIRE(Library::Code.starts_with("#define vec2 float2\n"));
+			REQUIRE(Library::Code.find("#define fract frac\n") != Token::npos);
+			REQUIRE(Library::Code.find("float SimplexFractal12(vec2 p,") != Token::npos);
+		}
+	}
+
+	GIVEN("Libraries that resolve to the same snippets") {
+		using A = TShaderLibrary<ShaderLanguage::GLSL,
+			Shaders::SimplexNoise<3>>;
+		using B = TShaderLibrary<ShaderLanguage::GLSL,
+			Shaders::HoskinsHash<3, 3>, Shaders::SimplexNoise<3>, Shaders::HoskinsHash<3, 3>>;
+
+		THEN("They share the same cached code") {
+			REQUIRE(CT::Same<typename A::Snippets, typename B::Snippets>);
+			REQUIRE(A::Code.data() == B::Code.data());
+		}
+	}
+
+	GIVEN("Snippets extending along different axes") {
+		using Library = TShaderLibrary<ShaderLanguage::GLSL,
+			Shaders::SDFCylinder<Traits::X>,
+			Shaders::SDFCylinder<Traits::Z>,
+			Shaders::SDFTorus<>
+		>;
+
+		THEN("Each one is a separate function") {
+			REQUIRE(Library::Code.find("float SDFCylinderX(vec3 p, float radius) {\n   return length(p.yz) - radius;") != Token::npos);
+			REQUIRE(Library::Code.find("float SDFCylinderZ(vec3 p, float radius) {\n   return length(p.xy) - radius;") != Token::npos);
+			REQUIRE(Library::Code.find("vec2 q = vec2(length(p.xz) - outerRadius, p.y);") != Token::npos);
+		}
+	}
+	GIVEN("Hoskins hashes") {
+		THEN("THoskins gives the same shader code as the snippets") {
+			CompareHoskins<1, 1>();
+			CompareHoskins<2, 2>();
+			CompareHoskins<3, 3>();
+			CompareHoskins<3, 2>();
+			CompareHoskins<2, 4>();
+			CompareHoskins<4, 4>();
+		}
+	}
+}
@@ -0,0 +1,86 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include <Math/Primitives.hpp>
+#include <Math/SignedDistanceBatch.hpp>
+#include "Common.hpp"
+
+
+/// Compare batched signed distances against the scalar ones                  
+template<class T, Count C, class P>
+void CompareDistances(const TVectorStream<T, C>& points, const P& primitive) {
+	const auto distances = SignedDistance(points, primitive);
+	REQUIRE(distances.GetCount() == points.GetCount());
+	for (Offset i = 0; i < points.GetCount(); ++i)
+		REQUIRE(distances[i] == Approx(primitive.SignedDistance(points.Get(i))).margin(0.0001));
+}
+
+TEMPLATE_TEST_CASE("Batched signed distance functions", "[sdf]", REAL_TYPES) {
+	using T = TestType;
+	using V2 = TVector<T, 2>;
+	using V3 = TVector<T, 3>;
+
+	// An odd number of points, so that the last block is partial         
+	constexpr Count count = 101;
+	TVectorStream<T, 2> points2 {count};
+	TVectorStream<T, 3> points3 {count};
+	for (Offset i = 0; i < count; ++i) {
+		const T x = T(int(i % 7) - 3) * T(0.4);
+		const T y = T(int(i % 5) - 2) * T(0.45);
+		const T z = T(int(i % 11) - 5) * T(0.3);
+		points2.Set(i, V2 {x, y});
+		points3.Set(i, V3 {x, y, z});
+	}
+
+	GIVEN("Boxes") {
+		TBox<V3> box;
+		box.mOffsets = V3 {1, T(0.5), T(0.75)};
+		TBoxRounded<V3> rounded;
+		rounded.mOffsets = V3 {T(0.5), T(0.5), 1};
+		rounded.mRadius = T(0.25);
+		TBox<V2> box2;
+
+		CompareDistances(points3, box);
+		CompareDistances(points3, rounded);
+		CompareDistances(points2, box2);
+	}
+
+	GIVEN("Cylinders and a cone") {
+		TCylinder<V3> cylinder;
+		TCylinderCapped<V3> capped;
+		capped.mHeight = T(0.75);
+		TCylinder<V3, Traits::X> sideways;
+		TCone<V3> cone;
+		cone.mHeight = 1;
+		cone.mAngle = TRadians<T> {T(0.5)};
+
+		CompareDistances(points3, cylinder);
+		CompareDistances(points3, capped);
+		CompareDistances(points3, sideways);
+		CompareDistances(points3, cone);
+	}
+
+	GIVEN("A plane, a sphere and an ellipsoid") {
+		const TPlane<V3> plane {V3 {1, 2, 3}, T(0.5)};
+		TSphere<V3> sphere;
+		sphere.mRadius = T(1.25);
+		TEllipsoid<V3> ellipsoid;
+		ellipsoid.mRadii = V3 {1, 2, T(0.5)};
+
+		CompareDistances(points3, plane);
+		CompareDistances(points3, sphere);
+		CompareDistances(points3, ellipsoid);
+	}
+
+	GIVEN("Triangles") {
+		const TTriangle<V3> triangle3 {V3 {-1, 0, 0}, V3 {1, T(0.5), 0}, V3 {0, 1, 1}};
+		const TTriangle<V2> triangle2 {V2 {-1, -1}, V2 {1, T(-0.5)}, V2 {0, 1}};
+
+		CompareDistances(points3, triangle3);
+		CompareDistances(points2, triangle2);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,199 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include <Math/SimplexNoise.hpp>
+#include <Math/Random.hpp>
+#include "Common.hpp"
+
+
+/// The unscaled simplex noise at a point, if every corner's gradient had     
+/// components of -1 or 1, pointing away from the corner - the worst case     
+/// that hashes can produce                                                   
+template<Count D>
+double SimplexWorstCase(const double (&p)[D]) {
+	using Traits = Inner::SimplexTraits<D, double>;
+	double s = 0, t = 0, x0[D];
+	for (Offset c = 0; c < D; ++c)
+		s += p[c];
+	for (Offset c = 0; c < D; ++c) {
+		const double f = ::std::floor(p[c] + s * Traits::F);
+		x0[c] = p[c] - f;
+		t += f;
+	}
+	for (Offset c = 0; c < D; ++c)
+		x0[c] += t * Traits::G;
+
+	Count rank[D] {};
+	for (Offset a = 0; a < D; ++a) {
+		for (Offset b = a + 1; b < D; ++b)
+			++rank[x0[a] > x0[b] ? a : b];
+	}
+
+	double v = 0;
+	for (Offset k = 0; k <= D; ++k) {
+		double r2 = 0, l1 = 0;
+		for (Offset c = 0; c < D; ++c) {
+			const double x = x0[c] - (rank[c] >= D - k) + k * Traits::G;
+			r2 += x * x;
+			l1 += ::std::abs(x);
+		}
+		const double f = ::std::max(Traits::R2 - r2, 0.0);
+		v += f * f * f * f * l1;
+	}
+	return v;
+}
+
+
+TEMPLATE_TEST_CASE("Simplex noise", "[noise]", REAL_TYPES) {
+	using T = TestType;
+	using V = TVector<T, 4>;
+	using N1 = TSimplex<1, 1, T>;
+	using N2 = TSimplex<1, 2, T>;
+	using N3 = TSimplex<2, 3, T>;
+	using N4 = TSimplex<1, 4, T>;
+	RNG rng {9};
+
+	GIVEN("Random points") {
+		V points[256];
+		for (auto& p : points) {
+			for (Offset c = 0; c < 4; ++c)
+				p[c] = rng.template Get<T>() * T(100);
+		}
+
+		THEN("Noise is in [-1:1], and not constant") {
+			T min = 1, max = -1;
+			for (auto& p : points) {
+				const T n[] {N1::Hash(p), N2::Hash(p), N3::Hash(p)[0], N3::Hash(p)[1], N4::Hash(p)};
+				for (auto v : n) {
+					REQUIRE(v >= T(-1));
+					REQUIRE(v <= T(1));
+					min = ::std::min(min, v);
+					max = ::std::max(max, v);
+				}
+			}
+			REQUIRE(max - min > T(0.5));
+		}
+
+		THEN("Noise is zero at lattice points") {
+			REQUIRE(N1::Hash(V {3, 0, 0, 0}) == Approx(T(0)).margin(0.00001));
+			REQUIRE(N3::Hash(V {0, 0, 0, 0})[0] == Approx(T(0)).margin(0.00001));
+		}
+
+		THEN("Channels are different") {
+			Count same = 0;
+			for (auto& p : points) {
+				const auto n = N3::Hash(p);
+				same += n[0] == n[1];
+			}
+			REQUIRE(same < 5);
+		}
+
+		THEN("Derivatives match finite differences") {
+			const T h = sizeof(T) == 4 ? T(0.001) : T(0.000001);
+			for (Offset i = 0; i < 32; ++i) {
+				const auto& p = points[i];
+				const auto d = N4::Derivative(p);
+				REQUIRE(d[0] == Approx(N4::Hash(p)));
+				for (Offset c = 0; c < 4; ++c) {
+					V a = p, b = p;
+					a[c] += h;
+					b[c] -= h;
+					const T numeric = (N4::Hash(a) - N4::Hash(b)) / (h * 2);
+					REQUIRE(d[c + 1] == Approx(numeric).margin(0.01));
+				}
+			}
+		}
+
+		THEN("Fractal noise stays in range") {
+			for (auto& p : points) {
+				const T fbm = N2::Fractal(p);
+				const T ridged = N2::template Fractal<N2::Ridged>(p);
+				const T turbulence = N2::template Fractal<N2::Turbulence>(p);
+				REQUIRE(fbm >= T(-1));
+				REQUIRE(fbm <= T(1));
+				REQUIRE(ridged >= T(0));
+				REQUIRE(ridged <= T(1));
+				REQUIRE(turbulence >= T(0));
+				REQUIRE(turbulence <= T(1));
+			}
+
+			typename N2::Octaves single;
+			single.mCount = 1;
+			REQUIRE(N2::Fractal(points[0], single) == Approx(N2::Hash(points[0])));
+		}
+	}
+
+	GIVEN("The points where the worst case is largest") {
+		// Found by maximizing SimplexWorstCase from random starts       
+		const double p1[1] {2.5};
+		const double p2[2] {1.865998162, -0.134001837};
+		const double p3[3] {1.310664199, 1.310664198, 0.310664199};
+		const double p4[4] {0.290241651, 2.290241652, 0.290241651, 0.290241649};
+
+		THEN("Scaling brings even the worst case in [-1:1]") {
+			const double peaks[] {
+				SimplexWorstCase(p1) * Inner::SimplexTraits<1, T>::Scale,
+				SimplexWorstCase(p2) * Inner::SimplexTraits<2, T>::Scale,
+				SimplexWorstCase(p3) * Inner::SimplexTraits<3, T>::Scale,
+				SimplexWorstCase(p4) * Inner::SimplexTraits<4, T>::Scale
+			};
+			for (auto peak : peaks) {
+				REQUIRE(peak <= 1.000001);
+				REQUIRE(peak > 0.9999);
+			}
+		}
+
+		THEN("No other point gets any closer") {
+			for (Offset i = 0; i < 1000; ++i) {
+				double q[4];
+				for (auto& c : q)
+					c = rng.template Get<double>() * 10;
+				const double q1[1] {q[0]};
+				const double q2[2] {q[0], q[1]};
+				const double q3[3] {q[0], q[1], q[2]};
+				REQUIRE(SimplexWorstCase(q1) <= SimplexWorstCase(p1) * 1.000001);
+				REQUIRE(SimplexWorstCase(q2) <= SimplexWorstCase(p2) * 1.000001);
+				REQUIRE(SimplexWorstCase(q3) <= SimplexWorstCase(p3) * 1.000001);
+				REQUIRE(SimplexWorstCase(q) <= SimplexWorstCase(p4) * 1.000001);
+			}
+		}
+	}
+
+	GIVEN("A stream of points") {
+		constexpr Count Count3 = 1000;
+		TVectorStream<T, 3> stream {Count3};
+		for (Offset i = 0; i < Count3; ++i) {
+			stream.Set(i, TVector<T, 3> {
+				rng.template Get<T>() * T(50),
+				rng.template Get<T>() * T(50),
+				rng.template Get<T>() * T(50)
+			});
+		}
+
+		WHEN("Noise is sampled in bulk") {
+			const auto noise = N3::Hash(stream);
+			const auto derivative = N3::Derivative(stream, 1);
+			const auto ridged = N3::template Fractal<N3::Ridged>(stream);
+
+			THEN("Results match sampling point by point") {
+				REQUIRE(noise.GetCount() == Count3);
+				for (Offset i = 0; i < Count3; ++i) {
+					const auto p = stream.Get(i);
+					const V p4 {p[0], p[1], p[2], 0};
+					const auto n = N3::Hash(p4);
+					const auto d = N3::Derivative(p4, 1);
+					const auto r = N3::template Fractal<N3::Ridged>(p4);
+					REQUIRE(noise.Get(i)[0] == Approx(n[0]).margin(0.0001));
+					REQUIRE(noise.Get(i)[1] == Approx(n[1]).margin(0.0001));
+					REQUIRE(ridged.Get(i)[0] == Approx(r[0]).margin(0.0001));
+					for (Offset c = 0; c < 4; ++c)
+						REQUIRE(derivative.Get(i)[c] == Approx(d[c]).margin(0.001));
+				}
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include <Math/Primitives.hpp>
+#include <Math/SignedDistanceBatch.hpp>
+#include <Math/SphereTracer.hpp>
+#include "Common.hpp"
+
+
+TEMPLATE_TEST_CASE("Sphere tracing", "[sdf]", REAL_TYPES) {
+	using T = TestType;
+	using V = TVector<T, 3>;
+
+	TSphere<V> sphere;
+	sphere.mRadius = 1;
+	const auto scalar = [&](const V& p) {
+		return sphere.SignedDistance(p);
+	};
+	const auto batched = [&](const TVectorStream<T, 3>& p, T* d) {
+		SignedDistance(p, sphere, d);
+	};
+
+	TSphereTracer<V> tracer;
+	tracer.mEpsilon = T(0.00001);
+	const TRay<V> ray {V {0, 0, -5}, V {0, 0, 1}};
+	const TRay<V> miss {V {0, 2, -5}, V {0, 0, 1}};
+
+	GIVEN("A single ray") {
+		const auto hit = tracer.Trace(ray, scalar);
+
+		REQUIRE(hit);
+		REQUIRE(hit.mDistance == Approx(4).margin(0.001));
+		REQUIRE(hit.mPoint[2] == Approx(-1).margin(0.001));
+		REQUIRE(hit.mNormal[2] == Approx(-1).margin(0.001));
+		REQUIRE(hit.mIterations > 0);
+		REQUIRE(hit.mIterations <= tracer.mMaxSteps);
+
+		const auto missed = tracer.Trace(miss, scalar);
+		REQUIRE_FALSE(missed);
+		REQUIRE(missed.mIterations > 0);
+	}
+
+	GIVEN("A ray starting inside") {
+		const auto hit = tracer.Trace(TRay<V> {V {}, V {1, 0, 0}}, scalar);
+
+		REQUIRE(hit);
+		REQUIRE(hit.mDistance == Approx(1).margin(0.001));
+		REQUIRE(hit.mNormal[0] == Approx(1).margin(0.001));
+	}
+
+	GIVEN("Over-relaxation, a step cap and a Lipschitz bound") {
+		TSphereTracer<V> plain = tracer;
+		plain.mRelaxation = 1;
+		TSphereTracer<V> capped = plain;
+		capped.mMaxStep = T(0.1);
+		TSphereTracer<V> bounded = tracer;
+		bounded.mLipschitz = 3;
+
+		const auto a = plain.Trace(ray, scalar);
+		const auto b = capped.Trace(ray, scalar);
+		const auto c = bounded.Trace(ray, [&](const V& p) {
+			return sphere.SignedDistance(p) * 3;
+		});
+
+		REQUIRE(a.mDistance == Approx(4).margin(0.001));
+		REQUIRE(b.mDistance == Approx(4).margin(0.001));
+		REQUIRE(c.mDistance == Approx(4).margin(0.001));
+		REQUIRE(b.mIterations >= 40);
+	}
+
+	GIVEN("Packets of rays, traced in parallel") {
+		constexpr Count count = 101;
+		TMany<TRay<V>> rays;
+		for (Offset i = 0; i < count; ++i) {
+			const T y = T(int(i) - 50) / T(40);
+			rays << TRay<V> {V {0, y, -5}, V {0, 0, 1}};
+		}
+
+		const auto fromScalar = tracer.Trace(rays, scalar, 3);
+		const auto fromBatched = tracer.Trace(rays, batched, 3);
+
+		REQUIRE(fromScalar.GetCount() == count);
+		REQUIRE(fromBatched.GetCount() == count);
+		for (Offset i = 0; i < count; ++i) {
+			const T y = T(int(i) - 50) / T(40);
+			const bool expected = std::abs(y) < T(0.999);
+			if (expected) {
+				REQUIRE(fromScalar[i]);
+				REQUIRE(fromBatched[i]);
+				const T distance = 5 - std::sqrt(1 - y * y);
+				REQUIRE(fromScalar[i].mDistance == Approx(distance).margin(0.001));
+				REQUIRE(fromBatched[i].mDistance == Approx(distance).margin(0.001));
+				REQUIRE(fromBatched[i].mNormal[1] == Approx(y).margin(0.001));
+			}
+			else if (std::abs(y) > T(1.001)) {
+				REQUIRE_FALSE(fromScalar[i]);
+				REQUIRE_FALSE(fromBatched[i]);
+			}
+		}
+	}
+}
\ No newline at end of file
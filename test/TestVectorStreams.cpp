@@ -0,0 +1,98 @@
+///                                                                           
+/// Langulus::Math                                                            
+/// Copyright (c) 2014 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: GPL-3.0-or-later                                 
+///                                                                           
+#include <Math/VectorStream.hpp>
+#include "Common.hpp"
+
+
+TEMPLATE_TEST_CASE("Vector streams", "[vec][stream]", REAL_TYPES) {
+	using T = TestType;
+	using V = TVector<T, 3>;
+	using Stream = TVectorStream<T, 3>;
+
+	GIVEN("A stream of vectors, that doesn't fill a whole block") {
+		// Odd count, so that both SIMD blocks and scalar tail are used       
+		constexpr Count count = Stream::Block * 2 + 3;
+		TMany<V> source;
+		for (Count i = 0; i < count; ++i)
+			source << V {T(i + 1), T(i) * 2, T(3)};
+
+		Stream x {source};
+
+		REQUIRE(x.GetCount() == count);
+		REQUIRE(x.GetReserved() % Stream::Block == 0);
+		for (Offset c = 0; c < 3; ++c) {
+			REQUIRE(reinterpret_cast<::std::uintptr_t>(x.GetLane(c)) % Stream::Alignment == 0);
+			REQUIRE(x.GetLane(c)[count] == 0);
+		}
+
+		WHEN("Converting back to a container") {
+			const auto back = x.ToMany();
+
+			REQUIRE(back.GetCount() == count);
+			for (Offset i = 0; i < count; ++i)
+				REQUIRE(back[i] == source[i]);
+		}
+
+		WHEN("Computing dot products and lengths") {
+			const auto dots = x.Dot(V {1, 2, 3});
+			const auto lengths = x.Length();
+
+			REQUIRE(dots.GetCount() == count);
+			for (Offset i = 0; i < count; ++i) {
+				REQUIRE(dots[i][0] == Approx(source[i].Dot(V {1, 2, 3})));
+				REQUIRE(lengths[i][0] == Approx(source[i].Length()));
+			}
+		}
+
+		WHEN("Computing cross products") {
+			const auto crosses = x.Cross(Stream {count, V {0, 1, 0}});
+
+			for (Offset i = 0; i < count; ++i)
+				REQUIRE(crosses[i] == source[i].Cross(V {0, 1, 0}));
+		}
+
+		WHEN("Normalizing") {
+			const auto normalized = x.Normalize();
+
+			for (Offset i = 0; i < count; ++i) {
+				const auto expected = source[i].Normalize();
+				REQUIRE(normalized[i][0] == Approx(expected[0]));
+				REQUIRE(normalized[i][1] == Approx(expected[1]));
+				REQUIRE(normalized[i][2] == Approx(expected[2]));
+			}
+		}
+
+		WHEN("Doing arithmetics, min, max and clamp") {
+			const auto sum = x + x;
+			const auto scaled = x * T(2);
+			const auto offset = x - V {1, 1, 1};
+			const auto clamped = x.Clamp(V {2, 2, 2}, V {10, 10, 10});
+			const auto lower = x.Min(V {5, 5, 5});
+			const auto upper = x.Max(V {5, 5, 5});
+
+			for (Offset i = 0; i < count; ++i) {
+				REQUIRE(sum[i] == source[i] + source[i]);
+				REQUIRE(scaled[i] == source[i] * T(2));
+				REQUIRE(offset[i] == source[i] - V {1, 1, 1});
+				REQUIRE(clamped[i] == source[i].Clamp(V {2, 2, 2}, V {10, 10, 10}));
+				REQUIRE(lower[i] == source[i].Min(V {5, 5, 5}));
+				REQUIRE(upper[i] == source[i].Max(V {5, 5, 5}));
+			}
+		}
+	}
+
+	GIVEN("A stream with a degenerate vector") {
+		Stream x;
+		x.Push(V {1, 0, 0});
+		x.Push(V {0, 0, 0});
+
+		WHEN("Normalizing") {
+			REQUIRE_THROWS(x.Normalize());
+		}
+	}
+}
\ No newline at end of file